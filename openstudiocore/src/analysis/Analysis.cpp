@@ -34,8 +34,18 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Json.hpp"
+#include "../utilities/core/JsonStream.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 
+#include <boost/filesystem/fstream.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
 namespace openstudio {
 namespace analysis {
 
@@ -48,7 +58,8 @@ namespace detail {
       m_problem(problem),
       m_seed(FileReference(toPath("*." + seedType.valueDescription()))),
       m_resultsAreInvalid(false),
-      m_dataPointsAreInvalid(false)
+      m_dataPointsAreInvalid(false),
+      m_dataPointsByTagIsCurrent(false)
   {
     m_seed.makePathRelative();
     if (problem.inputFileType() && (seedType != problem.inputFileType())) {
@@ -67,7 +78,8 @@ namespace detail {
       m_problem(problem),
       m_seed(seed),
       m_resultsAreInvalid(false),
-      m_dataPointsAreInvalid(false)
+      m_dataPointsAreInvalid(false),
+      m_dataPointsByTagIsCurrent(false)
   {
     if (problem.inputFileType() && (seed.fileType() != problem.inputFileType())) {
       LOG_AND_THROW("Unable to construct Analysis '" << name << "', because the seed file is of "
@@ -87,7 +99,8 @@ namespace detail {
       m_seed(seed),
       m_weatherFile(weatherFile),
       m_resultsAreInvalid(false),
-      m_dataPointsAreInvalid(false)
+      m_dataPointsAreInvalid(false),
+      m_dataPointsByTagIsCurrent(false)
   {
     if (problem.inputFileType() && (seed.fileType() != problem.inputFileType())) {
       LOG_AND_THROW("Unable to construct Analysis '" << name << "', because the seed file is of "
@@ -110,7 +123,8 @@ namespace detail {
       m_algorithm(algorithm),
       m_seed(seed),
       m_resultsAreInvalid(false),
-      m_dataPointsAreInvalid(false)
+      m_dataPointsAreInvalid(false),
+      m_dataPointsByTagIsCurrent(false)
   {
     if (!m_algorithm->isCompatibleProblemType(m_problem)) {
       LOG_AND_THROW("Unable to construct Analysis '" << name << "', because Problem '"
@@ -137,7 +151,8 @@ namespace detail {
       m_seed(seed),
       m_weatherFile(weatherFile),
       m_resultsAreInvalid(false),
-      m_dataPointsAreInvalid(false)
+      m_dataPointsAreInvalid(false),
+      m_dataPointsByTagIsCurrent(false)
   {
     if (!m_algorithm->isCompatibleProblemType(m_problem)) {
       LOG_AND_THROW("Unable to construct Analysis '" << name << "', because Problem '"
@@ -175,7 +190,8 @@ namespace detail {
       m_weatherFile(weatherFile),
       m_dataPoints(dataPoints),
       m_resultsAreInvalid(resultsAreInvalid),
-      m_dataPointsAreInvalid(dataPointsAreInvalid)
+      m_dataPointsAreInvalid(dataPointsAreInvalid),
+      m_dataPointsByTagIsCurrent(false)
   {
     // override default of objects not being dirty when they are de-serialized
     if (resultsAreInvalid || dataPointsAreInvalid) {
@@ -195,6 +211,7 @@ namespace detail {
         }
       }
       connectChild(dataPoint,false);
+      indexDataPoint(dataPoint);
     }
   }
 
@@ -203,7 +220,8 @@ namespace detail {
       m_problem(other.problem().clone().cast<Problem>()),
       m_seed(other.seed().clone()),
       m_resultsAreInvalid(other.resultsAreInvalid()),
-      m_dataPointsAreInvalid(other.dataPointsAreInvalid())
+      m_dataPointsAreInvalid(other.dataPointsAreInvalid()),
+      m_dataPointsByTagIsCurrent(false)
   {
     connectChild(m_problem,false);
     if (other.algorithm()) {
@@ -217,6 +235,7 @@ namespace detail {
       m_dataPoints.push_back(dataPoint.clone().cast<DataPoint>());
       m_dataPoints.back().setProblem(m_problem);
       connectChild(m_dataPoints.back(),false);
+      indexDataPoint(m_dataPoints.back());
     }
   }
 
@@ -313,6 +332,21 @@ namespace detail {
       const std::vector<QVariant>& variableValues) const
   {
     DataPointVector result;
+    std::vector<std::size_t> hashes;
+    if (variableValuesAreIndexed(variableValues)) {
+      hashes = variableValuesHashes(variableValues);
+    }
+    if (!hashes.empty()) {
+      for (std::size_t hash : hashes) {
+        auto range = m_dataPointsByVariableValues.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+          if (it->second.matches(variableValues)) {
+            result.push_back(it->second);
+          }
+        }
+      }
+      return result;
+    }
     for (const DataPoint& dataPoint : m_dataPoints) {
       if (dataPoint.matches(variableValues)) {
         result.push_back(dataPoint);
@@ -334,13 +368,12 @@ namespace detail {
   }
 
   std::vector<DataPoint> Analysis_Impl::getDataPoints(const std::string& tag) const {
-    DataPointVector result;
-    for (const DataPoint& dataPoint : m_dataPoints) {
-      if (dataPoint.isTag(tag)) {
-        result.push_back(dataPoint);
-      }
+    updateTagIndex();
+    auto it = m_dataPointsByTag.find(tag);
+    if (it != m_dataPointsByTag.end()) {
+      return it->second;
     }
-    return result;
+    return DataPointVector();
   }
 
   boost::optional<DataPoint> Analysis_Impl::getDataPoint(
@@ -361,24 +394,15 @@ namespace detail {
 
   boost::optional<DataPoint> Analysis_Impl::getDataPointByUUID(const UUID& uuid) const {
     OptionalDataPoint result;
-    for (const DataPoint& myDataPoint : dataPoints()) {
-      if (myDataPoint.uuid() == uuid) {
-        result = myDataPoint;
-        break;
-      }
+    auto it = m_dataPointsByUUID.find(uuid);
+    if (it != m_dataPointsByUUID.end()) {
+      result = it->second;
     }
     return result;
   }
 
   boost::optional<DataPoint> Analysis_Impl::getDataPointByUUID(const DataPoint& dataPoint) const {
-    OptionalDataPoint result;
-    for (const DataPoint& myDataPoint : dataPoints()) {
-      if (dataPoint.uuidEqual(myDataPoint)) {
-        result = myDataPoint;
-        break;
-      }
-    }
-    return result;
+    return getDataPointByUUID(dataPoint.uuid());
   }
 
   bool Analysis_Impl::resultsAreInvalid() const {
@@ -482,6 +506,37 @@ namespace detail {
   }
 
   bool Analysis_Impl::addDataPoint(DataPoint& dataPoint) {
+    if (insertDataPoint(dataPoint)) {
+      onChange(AnalysisObject_Impl::Benign);
+      return true;
+    }
+    return false;
+  }
+
+  bool Analysis_Impl::addDataPoint(const std::vector<Measure>& measures) {
+    OptionalDataPoint dataPoint = problem().createDataPoint(measures);
+    if (dataPoint) {
+      return addDataPoint(*dataPoint);
+    }
+    LOG(Error,"Cannot add DataPoint to Analysis '" << name() << "', because the provided "
+        "measures were invalid for Problem '" << problem().name() << "'.");
+    return false;
+  }
+
+  unsigned Analysis_Impl::addDataPoints(const std::vector<DataPoint>& dataPoints) {
+    unsigned result(0);
+    for (DataPoint dataPoint : dataPoints) {
+      if (insertDataPoint(dataPoint)) {
+        ++result;
+      }
+    }
+    if (result > 0) {
+      onChange(AnalysisObject_Impl::Benign);
+    }
+    return result;
+  }
+
+  bool Analysis_Impl::insertDataPoint(DataPoint& dataPoint) {
     if (m_dataPointsAreInvalid) {
       LOG(Info,"Current data points are invalid. Call removeAllDataPoints before adding new ones.");
       return false;
@@ -502,20 +557,10 @@ namespace detail {
     }
     m_dataPoints.push_back(dataPoint);
     connectChild(m_dataPoints.back(),true);
-    onChange(AnalysisObject_Impl::Benign);
+    indexDataPoint(m_dataPoints.back());
     return true;
   }
 
-  bool Analysis_Impl::addDataPoint(const std::vector<Measure>& measures) {
-    OptionalDataPoint dataPoint = problem().createDataPoint(measures);
-    if (dataPoint) {
-      return addDataPoint(*dataPoint);
-    }
-    LOG(Error,"Cannot add DataPoint to Analysis '" << name() << "', because the provided "
-        "measures were invalid for Problem '" << problem().name() << "'.");
-    return false;
-  }
-
   bool Analysis_Impl::setDataPointRunInformation(DataPoint& dataPoint, const runmanager::Job& topLevelJob, const std::vector<openstudio::path>& dakotaParametersFiles)
   {
     OptionalDataPoint exactDataPoint = getDataPointByUUID(dataPoint);
@@ -533,6 +578,7 @@ namespace detail {
       auto it = std::find(m_dataPoints.begin(),m_dataPoints.end(),*exactDataPoint);
       OS_ASSERT(it != m_dataPoints.end());
       disconnectChild(*it);
+      unindexDataPoint(*it);
       m_dataPoints.erase(it);
       // TODO: It may be that the algorithm should be reset, or at least marked not-complete.
       if (m_dataPoints.empty()) {
@@ -551,6 +597,10 @@ namespace detail {
       disconnectChild(dataPoint);
     }
     m_dataPoints.clear();
+    m_dataPointsByUUID.clear();
+    m_dataPointsByVariableValues.clear();
+    m_dataPointsByTag.clear();
+    m_dataPointsByTagIsCurrent = false;
     if (m_algorithm) {
       m_algorithm->reset();
     }
@@ -734,20 +784,152 @@ namespace detail {
                                const AnalysisSerializationOptions& options,
                                bool overwrite) const
   {
-    QVariant json = toVariant(options);
-    return openstudio::saveJSON(json,p,overwrite);
+    // same file handling as openstudio::saveJSON
+    openstudio::path jsonPath = setFileExtension(p,"json",true);
+    boost::filesystem::ofstream file(jsonPath,std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (!file) {
+      LOG(Error,"Could not open file " << toString(jsonPath) << " for writing.");
+      return false;
+    }
+    toJSON(file,options);
+    file.close();
+    return !file.fail();
   }
 
   std::ostream& Analysis_Impl::toJSON(std::ostream& os,
                                       const AnalysisSerializationOptions& options) const
   {
-    os << toJSON(options);
+    // streamed rather than assembled as one QVariant, since data points dominate the size of
+    // a full analysis. data_points is written last so appendDataPointsJSON can extend it.
+    JsonStreamWriter writer(os);
+    writer.writeStartObject();
+    writer.writeMembers(jsonMetadata().toMap()); // openstudio_version
+    writer.writeKey("analysis");
+    writer.writeStartObject();
+    writer.writeMembers(toAnalysisMap(options));
+    if (options.scope == AnalysisSerializationScope::Full) {
+      writer.writeKey("data_points");
+      writer.writeStartArray();
+      for (const DataPoint& dataPoint : m_dataPoints) {
+        writer.writeValue(dataPoint.toVariant());
+      }
+      writer.writeEndArray();
+    }
+    writer.writeEndObject();
+    writer.writeEndObject();
+    os << std::endl;
     return os;
   }
 
   std::string Analysis_Impl::toJSON(const AnalysisSerializationOptions& options) const {
-    QVariant json = this->toVariant(options);
-    return openstudio::toJSON(json);
+    std::stringstream ss;
+    toJSON(ss,options);
+    return ss.str();
+  }
+
+  bool Analysis_Impl::appendDataPointsJSON(const openstudio::path& p,
+                                           const std::vector<DataPoint>& dataPoints) const
+  {
+    openstudio::path jsonPath = setFileExtension(p,"json",true);
+    UUID problemUUID = problem().uuid();
+    for (const DataPoint& dataPoint : dataPoints) {
+      if (dataPoint.problemUUID() != problemUUID) {
+        LOG(Error,"Cannot append DataPoint '" << dataPoint.name() << "' to " << toString(jsonPath)
+            << ", because it is not of this Analysis's Problem.");
+        return false;
+      }
+    }
+
+    try {
+      // the file must hold this analysis, with data_points written last
+      bool isThisAnalysis(false);
+      bool hasDataPoints(false);
+      {
+        boost::filesystem::ifstream file(jsonPath,std::ios_base::in | std::ios_base::binary);
+        if (!file) {
+          LOG(Error,"Could not open file " << toString(jsonPath) << " for reading.");
+          return false;
+        }
+        JsonStreamReader reader(file);
+        if (reader.readNext() == JsonStreamReader::StartObject) {
+          while (!hasDataPoints && (reader.readNext() == JsonStreamReader::Key)) {
+            if (reader.key() != "analysis") {
+              reader.skipValue();
+              continue;
+            }
+            if (reader.readNext() != JsonStreamReader::StartObject) {
+              break;
+            }
+            while (reader.readNext() == JsonStreamReader::Key) {
+              if (reader.key() == "uuid") {
+                isThisAnalysis = (toUUID(reader.readValue().toString().toStdString()) == uuid());
+              }
+              else if (reader.key() == "data_points") {
+                hasDataPoints = true;
+                break;
+              }
+              else {
+                reader.skipValue();
+              }
+            }
+          }
+        }
+      }
+      if (!isThisAnalysis || !hasDataPoints) {
+        LOG(Error,"Cannot append data points to " << toString(jsonPath) << ", because it does not "
+            << "contain the data points of this Analysis.");
+        return false;
+      }
+
+      // locate the closing brackets of data_points, analysis and the document
+      std::uintmax_t fileSize = boost::filesystem::file_size(jsonPath);
+      std::uintmax_t tailSize = std::min<std::uintmax_t>(fileSize,4096u);
+      std::string tail(static_cast<std::size_t>(tailSize),' ');
+      {
+        boost::filesystem::ifstream file(jsonPath,std::ios_base::in | std::ios_base::binary);
+        file.seekg(static_cast<std::streamoff>(fileSize - tailSize));
+        file.read(&tail[0],static_cast<std::streamsize>(tailSize));
+        if (!file) {
+          LOG(Error,"Could not read the end of " << toString(jsonPath) << ".");
+          return false;
+        }
+      }
+      std::string::size_type pos = tail.size();
+      for (char c : {'}','}',']'}) {
+        pos = (pos == 0u) ? std::string::npos : tail.find_last_not_of(" \t\r\n",pos - 1u);
+        if ((pos == std::string::npos) || (tail[pos] != c)) {
+          LOG(Error,"Cannot append data points to " << toString(jsonPath) << ", because its "
+              << "data_points are not the last member of the analysis.");
+          return false;
+        }
+      }
+      std::string::size_type previous = (pos == 0u) ? std::string::npos : tail.find_last_not_of(" \t\r\n",pos - 1u);
+      bool hasEntries = !((previous != std::string::npos) && (tail[previous] == '['));
+
+      boost::filesystem::resize_file(jsonPath,fileSize - tailSize + pos);
+      boost::filesystem::ofstream file(jsonPath,std::ios_base::out | std::ios_base::app | std::ios_base::binary);
+      if (!file) {
+        LOG(Error,"Could not open file " << toString(jsonPath) << " for writing.");
+        return false;
+      }
+      JsonStreamWriter writer(file);
+      writer.resumeObject(true);
+      writer.resumeObject(true);
+      writer.resumeArray(hasEntries);
+      for (const DataPoint& dataPoint : dataPoints) {
+        writer.writeValue(dataPoint.toVariant());
+      }
+      writer.writeEndArray();
+      writer.writeEndObject();
+      writer.writeEndObject();
+      file << std::endl;
+      file.close();
+      return !file.fail();
+    }
+    catch (std::exception& e) {
+      LOG(Error,"Cannot append data points to " << toString(jsonPath) << ", because " << e.what());
+    }
+    return false;
   }
 
   QVariant Analysis_Impl::toVariant() const {
@@ -768,7 +950,7 @@ namespace detail {
   }
 
   QVariant Analysis_Impl::toVariant(const AnalysisSerializationOptions& options) const {
-    QVariantMap analysisData = toVariant().toMap();
+    QVariantMap analysisData = toAnalysisMap(options);
 
     if (options.scope == AnalysisSerializationScope::Full) {
       // add data point information
@@ -780,20 +962,6 @@ namespace detail {
       analysisData["data_points"] = QVariant(dataPointList);
     }
 
-    // this data is not read upon deserialization
-    QVariantMap serverView = problem().toServerFormulationVariant().toMap();
-    analysisData.unite(serverView);
-
-    // optional project_dir to be extracted by AnalysisObject loader
-    if (!options.projectDir.empty()) {
-      analysisData["project_dir"] = toQString(options.projectDir);
-    }
-
-    // throw openstudio_version into the body of "analysis" for 
-    // easy access in the server
-    QVariantMap versionElement = jsonMetadata().toMap();
-    analysisData.unite(versionElement);
-
     // create top-level of final file
     QVariantMap result = jsonMetadata().toMap(); // openstudio_version
     result["analysis"] = QVariant(analysisData);
@@ -804,16 +972,25 @@ namespace detail {
   Analysis Analysis_Impl::fromVariant(const QVariant& variant,const VersionString& version) {
     QVariantMap map = variant.toMap();
     Problem problem = Problem_Impl::factoryFromVariant(map["problem"],version);
-    OptionalAlgorithm algorithm;
-    if (map.contains("algorithm")) {
-      algorithm =  Algorithm_Impl::factoryFromVariant(map["algorithm"],version);
-    }
     DataPointVector dataPoints;
     if (map.contains("data_points")) {
       dataPoints = deserializeUnorderedVector<DataPoint>(
             map["data_points"].toList(),
             std::function<DataPoint (const QVariant&)>(std::bind(openstudio::analysis::detail::DataPoint_Impl::factoryFromVariant,std::placeholders::_1,version,problem)));
     }
+    return fromVariant(variant,version,problem,dataPoints);
+  }
+
+  Analysis Analysis_Impl::fromVariant(const QVariant& variant,
+                                      const VersionString& version,
+                                      const Problem& problem,
+                                      const std::vector<DataPoint>& dataPoints)
+  {
+    QVariantMap map = variant.toMap();
+    OptionalAlgorithm algorithm;
+    if (map.contains("algorithm")) {
+      algorithm =  Algorithm_Impl::factoryFromVariant(map["algorithm"],version);
+    }
     return Analysis(toUUID(map["uuid"].toString().toStdString()),
                     toUUID(map["version_uuid"].toString().toStdString()),
                     map.contains("name") ? map["name"].toString().toStdString() : std::string(),
@@ -829,6 +1006,7 @@ namespace detail {
   }
 
   void Analysis_Impl::onChange(ChangeType changeType) {
+    m_dataPointsByTagIsCurrent = false;
     AnalysisObject_Impl::onChange(changeType);
     if ((changeType == AnalysisObject_Impl::InvalidatesResults) &&
         (!completeDataPoints().empty()))
@@ -843,6 +1021,154 @@ namespace detail {
     }
   }
 
+  QVariantMap Analysis_Impl::toAnalysisMap(const AnalysisSerializationOptions& options) const {
+    QVariantMap analysisData = toVariant().toMap();
+
+    // this data is not read upon deserialization
+    QVariantMap serverView = problem().toServerFormulationVariant().toMap();
+    analysisData.unite(serverView);
+
+    // optional project_dir to be extracted by AnalysisObject loader
+    if (!options.projectDir.empty()) {
+      analysisData["project_dir"] = toQString(options.projectDir);
+    }
+
+    // throw openstudio_version into the body of "analysis" for 
+    // easy access in the server
+    QVariantMap versionElement = jsonMetadata().toMap();
+    analysisData.unite(versionElement);
+
+    return analysisData;
+  }
+
+  void Analysis_Impl::indexDataPoint(const DataPoint& dataPoint) {
+    m_dataPointsByUUID.insert(std::make_pair(dataPoint.uuid(),dataPoint));
+    m_dataPointsByVariableValues.insert(std::make_pair(variableValuesHash(dataPoint.variableValues()),dataPoint));
+    m_dataPointsByTagIsCurrent = false;
+  }
+
+  void Analysis_Impl::unindexDataPoint(const DataPoint& dataPoint) {
+    m_dataPointsByUUID.erase(dataPoint.uuid());
+    auto range = m_dataPointsByVariableValues.equal_range(variableValuesHash(dataPoint.variableValues()));
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.uuidEqual(dataPoint)) {
+        m_dataPointsByVariableValues.erase(it);
+        break;
+      }
+    }
+    m_dataPointsByTagIsCurrent = false;
+  }
+
+  void Analysis_Impl::updateTagIndex() const {
+    if (m_dataPointsByTagIsCurrent) {
+      return;
+    }
+    m_dataPointsByTag.clear();
+    for (const DataPoint& dataPoint : m_dataPoints) {
+      for (const Tag& tag : dataPoint.tags()) {
+        std::vector<DataPoint>& tagged = m_dataPointsByTag[tag.name()];
+        // a data point may carry the same tag more than once
+        if (tagged.empty() || !(tagged.back().uuidEqual(dataPoint))) {
+          tagged.push_back(dataPoint);
+        }
+      }
+    }
+    m_dataPointsByTagIsCurrent = true;
+  }
+
+  bool Analysis_Impl::variableValuesAreIndexed(const std::vector<QVariant>& variableValues) const {
+    if (m_dataPointsAreInvalid || (int(variableValues.size()) != m_problem.numVariables())) {
+      return false;
+    }
+    for (const QVariant& value : variableValues) {
+      if (value.isNull()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  namespace {
+
+    // DataPoint::matches compares continuous values with an absolute tolerance near zero, float
+    // spacing is only wider than that tolerance away from zero, so values closer to zero share a key
+    const double continuousZeroKeyBound = 1.0e-6;
+
+    float continuousValueKey(double value) {
+      if (std::fabs(value) < continuousZeroKeyBound) {
+        return 0.0f;
+      }
+      return static_cast<float>(value);
+    }
+
+    // beyond this many buckets a lookup falls back to scanning the data points
+    const std::size_t maxVariableValuesHashes = 64u;
+
+  }
+
+  std::size_t Analysis_Impl::variableValuesHash(const std::vector<QVariant>& variableValues) {
+    std::size_t result(0);
+    for (const QVariant& value : variableValues) {
+      if ((value.type() == QVariant::Int) || (value.type() == QVariant::UInt)) {
+        boost::hash_combine(result,value.toInt());
+      }
+      else if (value.type() == QVariant::Double) {
+        boost::hash_combine(result,continuousValueKey(value.toDouble()));
+      }
+      else {
+        boost::hash_combine(result,int(value.type()));
+      }
+    }
+    return result;
+  }
+
+  std::vector<std::size_t> Analysis_Impl::variableValuesHashes(const std::vector<QVariant>& variableValues) {
+    std::vector<std::size_t> result(1u,0u);
+    for (const QVariant& value : variableValues) {
+      if ((value.type() == QVariant::Int) || (value.type() == QVariant::UInt)) {
+        for (std::size_t& hash : result) {
+          boost::hash_combine(hash,value.toInt());
+        }
+      }
+      else if (value.type() == QVariant::Double) {
+        // any value equal to this one is within tolerance, which is much narrower than the
+        // spacing of floats, so it has one of at most two keys
+        double d = value.toDouble();
+        double tol = 2.0 * std::max(1.0,std::fabs(d)) * std::numeric_limits<double>::epsilon();
+        float lowKey = continuousValueKey(d - tol);
+        float highKey = continuousValueKey(d + tol);
+        if (lowKey == highKey) {
+          for (std::size_t& hash : result) {
+            boost::hash_combine(hash,lowKey);
+          }
+        }
+        else {
+          if (2u * result.size() > maxVariableValuesHashes) {
+            return std::vector<std::size_t>();
+          }
+          std::vector<std::size_t> next;
+          for (std::size_t hash : result) {
+            std::size_t lowHash(hash), highHash(hash);
+            boost::hash_combine(lowHash,lowKey);
+            boost::hash_combine(highHash,highKey);
+            next.push_back(lowHash);
+            next.push_back(highHash);
+          }
+          result.swap(next);
+        }
+      }
+      else {
+        for (std::size_t& hash : result) {
+          boost::hash_combine(hash,int(value.type()));
+        }
+      }
+    }
+    // a bucket must only be visited once
+    std::sort(result.begin(),result.end());
+    result.erase(std::unique(result.begin(),result.end()),result.end());
+    return result;
+  }
+
 } // detail
 
 AnalysisSerializationOptions::AnalysisSerializationOptions(
@@ -1048,6 +1374,10 @@ bool Analysis::addDataPoint(const std::vector<Measure>& measures) {
   return getImpl<detail::Analysis_Impl>()->addDataPoint(measures);
 }
 
+unsigned Analysis::addDataPoints(const std::vector<DataPoint>& dataPoints) {
+  return getImpl<detail::Analysis_Impl>()->addDataPoints(dataPoints);
+}
+
 bool Analysis::setDataPointRunInformation(DataPoint& dataPoint, const runmanager::Job& topLevelJob, const std::vector<openstudio::path>& dakotaParametersFiles)
 {
   return getImpl<detail::Analysis_Impl>()->setDataPointRunInformation(dataPoint, topLevelJob, dakotaParametersFiles);
@@ -1108,6 +1438,12 @@ std::string Analysis::toJSON(const AnalysisSerializationOptions& options) const
   return getImpl<detail::Analysis_Impl>()->toJSON(options);
 }
 
+bool Analysis::appendDataPointsJSON(const openstudio::path& p,
+                                    const std::vector<DataPoint>& dataPoints) const
+{
+  return getImpl<detail::Analysis_Impl>()->appendDataPointsJSON(p,dataPoints);
+}
+
 boost::optional<Analysis> Analysis::loadJSON(const openstudio::path& p,
                                              const openstudio::path& newProjectDir)
 {
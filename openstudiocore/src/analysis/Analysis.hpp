@@ -235,6 +235,10 @@ class ANALYSIS_API Analysis : public AnalysisObject {
    *  the resulting DataPoint is not yet in this Analysis, and if not dataPointsAreInvalid. */
   bool addDataPoint(const std::vector<Measure>& measures);
 
+  /** Adds each DataPoint in dataPoints as addDataPoint would, but registers a single change for
+   *  the whole batch. Returns the number of data points added. */
+  unsigned addDataPoints(const std::vector<DataPoint>& dataPoints);
+
   /** Removes dataPoint from this analysis. Returns false if dataPoint is not in this analysis by
    *  UUID. */
   bool removeDataPoint(const DataPoint& dataPoint);
@@ -297,6 +301,15 @@ class ANALYSIS_API Analysis : public AnalysisObject {
 
   std::string toJSON(const AnalysisSerializationOptions& options) const;
 
+  /** Appends dataPoints to the data_points of the json file at p, which must have been written
+   *  for this analysis by saveJSON, without rewriting the rest of the file. Loading the file
+   *  afterwards keeps the last copy of any data point that appears more than once, so a data
+   *  point can be appended again to record new results. Returns false and leaves the file
+   *  unchanged if p does not hold this analysis or if any of dataPoints is not of this
+   *  analysis's problem. */
+  bool appendDataPointsJSON(const openstudio::path& p,
+                            const std::vector<DataPoint>& dataPoints) const;
+
   static boost::optional<Analysis> loadJSON(const openstudio::path& p,
                                             const openstudio::path& newProjectDir=openstudio::path());
 
@@ -25,11 +25,19 @@
 #include "Analysis_Impl.hpp"
 #include "DataPoint.hpp"
 #include "DataPoint_Impl.hpp"
+#include "Problem.hpp"
+#include "Problem_Impl.hpp"
 
 #include "../utilities/core/Json.hpp"
+#include "../utilities/core/JsonStream.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <boost/filesystem/fstream.hpp>
+
+#include <sstream>
+#include <unordered_map>
+
 namespace openstudio {
 namespace analysis {
 
@@ -332,32 +340,114 @@ AnalysisJSONLoadResult::AnalysisJSONLoadResult(const std::vector<LogMessage>& t_
     errors(t_errors)
 {}
 
-AnalysisJSONLoadResult loadJSON(const openstudio::path& p) {
-  OptionalAnalysisObject result;
-  StringStreamLogSink logger;
-  logger.setLogLevel(Error);
+namespace {
+
+  /** Reads the top-level analysis or data_point json document in json. Analysis data points are
+   *  deserialized as they are read when the openstudio_version and problem come before them, as
+   *  in files written by Analysis::saveJSON; otherwise (for example, in files written before
+   *  data_points were placed last) they are held as QVariants until the end. If the same data
+   *  point appears more than once, as it does after Analysis::appendDataPointsJSON records new
+   *  results, the last copy is kept. Throws if json cannot be read. */
+  AnalysisJSONLoadResult loadJSONDocument(std::istream& json, const std::string& description) {
+    JsonStreamReader reader(json);
+    if (reader.readNext() != JsonStreamReader::StartObject) {
+      LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
+                         description << " does not contain a json object.");
+    }
 
-  try {
-    QVariant variant = openstudio::loadJSON(p);
-    VersionString version = extractOpenStudioVersion(variant);
-    QVariantMap map = variant.toMap();
-    QVariantMap objectMap;
+    QVariantMap map;       // top-level members, other than analysis
+    QVariantMap objectMap; // analysis members, other than data_points
+    bool isAnalysis(false);
+    boost::optional<VersionString> version;
+    boost::optional<Problem> problem;
+    DataPointVector dataPoints;
+    QVariantList pendingDataPoints;
+    std::unordered_map<UUID, unsigned, UUIDHash> dataPointIndices;
+
+    auto addDataPoint = [&](const DataPoint& dataPoint) {
+      auto it = dataPointIndices.find(dataPoint.uuid());
+      if (it == dataPointIndices.end()) {
+        dataPointIndices.insert(std::make_pair(dataPoint.uuid(),unsigned(dataPoints.size())));
+        dataPoints.push_back(dataPoint);
+      }
+      else {
+        dataPoints[it->second] = dataPoint;
+      }
+    };
+
+    while (reader.readNext() == JsonStreamReader::Key) {
+      QString key = reader.key();
+      if (key != "analysis") {
+        map[key] = reader.readValue();
+        if ((key == "openstudio_version") && !map.contains("metadata")) {
+          version = VersionString(map[key].toString().toStdString());
+        }
+        continue;
+      }
+
+      isAnalysis = true;
+      if (reader.readNext() != JsonStreamReader::StartObject) {
+        LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
+                           "The analysis in " << description << " is not a json object.");
+      }
+      while (reader.readNext() == JsonStreamReader::Key) {
+        QString analysisKey = reader.key();
+        if (analysisKey == "data_points") {
+          if (reader.readNext() != JsonStreamReader::StartArray) {
+            LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
+                               "The data_points in " << description << " are not a json array.");
+          }
+          while (reader.readNext() != JsonStreamReader::EndArray) {
+            QVariant dataPointVariant = reader.readValue();
+            if (version && problem) {
+              addDataPoint(detail::DataPoint_Impl::factoryFromVariant(dataPointVariant,*version,*problem));
+            }
+            else {
+              pendingDataPoints.push_back(dataPointVariant);
+            }
+          }
+        }
+        else {
+          objectMap[analysisKey] = reader.readValue();
+          if ((analysisKey == "problem") && version) {
+            problem = detail::Problem_Impl::factoryFromVariant(objectMap["problem"],*version);
+          }
+        }
+      }
+    }
+    if (reader.tokenType() != JsonStreamReader::EndObject) {
+      LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
+                         description << " is not a complete json object.");
+    }
+    reader.readNext(); // throws on trailing content
+
+    VersionString fileVersion = extractOpenStudioVersion(QVariant(map));
+    OptionalAnalysisObject result;
     if (map.contains("data_point")) {
       // leave objectMap blank, because it cannot contain project_dir
-      result = detail::DataPoint_Impl::factoryFromVariant(map["data_point"],version,boost::none);
+      objectMap.clear();
+      result = detail::DataPoint_Impl::factoryFromVariant(map["data_point"],fileVersion,boost::none);
     }
-    else if (map.contains("analysis")) {
-      objectMap = map["analysis"].toMap();
-      result = detail::Analysis_Impl::fromVariant(objectMap,version);
+    else if (isAnalysis) {
+      if (version && !(*version == fileVersion)) {
+        LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
+                           description << " has conflicting version identifiers.");
+      }
+      if (!problem) {
+        problem = detail::Problem_Impl::factoryFromVariant(objectMap["problem"],fileVersion);
+      }
+      for (const QVariant& dataPointVariant : pendingDataPoints) {
+        addDataPoint(detail::DataPoint_Impl::factoryFromVariant(dataPointVariant,fileVersion,*problem));
+      }
+      result = detail::Analysis_Impl::fromVariant(objectMap,fileVersion,*problem,dataPoints);
     }
     else {
       LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
-                         "The file at " << toString(p) << " does not contain a data_point or "
-                         << "an analysis.");
+                         description << " does not contain a data_point or an analysis.");
     }
     OS_ASSERT(result);
     openstudio::path projectDir;
-    if (version < VersionString("1.1.2")) {
+    if (fileVersion < VersionString("1.1.2")) {
       OS_ASSERT(map.contains("metadata"));
       if (map["metadata"].toMap().contains("project_dir")) {
         projectDir = toPath(map["metadata"].toMap()["project_dir"].toString());
@@ -368,7 +458,22 @@ AnalysisJSONLoadResult loadJSON(const openstudio::path& p) {
         projectDir = toPath(objectMap["project_dir"].toString());
       }
     }
-    return AnalysisJSONLoadResult(*result,projectDir,version);
+    return AnalysisJSONLoadResult(*result,projectDir,fileVersion);
+  }
+
+} // <anonymous>
+
+AnalysisJSONLoadResult loadJSON(const openstudio::path& p) {
+  StringStreamLogSink logger;
+  logger.setLogLevel(Error);
+
+  try {
+    boost::filesystem::ifstream file(p,std::ios_base::in | std::ios_base::binary);
+    if (!file) {
+      LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
+                         "the file cannot be opened");
+    }
+    return loadJSONDocument(file,"The file at " + toString(p));
   }
   catch (std::exception& e) {
     LOG_FREE(Error,"openstudio.analysis.AnalysisObject",
@@ -385,45 +490,33 @@ AnalysisJSONLoadResult loadJSON(const openstudio::path& p) {
 }
 
 AnalysisJSONLoadResult loadJSON(std::istream& json) {
-  return loadJSON(toString(json));
+  StringStreamLogSink logger;
+  logger.setLogLevel(Error);
+
+  try {
+    return loadJSONDocument(json,"The json stream");
+  }
+  catch (std::exception& e) {
+    LOG_FREE(Error,"openstudio.analysis.AnalysisObject",
+             "The json stream cannot be parsed as an OpenStudio analysis framework "
+             << "json file, because " << e.what() << ".");
+  }
+  catch (...) {
+    LOG_FREE(Error,"openstudio.analysis.AnalysisObject",
+             "The json stream cannot be parsed as an OpenStudio analysis framework "
+             << "json file.");
+  }
+
+  return AnalysisJSONLoadResult(logger.logMessages());
 }
 
 AnalysisJSONLoadResult loadJSON(const std::string& json) {
-  OptionalAnalysisObject result;
   StringStreamLogSink logger;
   logger.setLogLevel(Error);
 
   try {
-    QVariant variant = openstudio::loadJSON(json);
-    VersionString version = extractOpenStudioVersion(variant);
-    QVariantMap map = variant.toMap();
-    QVariantMap objectMap;
-    if (map.contains("data_point")) {
-      // leave objectMap blank, because it cannot contain project_dir
-      result = detail::DataPoint_Impl::factoryFromVariant(map["data_point"],version,boost::none);
-    }
-    else if (map.contains("analysis")) {
-      objectMap = map["analysis"].toMap();
-      result = detail::Analysis_Impl::fromVariant(objectMap,version);
-    }
-    else {
-      LOG_FREE_AND_THROW("openstudio.analysis.AnalysisObject",
-                         "The parsed json string does not contain a data_point or an analysis.");
-    }
-    OS_ASSERT(result);
-    openstudio::path projectDir;
-    if (version < VersionString("1.1.2")) {
-      OS_ASSERT(map.contains("metadata"));
-      if (map["metadata"].toMap().contains("project_dir")) {
-        projectDir = toPath(map["metadata"].toMap()["project_dir"].toString());
-      }
-    }
-    else {
-      if (objectMap.contains("project_dir")) {
-        projectDir = toPath(objectMap["project_dir"].toString());
-      }
-    }
-    return AnalysisJSONLoadResult(*result,projectDir,version);
+    std::istringstream ss(json);
+    return loadJSONDocument(ss,"The parsed json string");
   }
   catch (std::exception& e) {
     LOG_FREE(Error,"openstudio.analysis.AnalysisObject",
@@ -28,7 +28,9 @@
 #include "DataPoint.hpp"
 
 #include "../utilities/core/FileReference.hpp"
+#include "../utilities/core/UUID.hpp"
 
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -194,6 +196,10 @@ namespace detail {
      *  the resulting DataPoint is not yet in this Analysis, and if not dataPointsAreInvalid. */
     bool addDataPoint(const std::vector<Measure>& measures);
 
+    /** Adds each DataPoint in dataPoints as addDataPoint would, but registers a single change for
+     *  the whole batch. Returns the number of data points added. */
+    unsigned addDataPoints(const std::vector<DataPoint>& dataPoints);
+
     /** Sets run information on a DataPoint. Returns false if dataPoint is not in this analysis by
      *  UUID. */
     bool setDataPointRunInformation(DataPoint& dataPoint, const runmanager::Job& topLevelJob, const std::vector<openstudio::path>& dakotaParametersFiles);
@@ -258,6 +264,9 @@ namespace detail {
 
     std::string toJSON(const AnalysisSerializationOptions& options) const;
 
+    bool appendDataPointsJSON(const openstudio::path& p,
+                              const std::vector<DataPoint>& dataPoints) const;
+
     //@}
     /** @name Protected in or Absent from Public Class */
     //@{
@@ -269,6 +278,13 @@ namespace detail {
 
     static Analysis fromVariant(const QVariant& variant,const VersionString& version);
 
+    /** Deserializes the rest of the analysis from variant, around a problem and data points that
+     *  have already been deserialized. Any data_points in variant are ignored. */
+    static Analysis fromVariant(const QVariant& variant,
+                                const VersionString& version,
+                                const Problem& problem,
+                                const std::vector<DataPoint>& dataPoints);
+
     //@}
    signals:
     void seedChanged();
@@ -294,6 +310,41 @@ namespace detail {
 
    private:
     REGISTER_LOGGER("openstudio.analysis.Analysis");
+
+    // indexes into m_dataPoints, kept in step with it. data point tags can change without this
+    // analysis being told which one changed, so the tag index is rebuilt on demand after any change.
+    std::unordered_map<UUID, DataPoint, UUIDHash> m_dataPointsByUUID;
+    std::unordered_multimap<std::size_t, DataPoint> m_dataPointsByVariableValues;
+    mutable std::unordered_map<std::string, std::vector<DataPoint> > m_dataPointsByTag;
+    mutable bool m_dataPointsByTagIsCurrent;
+
+    /** The members of the top-level "analysis" element written by toJSON and toVariant, other
+     *  than data_points. */
+    QVariantMap toAnalysisMap(const AnalysisSerializationOptions& options) const;
+
+    /** Adds dataPoint without registering a change. */
+    bool insertDataPoint(DataPoint& dataPoint);
+
+    void indexDataPoint(const DataPoint& dataPoint);
+
+    void unindexDataPoint(const DataPoint& dataPoint);
+
+    void updateTagIndex() const;
+
+    /** Returns true if getDataPoints(variableValues) can be answered from the variable values
+     *  index, that is, variableValues specify every variable and the data points are valid. */
+    bool variableValuesAreIndexed(const std::vector<QVariant>& variableValues) const;
+
+    /** Hash of fully specified variable values. Discrete values are hashed as integers and
+     *  continuous values after rounding to float precision, with values near zero all hashed
+     *  as zero. Candidates from a bucket are always confirmed with matches. */
+    static std::size_t variableValuesHash(const std::vector<QVariant>& variableValues);
+
+    /** Hashes of every bucket that may hold a data point DataPoint::matches with variableValues.
+     *  Continuous values within tolerance of each other can round to neighbouring floats, so each
+     *  continuous value near a rounding boundary doubles the number of buckets. Returns an empty
+     *  vector if there would be too many, the caller then scans all data points. */
+    static std::vector<std::size_t> variableValuesHashes(const std::vector<QVariant>& variableValues);
   };
 
 } // detail
@@ -141,18 +141,25 @@ namespace detail {
       }
     }
 
-    // create data points and add to analysis
-    for (const std::vector<QVariant>& value : variableValues) {
-      DataPoint dataPoint = analysis.problem().createDataPoint(value).get();
-      dataPoint.addTag("DOE");
-      bool added = analysis.addDataPoint(dataPoint);
-      if (added) {
-        ++result;
-        ++totPoints;
-        if (mxSim && (totPoints == mxSim.get())) {
+    // create data points not yet in the analysis and add them in batches, only the data points 
+    // the analysis accepts count towards the maximum number of simulations
+    auto it = variableValues.begin();
+    while ((it != variableValues.end()) && !(mxSim && (totPoints >= mxSim.get()))) {
+      DataPointVector newDataPoints;
+      for (; it != variableValues.end(); ++it) {
+        if (mxSim && (totPoints + int(newDataPoints.size()) >= mxSim.get())) {
           break;
         }
+        if (!analysis.getDataPoints(*it).empty()) {
+          continue;
+        }
+        DataPoint dataPoint = analysis.problem().createDataPoint(*it).get();
+        dataPoint.addTag("DOE");
+        newDataPoints.push_back(dataPoint);
       }
+      int added = analysis.addDataPoints(newDataPoints);
+      result += added;
+      totPoints += added;
     }
 
     if (result == 0) {
@@ -47,11 +47,15 @@
 #include "../../utilities/core/PathHelpers.hpp"
 #include "../../utilities/bcl/BCLMeasure.hpp"
 #include "../../utilities/data/Tag.hpp"
+#include "../../utilities/math/FloatCompare.hpp"
 
 #include <resources.hxx>
 #include <OpenStudio.hxx>
 #include <runmanager/Test/ToolBin.hxx>
 
+#include <cmath>
+#include <limits>
+
 using namespace openstudio;
 using namespace openstudio::analysis;
 using namespace openstudio::ruleset;
@@ -251,6 +255,136 @@ TEST_F(AnalysisFixture, Analysis_DataPointsAreInvalid) {
   EXPECT_TRUE(analysis.dataPointsAreInvalid());
 }
 
+TEST_F(AnalysisFixture, Analysis_DataPointLookups) {
+  Analysis analysis("Analysis",
+                    Problem("Problem",VariableVector(),runmanager::Workflow()),
+                    FileReferenceType::OSM);
+
+  // two variables with four measures each
+  for (unsigned i = 0; i < 2; ++i) {
+    MeasureVector measures(1u,NullMeasure());
+    for (unsigned j = 0; j < 3; ++j) {
+      measures.push_back(RubyMeasure(toPath("measure" + QString::number(i).toStdString() + QString::number(j).toStdString() + ".rb"),
+                                     FileReferenceType::OSM,
+                                     FileReferenceType::OSM,
+                                     true));
+    }
+    EXPECT_TRUE(analysis.problem().push(MeasureGroup("Variable " + QString::number(i).toStdString(),measures)));
+  }
+
+  DataPointVector dataPoints;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      std::vector<QVariant> values;
+      values.push_back(i);
+      values.push_back(j);
+      OptionalDataPoint dataPoint = analysis.problem().createDataPoint(values);
+      ASSERT_TRUE(dataPoint);
+      if (i == 0) {
+        dataPoint->addTag("baseline");
+      }
+      dataPoints.push_back(*dataPoint);
+    }
+  }
+
+  // bulk add, duplicates are rejected
+  EXPECT_EQ(16u,analysis.addDataPoints(dataPoints));
+  EXPECT_EQ(16u,analysis.dataPoints().size());
+  EXPECT_EQ(0u,analysis.addDataPoints(dataPoints));
+  OptionalDataPoint duplicate = analysis.problem().createDataPoint(dataPoints[5].variableValues());
+  ASSERT_TRUE(duplicate);
+  EXPECT_FALSE(analysis.addDataPoint(*duplicate));
+  EXPECT_EQ(16u,analysis.dataPoints().size());
+
+  // fully specified and partial variable values
+  std::vector<QVariant> values;
+  values.push_back(2);
+  values.push_back(3);
+  DataPointVector found = analysis.getDataPoints(values);
+  ASSERT_EQ(1u,found.size());
+  EXPECT_TRUE(found[0] == dataPoints[11]);
+  values[0] = QVariant();
+  EXPECT_EQ(4u,analysis.getDataPoints(values).size());
+
+  // uuid
+  ASSERT_TRUE(analysis.getDataPointByUUID(dataPoints[7].uuid()));
+  EXPECT_TRUE(analysis.getDataPointByUUID(dataPoints[7].uuid()).get() == dataPoints[7]);
+  EXPECT_FALSE(analysis.getDataPointByUUID(createUUID()));
+
+  // tags follow changes made on the data points
+  found = analysis.getDataPoints("baseline");
+  ASSERT_EQ(4u,found.size());
+  EXPECT_TRUE(found[0] == dataPoints[0]);
+  dataPoints[15].addTag("baseline");
+  EXPECT_EQ(5u,analysis.getDataPoints("baseline").size());
+  dataPoints[0].deleteTag("baseline");
+  EXPECT_EQ(4u,analysis.getDataPoints("baseline").size());
+  EXPECT_TRUE(analysis.getDataPoints("other").empty());
+
+  // removal
+  EXPECT_TRUE(analysis.removeDataPoint(dataPoints[15]));
+  EXPECT_FALSE(analysis.getDataPointByUUID(dataPoints[15].uuid()));
+  EXPECT_TRUE(analysis.getDataPoints(dataPoints[15].variableValues()).empty());
+  EXPECT_EQ(3u,analysis.getDataPoints("baseline").size());
+  EXPECT_TRUE(analysis.addDataPoint(dataPoints[15]));
+
+  // clones are indexed too
+  Analysis clone = analysis.clone().cast<Analysis>();
+  EXPECT_EQ(16u,clone.dataPoints().size());
+  EXPECT_EQ(1u,clone.getDataPoints(dataPoints[3].variableValues()).size());
+  EXPECT_FALSE(clone.getDataPointByUUID(dataPoints[3].uuid()));
+  EXPECT_TRUE(clone.getDataPointByUUID(clone.dataPoints()[3].uuid()));
+
+  analysis.removeAllDataPoints();
+  EXPECT_TRUE(analysis.getDataPoints("baseline").empty());
+  EXPECT_FALSE(analysis.getDataPointByUUID(dataPoints[3].uuid()));
+  EXPECT_EQ(16u,analysis.addDataPoints(dataPoints));
+}
+
+TEST_F(AnalysisFixture, Analysis_ContinuousDataPointLookups) {
+  BCLMeasure bclMeasure(resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade"));
+  RubyMeasure measure(bclMeasure);
+  OSArgument arg = OSArgument::makeDoubleArgument("wwr");
+  RubyContinuousVariable var("Window to Wall Ratio",arg,measure);
+  var.setMinimum(0.0);
+  var.setMaximum(0.6);
+  Analysis analysis("Analysis",
+                    Problem("Problem",VariableVector(1u,var),runmanager::Workflow()),
+                    FileReferenceType::OSM);
+
+  // two values DataPoint::matches treats as equal that round to different floats
+  float low = 0.3f;
+  float high = std::nextafter(low,1.0f);
+  double mid = (double(low) + double(high)) / 2.0;
+  double a = mid;
+  double b = std::nextafter(mid,1.0);
+  if (static_cast<float>(mid) == high) {
+    a = std::nextafter(mid,0.0);
+    b = mid;
+  }
+  ASSERT_NE(static_cast<float>(a),static_cast<float>(b));
+  ASSERT_TRUE(openstudio::equal(a,b));
+
+  OptionalDataPoint dataPoint = analysis.problem().createDataPoint(std::vector<QVariant>(1u,QVariant(a)));
+  ASSERT_TRUE(dataPoint);
+  EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+
+  std::vector<QVariant> values(1u,QVariant(b));
+  ASSERT_EQ(1u,analysis.getDataPoints(values).size());
+  EXPECT_TRUE(analysis.getDataPoints(values)[0] == *dataPoint);
+  OptionalDataPoint duplicate = analysis.problem().createDataPoint(values);
+  ASSERT_TRUE(duplicate);
+  EXPECT_FALSE(analysis.addDataPoint(*duplicate));
+
+  // values near zero
+  dataPoint = analysis.problem().createDataPoint(std::vector<QVariant>(1u,QVariant(0.0)));
+  ASSERT_TRUE(dataPoint);
+  EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+  values[0] = QVariant(std::numeric_limits<double>::epsilon() / 2.0);
+  EXPECT_EQ(1u,analysis.getDataPoints(values).size());
+  EXPECT_EQ(2u,analysis.dataPoints().size());
+}
+
 TEST_F(AnalysisFixture, Analysis_ClearAllResults) {
   // create dummy problem
   BCLMeasure bclMeasure(resourcesPath() / toPath("utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade"));
@@ -415,6 +549,47 @@ TEST_F(AnalysisFixture,Analysis_JSONSerialization_PreRun_Roundtrip) {
   EXPECT_FALSE(copy.dataPoints().empty());
 }
 
+TEST_F(AnalysisFixture,Analysis_JSONSerialization_AppendDataPoints) {
+  Analysis analysis = analysis1(PreRun);
+  DataPointVector dataPoints = analysis.dataPoints();
+  ASSERT_FALSE(dataPoints.empty());
+  unsigned n = dataPoints.size();
+
+  // data points can only be appended to a full save of the same analysis
+  openstudio::path p = toPath("AnalysisFixtureData/formulation_append.json");
+  EXPECT_TRUE(analysis.saveJSON(p,AnalysisSerializationOptions(),true));
+  EXPECT_FALSE(analysis.appendDataPointsJSON(p,dataPoints));
+  Analysis other = analysis1(PreRun);
+  AnalysisSerializationOptions options(openstudio::path(),AnalysisSerializationScope::Full);
+  p = toPath("AnalysisFixtureData/analysis_append.json");
+  EXPECT_TRUE(other.saveJSON(p,options,true));
+  EXPECT_FALSE(analysis.appendDataPointsJSON(p,dataPoints));
+
+  // an appended copy of a data point replaces the original on load
+  EXPECT_TRUE(analysis.saveJSON(p,options,true));
+  DataPoint updated = dataPoints[0];
+  updated.addTag("appended");
+  EXPECT_TRUE(analysis.appendDataPointsJSON(p,DataPointVector(1u,updated)));
+  EXPECT_TRUE(analysis.appendDataPointsJSON(p,DataPointVector(dataPoints.begin() + 1,dataPoints.end())));
+
+  AnalysisJSONLoadResult loadResult = loadJSON(p);
+  ASSERT_TRUE(loadResult.analysisObject);
+  ASSERT_TRUE(loadResult.analysisObject->optionalCast<Analysis>());
+  Analysis copy = loadResult.analysisObject->cast<Analysis>();
+  EXPECT_EQ(n,copy.dataPoints().size());
+  EXPECT_EQ(dataPoints[0].uuid(),copy.dataPoints()[0].uuid());
+  EXPECT_TRUE(copy.dataPoints()[0].isTag("appended"));
+
+  // appending to an empty data_points array
+  analysis.removeAllDataPoints();
+  EXPECT_TRUE(analysis.saveJSON(p,options,true));
+  EXPECT_TRUE(analysis.appendDataPointsJSON(p,dataPoints));
+  loadResult = loadJSON(p);
+  ASSERT_TRUE(loadResult.analysisObject);
+  ASSERT_TRUE(loadResult.analysisObject->optionalCast<Analysis>());
+  EXPECT_EQ(n,loadResult.analysisObject->cast<Analysis>().dataPoints().size());
+}
+
 TEST_F(AnalysisFixture,Analysis_JSONSerialization_Versioning) {
   openstudio::path dir = resourcesPath() / toPath("analysis/version");
 
@@ -143,6 +143,9 @@ ANALYSISDRIVER_WRAP(AnalysisDriver)
 
 ANALYSISDRIVER_WRAP(AnalysisDriverWatcher)
 ANALYSISDRIVER_WRAP(SimpleProject)
+// server factories are for C++ test servers
+%ignore openstudio::analysisdriver::CloudAnalysisDriver::CloudAnalysisDriver(const CloudSession&,const SimpleProject&,const ServerFactory&);
+%ignore openstudio::analysisdriver::CloudAnalysisDriver::ServerFactory;
 ANALYSISDRIVER_WRAP(CloudAnalysisDriver)
 
 #endif // ANALYSISDRIVER_ANALYSISDRIVER_I
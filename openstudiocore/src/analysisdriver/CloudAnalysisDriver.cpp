@@ -33,6 +33,8 @@
 #include "../runmanager/lib/AdvancedStatus.hpp"
 #include "../runmanager/lib/JSON.hpp"
 
+#include "../utilities/cloud/OSServer.hpp"
+
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Containers.hpp"
 #include "../utilities/core/System.hpp"
@@ -41,6 +43,8 @@
 
 #include <QTimer>
 
+#include <algorithm>
+
 using namespace openstudio::analysis;
 using namespace openstudio::project;
 using namespace openstudio::runmanager;
@@ -51,9 +55,11 @@ namespace analysisdriver {
 namespace detail {
 
   CloudAnalysisDriver_Impl::CloudAnalysisDriver_Impl(const CloudSession& session,
-                                                     const SimpleProject& project)
+                                                     const SimpleProject& project,
+                                                     const CloudAnalysisDriver::ServerFactory& serverFactory)
     : m_session(session),
       m_project(project),
+      m_serverFactory(serverFactory),
       m_lastRunSuccess(false),
       m_lastStopSuccess(false),
       m_lastDownloadDetailedResultsSuccess(false),
@@ -64,10 +70,10 @@ namespace detail {
       m_maxAnalysisNotRunningCount(0),
       m_dataPointsNotRunningCount(0),
       m_maxDataPointsNotRunningCount(0),
-      m_numJsonTries(0),
+      m_maxConcurrentDownloads(4),
+      m_numUnsavedJsonResults(0),
       m_onlyProcessingDownloadRequests(true),
       m_noNewReadyDataPointsCount(0),
-      m_numDetailsTries(0),
       m_waitForAlreadyRunningDataPoints(false),
       m_numDeleteDataPointTries(0),
       m_needToDeleteProject(false),
@@ -122,8 +128,10 @@ namespace detail {
                m_waitingQueue.size() +
                m_runningQueue.size() +
                m_jsonQueue.size() +
+               m_jsonDownloads.size() +
                m_preDetailsQueue.size() +
-               m_detailsQueue.size();
+               m_detailsQueue.size() +
+               m_detailsDownloads.size();
     }
 
     return result;
@@ -156,6 +164,14 @@ namespace detail {
     return dataPoint.isTag(sessionTag());
   }
 
+  unsigned CloudAnalysisDriver_Impl::maxConcurrentDownloads() const {
+    return m_maxConcurrentDownloads;
+  }
+
+  void CloudAnalysisDriver_Impl::setMaxConcurrentDownloads(unsigned n) {
+    m_maxConcurrentDownloads = std::max(n,1u);
+  }
+
   bool CloudAnalysisDriver_Impl::run(int msec) {
     if (requestRun()) {
       waitForFinished(msec);
@@ -200,7 +216,7 @@ namespace detail {
   }
 
   bool CloudAnalysisDriver_Impl::isDownloading() const {
-    return (m_requestJson || m_checkForResultsToDownload || m_requestDetails);
+    return (!m_jsonDownloads.empty() || m_checkForResultsToDownload || !m_detailsDownloads.empty());
   }
 
   std::vector<std::string> CloudAnalysisDriver_Impl::errors() const {
@@ -261,7 +277,7 @@ namespace detail {
 
     if (OptionalUrl url = session().serverUrl()) {
 
-      m_requestRun = OSServer(*url);
+      m_requestRun = m_serverFactory(*url);
 
       setStatus(AnalysisStatus::Starting);
 
@@ -299,7 +315,7 @@ namespace detail {
 
     if (OptionalUrl url = session().serverUrl()) {
 
-      m_requestStop = OSServer(*url);
+      m_requestStop = m_serverFactory(*url);
 
       setStatus(AnalysisStatus::Stopping);
 
@@ -752,11 +768,11 @@ namespace detail {
       
       // restart download process(es)
       if (!m_jsonQueue.empty()) {
-        OS_ASSERT(!m_requestJson);
+        OS_ASSERT(m_jsonDownloads.empty());
         startDownloadingJson();
       }
       if (!m_preDetailsQueue.empty()) {
-        OS_ASSERT(!m_checkForResultsToDownload && !m_requestDetails);
+        OS_ASSERT(!m_checkForResultsToDownload && m_detailsDownloads.empty());
         startDownloadingDetails();
       }
 
@@ -1037,12 +1053,12 @@ namespace detail {
         }
       }
 
-      if (!m_jsonQueue.empty() && !m_requestJson) {
+      if (!m_jsonQueue.empty() && (m_jsonDownloads.size() < m_maxConcurrentDownloads)) {
         LOG(Debug,"Starting Json downloading.");
         startDownloadingJson();
       }
 
-      if (m_waitingQueue.empty() && m_runningQueue.empty() && m_jsonQueue.empty()) {
+      if (m_waitingQueue.empty() && m_runningQueue.empty() && m_jsonQueue.empty() && m_jsonDownloads.empty()) {
         // got what we wanted, move into downloading only phase
         LOG(Debug,"All DataPoints complete. Stop monitoring.");
         appendErrorsAndWarnings(*m_monitorDataPoints); // keep warnings
@@ -1059,8 +1075,8 @@ namespace detail {
       }
       else {
         LOG(Info,"Waiting on " << m_waitingQueue.size() + m_runningQueue.size() << " DataPoints.");
-        // ask if analysis is running
-        QTimer::singleShot(1000,this,SLOT(askIfAnalysisIsRunning()));
+        // ask if analysis is running, less often while downloads are backed up
+        QTimer::singleShot(statusPollDelay(m_jsonQueue.size()),this,SLOT(askIfAnalysisIsRunning()));
       }
     }
 
@@ -1200,30 +1216,32 @@ namespace detail {
   }
 
   void CloudAnalysisDriver_Impl::jsonDownloadComplete(bool success) {
+    auto download = findSendingDownload(m_jsonDownloads);
+    if (download == m_jsonDownloads.end()) {
+      // download was dropped while its reply was queued
+      return;
+    }
+    DataPoint toUpdate = download->dataPoint;
 
     if (!success) {
-      ++m_numJsonTries;
-      if (m_numJsonTries >= 3) {
-        logError("Unable to retrieve high level results for DataPoint '" +
-                 m_jsonQueue.front().name() + "', " + removeBraces(m_jsonQueue.front().uuid()) +
-                 " from server.");
-        m_jsonFailures.push_back(m_jsonQueue.front());
-        m_jsonQueue.pop_front();
-      }
-      else {
+      ++download->numTries;
+      if (download->numTries < 3) {
+        m_jsonRetries.push_back(toUpdate.uuid());
         QTimer::singleShot(1000,this,SLOT(requestJsonRetry()));
         return;
       }
+      // give up on this data point, but keep the window going
+      logError("Unable to retrieve high level results for DataPoint '" +
+               toUpdate.name() + "', " + removeBraces(toUpdate.uuid()) +
+               " from server.");
+      m_jsonFailures.push_back(toUpdate);
     }
-
-    if (success) {
-      std::string json = m_requestJson->lastDataPointJSON();
-      DataPoint toUpdate = m_jsonQueue.front();
+    else {
+      std::string json = download->server.lastDataPointJSON();
       LOG(Debug,"Downloaded Json file for DataPoint '" << toUpdate.name() << "'.");
-      m_jsonQueue.pop_front();
       boost::optional<RunManager> rm = project().runManager();
       bool test = toUpdate.updateFromJSON(json,rm);
-      project().save();
+      ++m_numUnsavedJsonResults;
 
       // DLM: Elaine, it seems that if this point is CloudDetailed we should not emit these signals until the download is done?
       // we are having issues where datapoint shows green arrow before results are available
@@ -1237,7 +1255,7 @@ namespace detail {
       if (test) {
         if (toUpdate.runType() == DataPointRunType::CloudDetailed) {
           m_preDetailsQueue.push_back(toUpdate);
-          if (!(m_checkForResultsToDownload || m_requestDetails)) {
+          if (!m_checkForResultsToDownload && m_detailsDownloads.empty()) {
             startDownloadingDetails();
           }
         }
@@ -1245,29 +1263,62 @@ namespace detail {
       else {
         logWarning("Update of DataPoint '" + toUpdate.name() + "', " + removeBraces(toUpdate.uuid()) + " from JSON string failed.");
       }
+    }
 
-      if (m_jsonQueue.empty()) {
-        test = m_requestJson->disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(jsonDownloadComplete(bool)));
-        OS_ASSERT(test);
-        appendErrorsAndWarnings(*m_requestJson);
-        m_requestJson.reset();
-        checkForRunCompleteOrStopped();
+    // the signals above may have changed the downloads, so look this one up again. then
+    // hand its server the next data point, or retire it if the window has shrunk.
+    download = findDownload(m_jsonDownloads,toUpdate.uuid());
+    if (download != m_jsonDownloads.end()) {
+      if (!m_jsonQueue.empty() && (m_jsonDownloads.size() <= m_maxConcurrentDownloads)) {
+        download->dataPoint = m_jsonQueue.front();
+        download->numTries = 0;
+        m_jsonQueue.pop_front();
+        success = requestJsonDownload(*download);
       }
       else {
-        LOG(Info,"Have " << m_jsonQueue.size() << " DataPoints' slim results to download.");
-        m_numJsonTries = 0;
-        success = requestNextJsonDownload();
+        bool test = download->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(jsonDownloadComplete(bool)));
+        OS_ASSERT(test);
+        appendErrorsAndWarnings(download->server);
+        m_jsonDownloads.erase(download);
+        success = true;
       }
     }
+    else {
+      success = true;
+    }
 
     if (!success) {
       registerDownloadingJsonFailure();
+      return;
+    }
+
+    saveJsonResults(false);
+
+    if (!m_jsonQueue.empty() && (m_jsonDownloads.size() < m_maxConcurrentDownloads)) {
+      // window has room, for instance because it was enlarged
+      startDownloadingJson();
+      return;
+    }
+    if (m_jsonQueue.empty() && m_jsonDownloads.empty()) {
+      checkForRunCompleteOrStopped();
+    }
+    else {
+      LOG(Info,"Have " << m_jsonQueue.size() + m_jsonDownloads.size() << " DataPoints' slim results to download.");
     }
   }
 
   void CloudAnalysisDriver_Impl::requestJsonRetry() {
-    LOG(Info,"Have " << m_jsonQueue.size() << " DataPoints' slim results to download (retrying a point).");
-    bool success = requestNextJsonDownload();
+    if (m_jsonRetries.empty()) {
+      // downloads were dropped after the retry was scheduled
+      return;
+    }
+    auto download = findDownload(m_jsonDownloads,m_jsonRetries.front());
+    m_jsonRetries.pop_front();
+    if (download == m_jsonDownloads.end()) {
+      return;
+    }
+    LOG(Info,"Have " << m_jsonQueue.size() + m_jsonDownloads.size() << " DataPoints' slim results to download (retrying a point).");
+    bool success = requestJsonDownload(*download);
 
     if (!success) {
       registerDownloadingJsonFailure();
@@ -1303,7 +1354,7 @@ namespace detail {
         ++m_noNewReadyDataPointsCount;
       }
 
-      if (!m_detailsQueue.empty() && !m_requestDetails) {
+      if (!m_detailsQueue.empty() && (m_detailsDownloads.size() < m_maxConcurrentDownloads)) {
         LOG(Debug,"Start details downloading.");
         success = startActualDownloads();
       }
@@ -1323,7 +1374,7 @@ namespace detail {
           success = false;
         }
         else {
-          QTimer::singleShot(1000,this,SLOT(askForReadyForDownloadDataPointUUIDs()));
+          QTimer::singleShot(statusPollDelay(m_detailsQueue.size()),this,SLOT(askForReadyForDownloadDataPointUUIDs()));
         }
       }
     }
@@ -1341,31 +1392,39 @@ namespace detail {
   }
 
   void CloudAnalysisDriver_Impl::detailsDownloadComplete(bool success) {
+    auto download = findSendingDownload(m_detailsDownloads);
+    if (download == m_detailsDownloads.end()) {
+      // download was dropped while its reply was queued
+      return;
+    }
+    DataPoint toUpdate = download->dataPoint;
 
-    success = success && m_requestDetails->lastDownloadDataPointSuccess();
+    success = success && download->server.lastDownloadDataPointSuccess();
 
     if (!success) {
-      ++m_numDetailsTries;
-      if (m_numDetailsTries >= 3) {
+      ++download->numTries;
+      if (download->numTries >= 3) {
         logError("Unable to retrieve detailed results for DataPoint '" +
-                 m_detailsQueue.front().name() + "', " + removeBraces(m_detailsQueue.front().uuid()) +
+                 toUpdate.name() + "', " + removeBraces(toUpdate.uuid()) +
                  " from server.");
-        m_detailsFailures.push_back(m_detailsQueue.front());
-        m_detailsQueue.pop_front();
+        m_detailsFailures.push_back(toUpdate);
+        bool test = download->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)));
+        OS_ASSERT(test);
+        appendErrorsAndWarnings(download->server);
+        m_detailsDownloads.erase(download);
       }
       else {
+        m_detailsRetries.push_back(toUpdate.uuid());
         QTimer::singleShot(1000,this,SLOT(requestDetailsRetry()));
         return;
       }
     }
 
     if (success) {
-      DataPoint toUpdate = m_detailsQueue.front();
       boost::optional<RunManager> rm = project().runManager();
       LOG(Debug,"Getting detailed results for DataPoint '" << toUpdate.name() << "'.");
       bool test = toUpdate.updateDetails(rm);
       project().save();
-      m_detailsQueue.pop_front();
       emit resultsChanged();
       emit dataPointDetailsComplete(project().analysis().uuid(),toUpdate.uuid());
       emit iterationProgress(numCompleteDataPoints(),numDataPointsInIteration());
@@ -1373,18 +1432,34 @@ namespace detail {
         logWarning("Incorporation of DataPoint '" + toUpdate.name() + "', " + removeBraces(toUpdate.uuid()) + " files and details failed.");
       }
 
-      if (m_detailsQueue.empty()) {
-        test = m_requestDetails->disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)));
-        OS_ASSERT(test);
-        appendErrorsAndWarnings(*m_requestDetails);
-        m_requestDetails.reset();
+      // hand this download's server the next data point, or retire it
+      download = findDownload(m_detailsDownloads,toUpdate.uuid());
+      if (download != m_detailsDownloads.end()) {
+        if (!m_detailsQueue.empty() && (m_detailsDownloads.size() <= m_maxConcurrentDownloads)) {
+          download->dataPoint = m_detailsQueue.front();
+          download->numTries = 0;
+          m_detailsQueue.pop_front();
+          success = requestDetailsDownload(*download);
+        }
+        else {
+          test = download->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)));
+          OS_ASSERT(test);
+          appendErrorsAndWarnings(download->server);
+          m_detailsDownloads.erase(download);
+        }
+      }
+
+      if (success && !m_detailsQueue.empty() && (m_detailsDownloads.size() < m_maxConcurrentDownloads)) {
+        success = startActualDownloads();
+      }
+
+      if (m_detailsQueue.empty() && m_detailsDownloads.empty()) {
         m_lastDownloadDetailedResultsSuccess = true;
         emit detailedDownloadRequestsComplete(true);
         checkForRunCompleteOrStopped();
       }
       else {
-        LOG(Info,"Have " << m_detailsQueue.size() << " DataPoints' detailed results to download.");
-        success = requestNextDetailsDownload();
+        LOG(Info,"Have " << m_detailsQueue.size() + m_detailsDownloads.size() << " DataPoints' detailed results to download.");
       }
 
       if (!m_checkForResultsToDownload && !m_preDetailsQueue.empty()) {
@@ -1398,7 +1473,16 @@ namespace detail {
   }
 
   void CloudAnalysisDriver_Impl::requestDetailsRetry() {
-    bool success = requestNextDetailsDownload();
+    if (m_detailsRetries.empty()) {
+      // downloads were dropped after the retry was scheduled
+      return;
+    }
+    auto download = findDownload(m_detailsDownloads,m_detailsRetries.front());
+    m_detailsRetries.pop_front();
+    if (download == m_detailsDownloads.end()) {
+      return;
+    }
+    bool success = requestDetailsDownload(*download);
     if (!success) {
       registerDownloadingDetailsFailure();
     }
@@ -1569,9 +1653,14 @@ namespace detail {
     m_waitingQueue.clear();
     m_runningQueue.clear();
     m_jsonQueue.clear();
+    m_jsonDownloads.clear();
+    m_jsonRetries.clear();
     m_jsonFailures.clear();
+    m_numUnsavedJsonResults = 0;
     m_preDetailsQueue.clear();
     m_detailsQueue.clear();
+    m_detailsDownloads.clear();
+    m_detailsRetries.clear();
     m_detailsFailures.clear();
     m_deleteDataPointsQueue.clear();
     m_deleteDataPointFailures.clear();
@@ -1582,9 +1671,7 @@ namespace detail {
     m_maxAnalysisNotRunningCount = 0;
     m_dataPointsNotRunningCount = 0;
     m_maxDataPointsNotRunningCount = 0;
-    m_numJsonTries = 0;
     m_noNewReadyDataPointsCount = 0;
-    m_numDetailsTries = 0;
     m_numDeleteDataPointTries = 0;
     m_numDeleteProjectTries = 0;
 
@@ -1709,7 +1796,7 @@ namespace detail {
     bool success(false);
 
     if (OptionalUrl url = session().serverUrl()) {
-      m_monitorDataPoints = OSServer(*url);
+      m_monitorDataPoints = m_serverFactory(*url);
 
       bool test = m_monitorDataPoints->connect(SIGNAL(requestProcessed(bool)),this,SLOT(runningDataPointUUIDsReturned(bool)),Qt::QueuedConnection);
       OS_ASSERT(test);
@@ -1728,13 +1815,13 @@ namespace detail {
       registerMonitoringFailure();
     }
 
-    if (!m_jsonQueue.empty() && !m_requestJson) {
+    if (!m_jsonQueue.empty() && m_jsonDownloads.empty()) {
       OS_ASSERT(success);
       startDownloadingJson();
     }
 
     if (!(m_preDetailsQueue.empty() && m_detailsQueue.empty()) &&
-        !m_checkForResultsToDownload && !m_requestDetails)
+        !m_checkForResultsToDownload && m_detailsDownloads.empty())
     {
       OS_ASSERT(success);
       startDownloadingDetails();
@@ -1758,18 +1845,23 @@ namespace detail {
   }
 
   bool CloudAnalysisDriver_Impl::startDownloadingJson() {
-    OS_ASSERT(!m_requestJson);
     OS_ASSERT(!m_jsonQueue.empty());
 
     bool success(false);
 
     if (OptionalUrl url = session().serverUrl()) {
-      m_requestJson = OSServer(*url);
+      // each download in the window gets its own server, which is reused for later data points
+      success = true;
+      while (success && !m_jsonQueue.empty() && (m_jsonDownloads.size() < m_maxConcurrentDownloads)) {
+        Download download = { m_serverFactory(*url), m_jsonQueue.front(), 0u };
+        m_jsonQueue.pop_front();
 
-      bool test = m_requestJson->connect(SIGNAL(requestProcessed(bool)),this,SLOT(jsonDownloadComplete(bool)),Qt::QueuedConnection);
-      OS_ASSERT(test);
+        bool test = download.server.connect(SIGNAL(requestProcessed(bool)),this,SLOT(jsonDownloadComplete(bool)),Qt::QueuedConnection);
+        OS_ASSERT(test);
 
-      success = requestNextJsonDownload();
+        m_jsonDownloads.push_back(download);
+        success = requestJsonDownload(m_jsonDownloads.back());
+      }
     }
     else {
       logError("Cannot start download of DataPoint because the CloudSession has been terminated.");
@@ -1785,20 +1877,35 @@ namespace detail {
     return success;
   }
 
-  bool CloudAnalysisDriver_Impl::requestNextJsonDownload() {
-    OS_ASSERT(m_requestJson);
-    return m_requestJson->requestDataPointJSON(project().analysis().uuid(),
-                                               m_jsonQueue.front().uuid());
+  bool CloudAnalysisDriver_Impl::requestJsonDownload(Download& download) {
+    return download.server.requestDataPointJSON(project().analysis().uuid(),
+                                                download.dataPoint.uuid());
+  }
+
+  void CloudAnalysisDriver_Impl::saveJsonResults(bool force) {
+    if ((m_numUnsavedJsonResults > 0) &&
+        (force || m_jsonDownloads.empty() || (m_numUnsavedJsonResults >= m_maxConcurrentDownloads)))
+    {
+      project().save();
+      m_numUnsavedJsonResults = 0;
+    }
   }
 
   void CloudAnalysisDriver_Impl::registerDownloadingJsonFailure() {
-    appendErrorsAndWarnings(*m_requestJson);
-    m_requestJson.reset();
+    saveJsonResults(true);
+    // put unfinished downloads back at the front of the line, in order, for the next attempt
+    for (auto it = m_jsonDownloads.rbegin(); it != m_jsonDownloads.rend(); ++it) {
+      it->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(jsonDownloadComplete(bool)));
+      appendErrorsAndWarnings(it->server);
+      m_jsonQueue.push_front(it->dataPoint);
+    }
+    m_jsonDownloads.clear();
+    m_jsonRetries.clear();
   }
 
   bool CloudAnalysisDriver_Impl::startDownloadingDetails() {
     OS_ASSERT(!m_checkForResultsToDownload);
-    OS_ASSERT(!m_requestDetails);
+    OS_ASSERT(m_detailsDownloads.empty());
     OS_ASSERT(!(m_preDetailsQueue.empty() && m_detailsQueue.empty()));
 
     bool success(true);
@@ -1827,7 +1934,7 @@ namespace detail {
     bool success(false);
 
     if (OptionalUrl url = session().serverUrl()) {
-      m_checkForResultsToDownload = OSServer(*url);
+      m_checkForResultsToDownload = m_serverFactory(*url);
       LOG(Debug,"Spinning up process to check for data points that are ready to download.");
 
       bool test = m_checkForResultsToDownload->connect(SIGNAL(requestProcessed(bool)),this,SLOT(readyForDownloadDataPointUUIDsReturned(bool)),Qt::QueuedConnection);
@@ -1848,18 +1955,22 @@ namespace detail {
   }
 
   bool CloudAnalysisDriver_Impl::startActualDownloads() {
-    OS_ASSERT(!m_requestDetails);
     OS_ASSERT(!m_detailsQueue.empty());
 
     bool success(false);
 
     if (OptionalUrl url = session().serverUrl()) {
-      m_requestDetails = OSServer(*url);
+      success = true;
+      while (success && !m_detailsQueue.empty() && (m_detailsDownloads.size() < m_maxConcurrentDownloads)) {
+        Download download = { m_serverFactory(*url), m_detailsQueue.front(), 0u };
+        m_detailsQueue.pop_front();
 
-      bool test = m_requestDetails->connect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)),Qt::QueuedConnection);
-      OS_ASSERT(test);
+        bool test = download.server.connect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)),Qt::QueuedConnection);
+        OS_ASSERT(test);
 
-      success = requestNextDetailsDownload();
+        m_detailsDownloads.push_back(download);
+        success = requestDetailsDownload(m_detailsDownloads.back());
+      }
     }
     else {
       logError("Cannot start downloading data point details because the CloudSession has been terminated.");
@@ -1873,9 +1984,8 @@ namespace detail {
     return success;
   }
 
-  bool CloudAnalysisDriver_Impl::requestNextDetailsDownload() {
-    OS_ASSERT(m_requestDetails);
-    DataPoint needsDetails = m_detailsQueue.front();
+  bool CloudAnalysisDriver_Impl::requestDetailsDownload(Download& download) {
+    DataPoint needsDetails = download.dataPoint;
     openstudio::path dataPointFolderName = toPath("dataPoint_" + removeBraces(needsDetails.uuid()));
     if (OptionalDataPointRecord dataPointRecord = project().projectDatabase().getObjectRecordByHandle<DataPointRecord>(needsDetails.uuid())) {
       std::stringstream ss;
@@ -1895,9 +2005,9 @@ namespace detail {
     needsDetails.setDirectory(resultsDirectory);
     project().save();
     emit resultsChanged();
-    return m_requestDetails->startDownloadDataPoint(project().analysis().uuid(),
-                                                    needsDetails.uuid(),
-                                                    resultsDirectory / toPath("dataPoint.zip"));
+    return download.server.startDownloadDataPoint(project().analysis().uuid(),
+                                                  needsDetails.uuid(),
+                                                  resultsDirectory / toPath("dataPoint.zip"));
   }
 
   void CloudAnalysisDriver_Impl::registerDownloadingDetailsFailure() {
@@ -1905,10 +2015,14 @@ namespace detail {
       appendErrorsAndWarnings(*m_checkForResultsToDownload);
       m_checkForResultsToDownload.reset();
     }
-    if (m_requestDetails) {
-      appendErrorsAndWarnings(*m_requestDetails);
-      m_requestDetails.reset();
+    // put unfinished downloads back at the front of the line, in order, for the next attempt
+    for (auto it = m_detailsDownloads.rbegin(); it != m_detailsDownloads.rend(); ++it) {
+      it->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)));
+      appendErrorsAndWarnings(it->server);
+      m_detailsQueue.push_front(it->dataPoint);
     }
+    m_detailsDownloads.clear();
+    m_detailsRetries.clear();
     if (m_onlyProcessingDownloadRequests) {
       OS_ASSERT(!m_lastDownloadDetailedResultsSuccess);
       emit detailedDownloadRequestsComplete(m_lastDownloadDetailedResultsSuccess);
@@ -1926,7 +2040,7 @@ namespace detail {
   bool CloudAnalysisDriver_Impl::requestNextDataPointDeletion() {
     if (!m_requestDeleteDataPoint) {
       if (OptionalUrl url = session().serverUrl()) {
-        m_requestDeleteDataPoint = OSServer(*url);
+        m_requestDeleteDataPoint = m_serverFactory(*url);
 
         bool test = m_requestDeleteDataPoint->connect(SIGNAL(requestProcessed(bool)),
                                                       this,
@@ -1955,7 +2069,7 @@ namespace detail {
       if (OptionalUrl url = session().serverUrl()) {
         setStatus(AnalysisStatus::Stopping);
 
-        m_requestDeleteProject = OSServer(*url);
+        m_requestDeleteProject = m_serverFactory(*url);
 
         bool test = m_requestDeleteProject->connect(SIGNAL(requestProcessed(bool)),
                                                     this,
@@ -2041,6 +2155,16 @@ namespace detail {
     if (std::find(m_detailsQueue.begin(),m_detailsQueue.end(),dataPoint) != m_detailsQueue.end()) {
       return true;
     }
+    for (const Download& download : m_jsonDownloads) {
+      if (download.dataPoint == dataPoint) {
+        return true;
+      }
+    }
+    for (const Download& download : m_detailsDownloads) {
+      if (download.dataPoint == dataPoint) {
+        return true;
+      }
+    }
     return false;
   }
 
@@ -2082,6 +2206,52 @@ namespace detail {
     if (dit != m_detailsQueue.end()) {
       m_detailsQueue.erase(dit);
     }
+
+    // drop downloads in flight, and let the next data points take their places
+    auto download = findDownload(m_jsonDownloads,dataPoint.uuid());
+    if (download != m_jsonDownloads.end()) {
+      download->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(jsonDownloadComplete(bool)));
+      appendErrorsAndWarnings(download->server);
+      m_jsonDownloads.erase(download);
+      if (!m_jsonQueue.empty()) {
+        startDownloadingJson();
+      }
+      saveJsonResults(false);
+    }
+
+    download = findDownload(m_detailsDownloads,dataPoint.uuid());
+    if (download != m_detailsDownloads.end()) {
+      download->server.disconnect(SIGNAL(requestProcessed(bool)),this,SLOT(detailsDownloadComplete(bool)));
+      appendErrorsAndWarnings(download->server);
+      m_detailsDownloads.erase(download);
+      if (!m_detailsQueue.empty() && !startActualDownloads()) {
+        registerDownloadingDetailsFailure();
+      }
+    }
+  }
+
+  std::vector<CloudAnalysisDriver_Impl::Download>::iterator CloudAnalysisDriver_Impl::findSendingDownload(
+      std::vector<Download>& downloads)
+  {
+    QObject* server = sender();
+    return std::find_if(downloads.begin(),downloads.end(),[server](const Download& download) {
+      return download.server.isSender(server);
+    });
+  }
+
+  std::vector<CloudAnalysisDriver_Impl::Download>::iterator CloudAnalysisDriver_Impl::findDownload(
+      std::vector<Download>& downloads,
+      const UUID& dataPointUUID)
+  {
+    return std::find_if(downloads.begin(),downloads.end(),[&dataPointUUID](const Download& download) {
+      return (download.dataPoint.uuid() == dataPointUUID);
+    });
+  }
+
+  int CloudAnalysisDriver_Impl::statusPollDelay(unsigned backlog) const {
+    // one more second for each full window of data points waiting to be downloaded, up to 10 s
+    unsigned numWindows = backlog / m_maxConcurrentDownloads;
+    return 1000 * static_cast<int>(std::min(1u + numWindows,10u));
   }
 
   std::string CloudAnalysisDriver_Impl::sessionTag() const {
@@ -2103,7 +2273,16 @@ namespace detail {
 CloudAnalysisDriver::CloudAnalysisDriver(const CloudSession& session,
                                          const SimpleProject& project)
   : m_impl(std::shared_ptr<detail::CloudAnalysisDriver_Impl>(
-             new detail::CloudAnalysisDriver_Impl(session,project)))
+             new detail::CloudAnalysisDriver_Impl(session,
+                                                  project,
+                                                  [](const Url& url) { return OSServer(url); })))
+{}
+
+CloudAnalysisDriver::CloudAnalysisDriver(const CloudSession& session,
+                                         const SimpleProject& project,
+                                         const ServerFactory& serverFactory)
+  : m_impl(std::shared_ptr<detail::CloudAnalysisDriver_Impl>(
+             new detail::CloudAnalysisDriver_Impl(session,project,serverFactory)))
 {}
 
 CloudSession CloudAnalysisDriver::session() const {
@@ -2147,6 +2326,14 @@ bool CloudAnalysisDriver::inSession(const DataPoint& dataPoint) const {
   return getImpl<detail::CloudAnalysisDriver_Impl>()->inSession(dataPoint);
 }
 
+unsigned CloudAnalysisDriver::maxConcurrentDownloads() const {
+  return getImpl<detail::CloudAnalysisDriver_Impl>()->maxConcurrentDownloads();
+}
+
+void CloudAnalysisDriver::setMaxConcurrentDownloads(unsigned n) {
+  getImpl<detail::CloudAnalysisDriver_Impl>()->setMaxConcurrentDownloads(n);
+}
+
 bool CloudAnalysisDriver::run(int msec) {
   return getImpl<detail::CloudAnalysisDriver_Impl>()->run(msec);
 }
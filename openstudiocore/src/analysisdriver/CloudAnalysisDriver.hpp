@@ -24,15 +24,18 @@
 #include "AnalysisDriverEnums.hpp"
 
 #include "../utilities/core/Logger.hpp"
+#include "../utilities/core/Url.hpp"
 
 #include <boost/smart_ptr.hpp>
 #include <boost/optional.hpp>
 
+#include <functional>
 #include <vector>
 
 namespace openstudio {
 
 class CloudSession;
+class OSServer;
 
 namespace analysis {
   class DataPoint;
@@ -52,12 +55,22 @@ namespace detail {
  *  available, they are downloaded and re-integrated into project. */
 class ANALYSISDRIVER_API CloudAnalysisDriver {
  public:
+  /** Returns a new OSServer for the given url. CloudAnalysisDriver creates all of its servers
+   *  with one of these. */
+  typedef std::function<OSServer (const Url&)> ServerFactory;
+
   /** @name Constructors and Destructors */
   //@{
 
   CloudAnalysisDriver(const CloudSession& session,
                       const SimpleProject& project);
 
+  /** Constructor that creates servers with serverFactory rather than connecting to
+   *  session.serverUrl() directly, for instance to run against a test server. */
+  CloudAnalysisDriver(const CloudSession& session,
+                      const SimpleProject& project,
+                      const ServerFactory& serverFactory);
+
   virtual ~CloudAnalysisDriver() {}
 
   //@}
@@ -95,6 +108,19 @@ class ANALYSISDRIVER_API CloudAnalysisDriver {
    *  was with session() (not local, and not another CloudSession). */
   bool inSession(const analysis::DataPoint& dataPoint) const;
 
+  /** Returns the maximum number of results downloads (slim json or detailed results) that may
+   *  be in flight at once, for each kind. Defaults to 4. While more data points are waiting than
+   *  fit in this window, the server's status is polled less often. */
+  unsigned maxConcurrentDownloads() const;
+
+  //@}
+  /** @name Setters */
+  //@{
+
+  /** Sets maxConcurrentDownloads(). Values less than 1 are treated as 1. If downloads are in
+   *  progress, the new limit applies as they complete. */
+  void setMaxConcurrentDownloads(unsigned n);
+
   //@}
   /** @name Blocking Class Members */
   //@{
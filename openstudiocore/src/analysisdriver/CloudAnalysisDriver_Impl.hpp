@@ -23,6 +23,7 @@
 #include "AnalysisDriverAPI.hpp"
 #include "AnalysisDriverEnums.hpp"
 
+#include "CloudAnalysisDriver.hpp"
 #include "SimpleProject.hpp"
 
 #include "../analysis/DataPoint.hpp"
@@ -52,7 +53,8 @@ namespace detail {
     //@{
 
     CloudAnalysisDriver_Impl(const CloudSession& session,
-                             const SimpleProject& project);
+                             const SimpleProject& project,
+                             const CloudAnalysisDriver::ServerFactory& serverFactory);
 
     virtual ~CloudAnalysisDriver_Impl() {}
 
@@ -91,6 +93,19 @@ namespace detail {
      *  was with session() (not local, and not another CloudSession). */
     bool inSession(const analysis::DataPoint& dataPoint) const;
 
+    /** Returns the maximum number of results downloads (slim json or detailed results) that may
+     *  be in flight at once, for each kind. Defaults to 4. While more data points are waiting than
+     *  fit in this window, the server's status is polled less often. */
+    unsigned maxConcurrentDownloads() const;
+
+    //@}
+    /** @name Setters */
+    //@{
+
+    /** Sets maxConcurrentDownloads(). Values less than 1 are treated as 1. If downloads are in
+     *  progress, the new limit applies as they complete. */
+    void setMaxConcurrentDownloads(unsigned n);
+
     //@}
     /** @name Blocking Class Members */
     //@{
@@ -266,7 +281,8 @@ namespace detail {
 
      // DOWNLOADING ============================================================
 
-     // slim results received
+     // slim results received (sender is one of the m_jsonDownloads servers, found with
+     // OSServer::isSender)
      void jsonDownloadComplete(bool success);
 
      void requestJsonRetry();
@@ -276,7 +292,7 @@ namespace detail {
 
      void askForReadyForDownloadDataPointUUIDs();
 
-     // detailed results received
+     // detailed results received (sender is one of the m_detailsDownloads servers)
      void detailsDownloadComplete(bool success);
 
      void requestDetailsRetry();
@@ -315,6 +331,7 @@ namespace detail {
 
     CloudSession m_session;
     SimpleProject m_project;
+    CloudAnalysisDriver::ServerFactory m_serverFactory;
 
     bool m_lastRunSuccess;
     bool m_lastStopSuccess;
@@ -343,11 +360,20 @@ namespace detail {
     std::vector<analysis::DataPoint> m_waitingQueue;
     std::vector<analysis::DataPoint> m_runningQueue;
 
+    // results downloads are pipelined, each in flight on its own OSServer
+    struct Download {
+      OSServer server;
+      analysis::DataPoint dataPoint;
+      unsigned numTries;
+    };
+    unsigned m_maxConcurrentDownloads;
+
     // download slim data points
-    boost::optional<OSServer> m_requestJson;
-    std::deque<analysis::DataPoint> m_jsonQueue;
-    unsigned m_numJsonTries;
+    std::deque<analysis::DataPoint> m_jsonQueue; // not yet requested
+    std::vector<Download> m_jsonDownloads;       // requested, or waiting to be retried
+    std::deque<UUID> m_jsonRetries;              // m_jsonDownloads waiting to be retried, in order
     std::vector<analysis::DataPoint> m_jsonFailures;
+    unsigned m_numUnsavedJsonResults;            // incorporated, but project not yet saved
 
     // check to see if details can be downloaded
     boost::optional<OSServer> m_checkForResultsToDownload;
@@ -357,9 +383,9 @@ namespace detail {
     unsigned m_noNewReadyDataPointsCount;
 
     // download detailed results
-    boost::optional<OSServer> m_requestDetails;
-    std::deque<analysis::DataPoint> m_detailsQueue;
-    unsigned m_numDetailsTries;
+    std::deque<analysis::DataPoint> m_detailsQueue; // ready on server, not yet requested
+    std::vector<Download> m_detailsDownloads;       // requested, or waiting to be retried
+    std::deque<UUID> m_detailsRetries;              // m_detailsDownloads waiting to be retried, in order
     std::vector<analysis::DataPoint> m_detailsFailures;
 
     // stop analysis
@@ -389,16 +415,26 @@ namespace detail {
     bool startMonitoring();
     void registerMonitoringFailure();
 
+    // fill the json download window from m_jsonQueue
     bool startDownloadingJson();
-    bool requestNextJsonDownload();
+    bool requestJsonDownload(Download& download);
+    // slim results are saved in batches, once a full window's worth are in or the window is
+    // empty. force saves any that are waiting.
+    void saveJsonResults(bool force);
     void registerDownloadingJsonFailure();
 
     bool startDownloadingDetails();
     bool startDetailsReadyMonitoring();
+    // fill the details download window from m_detailsQueue
     bool startActualDownloads();
-    bool requestNextDetailsDownload();
+    bool requestDetailsDownload(Download& download);
     void registerDownloadingDetailsFailure();
 
+    // the Download in downloads whose server sent the current signal
+    std::vector<Download>::iterator findSendingDownload(std::vector<Download>& downloads);
+    std::vector<Download>::iterator findDownload(std::vector<Download>& downloads,
+                                                 const UUID& dataPointUUID);
+
     void registerStopRequestFailure();
 
     bool requestNextDataPointDeletion();
@@ -409,6 +445,10 @@ namespace detail {
 
     void checkForRunCompleteOrStopped();
 
+    // msec to wait before the next status poll, longer while backlog data points are waiting
+    // for a place in the download window
+    int statusPollDelay(unsigned backlog) const;
+
     bool inIteration(const analysis::DataPoint& dataPoint) const;
     bool inProcessingQueues(const analysis::DataPoint& dataPoint) const;
     void removeFromIteration(const analysis::DataPoint& dataPoint);
@@ -0,0 +1,188 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "AnalysisDriverFixture.hpp"
+#include "MockOSServer.hpp"
+
+#include "../SimpleProject.hpp"
+#include "../CloudAnalysisDriver.hpp"
+
+#include "../../project/ProjectDatabase.hpp"
+
+#include "../../analysis/Problem.hpp"
+#include "../../analysis/Analysis.hpp"
+#include "../../analysis/DataPoint.hpp"
+
+#include "../../model/Model.hpp"
+
+#include "../../utilities/cloud/VagrantProvider.hpp"
+#include "../../utilities/core/FileReference.hpp"
+#include "../../utilities/core/System.hpp"
+
+using namespace openstudio;
+using namespace openstudio::analysis;
+using namespace openstudio::analysisdriver;
+
+namespace {
+
+  /** Returns a project with numDataPoints complete-on-the-server data points, and fills in
+   *  state to match. */
+  SimpleProject getMockServerProject(const std::string& projectName,
+                                     unsigned numDataPoints,
+                                     MockOSServerState& state)
+  {
+    SimpleProject project = AnalysisDriverFixture::getCleanSimpleProject(projectName);
+    Analysis analysis = project.analysis();
+
+    Problem problem = AnalysisDriverFixture::retrieveProblem("Continuous",true,false);
+    analysis.setProblem(problem);
+
+    model::Model model = model::exampleModel();
+    openstudio::path p = toPath("./example.osm");
+    model.save(p,true);
+    FileReference seedModel(p);
+    analysis.setSeed(seedModel);
+
+    for (unsigned i = 0; i < numDataPoints; ++i) {
+      std::vector<QVariant> values;
+      values.push_back(QVariant(double(i)));
+      values.push_back(QVariant(double(i) / double(numDataPoints)));
+      values.push_back(QVariant(int(0)));
+      OptionalDataPoint dataPoint = problem.createDataPoint(values);
+      EXPECT_TRUE(dataPoint);
+      if (dataPoint) {
+        EXPECT_TRUE(analysis.addDataPoint(*dataPoint));
+        state.dataPointUUIDs.push_back(dataPoint->uuid());
+      }
+    }
+    project.save();
+
+    state.projectUUID = project.projectDatabase().handle();
+    state.analysisUUID = analysis.uuid();
+
+    return project;
+  }
+
+  CloudAnalysisDriver getMockServerDriver(const SimpleProject& project,
+                                          const std::shared_ptr<MockOSServerState>& state)
+  {
+    VagrantSession session(toString(createUUID()),
+                           Url("http://localhost:8080"),
+                           UrlVector(1u,Url("http://localhost:8081")));
+    return CloudAnalysisDriver(session,
+                               project,
+                               [state](const Url& url) { return OSServer(MockOSServer(state,url)); });
+  }
+
+}
+
+TEST_F(AnalysisDriverFixture,CloudAnalysisDriver_DownloadWindowLimit) {
+  std::shared_ptr<MockOSServerState> state(new MockOSServerState());
+  SimpleProject project = getMockServerProject("CloudAnalysisDriver_DownloadWindowLimit",10u,*state);
+  ASSERT_EQ(10u,state->dataPointUUIDs.size());
+
+  CloudAnalysisDriver driver = getMockServerDriver(project,state);
+  driver.setMaxConcurrentDownloads(3u);
+  EXPECT_EQ(3u,driver.maxConcurrentDownloads());
+
+  ASSERT_TRUE(driver.requestRun());
+  EXPECT_TRUE(driver.waitForFinished(60000));
+  EXPECT_TRUE(driver.lastRunSuccess());
+
+  // the window filled, but never overflowed
+  EXPECT_EQ(3u,state->maxInFlight);
+  EXPECT_EQ(0u,state->numInFlight);
+  EXPECT_EQ(10u,state->totalRequests());
+  for (const UUID& dataPointUUID : state->dataPointUUIDs) {
+    EXPECT_EQ(1u,state->numRequests[dataPointUUID]);
+  }
+  EXPECT_EQ(0u,driver.numIncompleteDataPoints());
+  EXPECT_TRUE(driver.failedJsonDownloads().empty());
+}
+
+TEST_F(AnalysisDriverFixture,CloudAnalysisDriver_DownloadRetry) {
+  std::shared_ptr<MockOSServerState> state(new MockOSServerState());
+  SimpleProject project = getMockServerProject("CloudAnalysisDriver_DownloadRetry",6u,*state);
+  ASSERT_EQ(6u,state->dataPointUUIDs.size());
+
+  // one data point recovers on retry, another never comes back
+  UUID flakyUUID = state->dataPointUUIDs[1];
+  UUID brokenUUID = state->dataPointUUIDs[4];
+  state->numFailures[flakyUUID] = 1u;
+  state->numFailures[brokenUUID] = 100u;
+
+  CloudAnalysisDriver driver = getMockServerDriver(project,state);
+  driver.setMaxConcurrentDownloads(2u);
+
+  ASSERT_TRUE(driver.requestRun());
+  EXPECT_TRUE(driver.waitForFinished(60000));
+
+  EXPECT_EQ(2u,state->numRequests[flakyUUID]);
+  EXPECT_EQ(3u,state->numRequests[brokenUUID]);
+  for (const UUID& dataPointUUID : state->dataPointUUIDs) {
+    if ((dataPointUUID != flakyUUID) && (dataPointUUID != brokenUUID)) {
+      EXPECT_EQ(1u,state->numRequests[dataPointUUID]);
+    }
+  }
+  EXPECT_LE(state->maxInFlight,2u);
+
+  // giving up on one data point does not stop the others from being downloaded
+  EXPECT_EQ(0u,driver.numIncompleteDataPoints());
+  std::vector<DataPoint> failures = driver.failedJsonDownloads();
+  ASSERT_EQ(1u,failures.size());
+  EXPECT_EQ(brokenUUID,failures[0].uuid());
+  EXPECT_FALSE(driver.errors().empty());
+}
+
+TEST_F(AnalysisDriverFixture,CloudAnalysisDriver_ShrinkingWindow) {
+  std::shared_ptr<MockOSServerState> state(new MockOSServerState());
+  state->replyDelay = 100;
+  SimpleProject project = getMockServerProject("CloudAnalysisDriver_ShrinkingWindow",12u,*state);
+  ASSERT_EQ(12u,state->dataPointUUIDs.size());
+
+  CloudAnalysisDriver driver = getMockServerDriver(project,state);
+  driver.setMaxConcurrentDownloads(4u);
+
+  ASSERT_TRUE(driver.requestRun());
+
+  // wait for the first window to go out
+  for (int i = 0; (i < 1000) && (state->totalRequests() < 4u); ++i) {
+    System::msleep(10);
+  }
+  ASSERT_GE(state->totalRequests(),4u);
+  ASSERT_LT(state->totalRequests(),12u);
+
+  driver.setMaxConcurrentDownloads(1u);
+  unsigned numRequestsBeforeShrink = state->totalRequests();
+
+  EXPECT_TRUE(driver.waitForFinished(60000));
+  EXPECT_TRUE(driver.lastRunSuccess());
+
+  // the downloads already in flight drain before any new one starts
+  EXPECT_EQ(4u,state->maxInFlight);
+  ASSERT_EQ(12u,state->totalRequests());
+  for (unsigned i = numRequestsBeforeShrink; i < state->totalRequests(); ++i) {
+    EXPECT_EQ(0u,state->numInFlightAtRequest[i]) << "Request " << i;
+  }
+  for (const UUID& dataPointUUID : state->dataPointUUIDs) {
+    EXPECT_EQ(1u,state->numRequests[dataPointUUID]);
+  }
+  EXPECT_EQ(0u,driver.numIncompleteDataPoints());
+}
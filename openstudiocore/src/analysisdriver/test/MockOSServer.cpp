@@ -0,0 +1,135 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "MockOSServer.hpp"
+
+#include <QTimer>
+
+#include <algorithm>
+
+using namespace openstudio;
+
+MockOSServerState::MockOSServerState()
+  : replyDelay(20),
+    numInFlight(0),
+    maxInFlight(0)
+{}
+
+unsigned MockOSServerState::totalRequests() const {
+  return numInFlightAtRequest.size();
+}
+
+MockOSServer_Impl::MockOSServer_Impl(const std::shared_ptr<MockOSServerState>& state,
+                                     const Url& url)
+  : OSServer_Impl(url),
+    m_state(state),
+    m_busy(false),
+    m_success(false)
+{}
+
+bool MockOSServer_Impl::lastAvailable() const {
+  return true;
+}
+
+std::vector<UUID> MockOSServer_Impl::lastProjectUUIDs() const {
+  return std::vector<UUID>(1u,m_state->projectUUID);
+}
+
+std::vector<UUID> MockOSServer_Impl::lastAnalysisUUIDs() const {
+  return std::vector<UUID>(1u,m_state->analysisUUID);
+}
+
+std::vector<UUID> MockOSServer_Impl::lastDataPointUUIDs() const {
+  return m_state->dataPointUUIDs;
+}
+
+std::vector<UUID> MockOSServer_Impl::lastCompleteDataPointUUIDs() const {
+  return m_state->dataPointUUIDs;
+}
+
+std::string MockOSServer_Impl::lastDataPointJSON() const {
+  // not a data point, so the CloudAnalysisDriver just warns that it cannot be incorporated
+  return "{}";
+}
+
+bool MockOSServer_Impl::requestAvailable() {
+  return startRequest(true);
+}
+
+bool MockOSServer_Impl::requestProjectUUIDs() {
+  return startRequest(true);
+}
+
+bool MockOSServer_Impl::requestAnalysisUUIDs(const UUID& projectUUID) {
+  return startRequest(projectUUID == m_state->projectUUID);
+}
+
+bool MockOSServer_Impl::requestDataPointUUIDs(const UUID& analysisUUID) {
+  return startRequest(analysisUUID == m_state->analysisUUID);
+}
+
+bool MockOSServer_Impl::requestCompleteDataPointUUIDs(const UUID& analysisUUID) {
+  return startRequest(analysisUUID == m_state->analysisUUID);
+}
+
+bool MockOSServer_Impl::requestDataPointJSON(const UUID& analysisUUID,
+                                             const UUID& dataPointUUID)
+{
+  // like a live OSServer, only one request at a time
+  if (m_busy || (analysisUUID != m_state->analysisUUID)) {
+    return false;
+  }
+  m_busy = true;
+
+  unsigned& numRequests = m_state->numRequests[dataPointUUID];
+  ++numRequests;
+  m_success = (numRequests > m_state->numFailures[dataPointUUID]);
+
+  m_state->numInFlightAtRequest.push_back(m_state->numInFlight);
+  ++m_state->numInFlight;
+  m_state->maxInFlight = std::max(m_state->maxInFlight,m_state->numInFlight);
+
+  QTimer::singleShot(m_state->replyDelay,this,SLOT(replyToDataPointJSON()));
+  return true;
+}
+
+void MockOSServer_Impl::reply() {
+  m_busy = false;
+  emit requestProcessed(m_success);
+}
+
+void MockOSServer_Impl::replyToDataPointJSON() {
+  --m_state->numInFlight;
+  reply();
+}
+
+bool MockOSServer_Impl::startRequest(bool success) {
+  if (m_busy) {
+    return false;
+  }
+  m_busy = true;
+  m_success = success;
+  QTimer::singleShot(0,this,SLOT(reply()));
+  return true;
+}
+
+MockOSServer::MockOSServer(const std::shared_ptr<MockOSServerState>& state,
+                           const Url& url)
+  : OSServer(std::shared_ptr<detail::OSServer_Impl>(new MockOSServer_Impl(state,url)))
+{}
@@ -0,0 +1,107 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef ANALYSISDRIVER_TEST_MOCKOSSERVER_HPP
+#define ANALYSISDRIVER_TEST_MOCKOSSERVER_HPP
+
+#include "../../utilities/cloud/OSServer.hpp"
+#include "../../utilities/cloud/OSServer_Impl.hpp"
+
+#include <map>
+#include <memory>
+#include <vector>
+
+/** State shared by all of the MockOSServers a CloudAnalysisDriver creates. The server reports
+ *  that it has the project, the analysis and all of dataPointUUIDs, and that they are all
+ *  complete, so a run goes straight to downloading slim results. */
+struct MockOSServerState {
+  MockOSServerState();
+
+  openstudio::UUID projectUUID;
+  openstudio::UUID analysisUUID;
+  std::vector<openstudio::UUID> dataPointUUIDs;
+
+  /// msec before each data point json request is answered
+  int replyDelay;
+
+  /// number of times each data point's json request fails before it succeeds
+  std::map<openstudio::UUID,unsigned> numFailures;
+
+  /// number of json requests made for each data point
+  std::map<openstudio::UUID,unsigned> numRequests;
+
+  /// json requests made and not yet answered
+  unsigned numInFlight;
+
+  /// largest numInFlight so far
+  unsigned maxInFlight;
+
+  /// numInFlight when each json request was made, not counting that request, in request order
+  std::vector<unsigned> numInFlightAtRequest;
+
+  unsigned totalRequests() const;
+};
+
+/** OSServer_Impl that answers from a MockOSServerState instead of a live server. */
+class MockOSServer_Impl : public openstudio::detail::OSServer_Impl {
+  Q_OBJECT;
+ public:
+  MockOSServer_Impl(const std::shared_ptr<MockOSServerState>& state,
+                    const openstudio::Url& url);
+
+  virtual ~MockOSServer_Impl() {}
+
+  virtual bool lastAvailable() const;
+  virtual std::vector<openstudio::UUID> lastProjectUUIDs() const;
+  virtual std::vector<openstudio::UUID> lastAnalysisUUIDs() const;
+  virtual std::vector<openstudio::UUID> lastDataPointUUIDs() const;
+  virtual std::vector<openstudio::UUID> lastCompleteDataPointUUIDs() const;
+  virtual std::string lastDataPointJSON() const;
+
+  virtual bool requestAvailable();
+  virtual bool requestProjectUUIDs();
+  virtual bool requestAnalysisUUIDs(const openstudio::UUID& projectUUID);
+  virtual bool requestDataPointUUIDs(const openstudio::UUID& analysisUUID);
+  virtual bool requestCompleteDataPointUUIDs(const openstudio::UUID& analysisUUID);
+  virtual bool requestDataPointJSON(const openstudio::UUID& analysisUUID,
+                                    const openstudio::UUID& dataPointUUID);
+
+ private slots:
+  void reply();
+
+  void replyToDataPointJSON();
+
+ private:
+  std::shared_ptr<MockOSServerState> m_state;
+  bool m_busy;
+  bool m_success;
+
+  bool startRequest(bool success);
+};
+
+/** OSServer with a MockOSServer_Impl. For use in a CloudAnalysisDriver::ServerFactory. */
+class MockOSServer : public openstudio::OSServer {
+ public:
+  MockOSServer(const std::shared_ptr<MockOSServerState>& state,
+               const openstudio::Url& url);
+
+  virtual ~MockOSServer() {}
+};
+
+#endif // ANALYSISDRIVER_TEST_MOCKOSSERVER_HPP
@@ -71,6 +71,7 @@
 #include <QFile>
 #include <QTextStream>
 #include <QThread>
+#include <QtConcurrentMap>
 
 #include <sstream>
 
@@ -82,6 +83,20 @@ namespace openstudio {
 
 namespace energyplus {
 
+namespace detail {
+
+  // a contiguous range of independent objects and the results of translating them
+  struct ParallelTranslationChunk {
+    std::vector<ModelObject> modelObjects;
+    // translations of the objects modelObjects may reference, shared with the other chunks
+    std::vector<std::pair<Handle, IdfObject> > dependencies;
+    std::vector<IdfObject> idfObjects;
+    std::vector<std::pair<Handle, IdfObject> > mappedObjects;
+    std::vector<LogMessage> logMessages;
+  };
+
+}
+
 ForwardTranslator::ForwardTranslator()
 {
   m_logSink.setLogLevel(Warn);
@@ -93,11 +108,15 @@ ForwardTranslator::ForwardTranslator()
   m_keepRunControlSpecialDays = false;
   m_ipTabularOutput = false;
   m_excludeLCCObjects = false;
+  m_parallelTranslation = false;
+  m_numIndexedIdfObjects = 0;
 }
 
 Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* progressBar )
 {
-  Model modelCopy = model.clone().cast<Model>();
+  // modelCopy is private to this translation, so it can keep model's handles and share the
+  // field values of every object the translation does not modify
+  Model modelCopy = model.clone(true).cast<Model>();
 
   m_progressBar = progressBar;
   if (m_progressBar){
@@ -160,6 +179,11 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
   m_excludeLCCObjects = excludeLCCObjects;
 }
 
+void ForwardTranslator::setParallelTranslation(bool parallelTranslation)
+{
+  m_parallelTranslation = parallelTranslation;
+}
+
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
 {
   reset();
@@ -2073,23 +2097,39 @@ std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslateInitializer()
 
 void ForwardTranslator::translateConstructions(const model::Model & model)
 {
+  // materials do not reference other model objects
+  std::vector<IddObjectType> materialTypes;
+  materialTypes.push_back(IddObjectType::OS_Material);
+  materialTypes.push_back(IddObjectType::OS_Material_AirGap);
+  materialTypes.push_back(IddObjectType::OS_Material_AirWall);
+  materialTypes.push_back(IddObjectType::OS_Material_InfraredTransparent);
+  materialTypes.push_back(IddObjectType::OS_Material_NoMass);
+  materialTypes.push_back(IddObjectType::OS_Material_RoofVegetation);
+
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_Blind);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_Gas);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_GasMixture);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_Glazing);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_Screen);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_Shade);
+  materialTypes.push_back(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem);
+
+  std::vector<ModelObject> materials;
+  for (const IddObjectType& iddObjectType : materialTypes){
+
+    // get objects by type in sorted order
+    std::vector<WorkspaceObject> objects = model.getObjectsByType(iddObjectType);
+    std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+
+    for (const WorkspaceObject& workspaceObject : objects){
+      materials.push_back(workspaceObject.cast<ModelObject>());
+    }
+  }
+  translateIndependentObjects(materials);
+
   std::vector<IddObjectType> iddObjectTypes;
-  iddObjectTypes.push_back(IddObjectType::OS_Material);
-  iddObjectTypes.push_back(IddObjectType::OS_Material_AirGap);
-  iddObjectTypes.push_back(IddObjectType::OS_Material_AirWall);
-  iddObjectTypes.push_back(IddObjectType::OS_Material_InfraredTransparent);
-  iddObjectTypes.push_back(IddObjectType::OS_Material_NoMass);
-  iddObjectTypes.push_back(IddObjectType::OS_Material_RoofVegetation);
-
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_Blind);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_Gas);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_GasMixture);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_Glazing);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_GlazingGroup_Thermochromic);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_Screen);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_Shade);
-  iddObjectTypes.push_back(IddObjectType::OS_WindowMaterial_SimpleGlazingSystem);
   iddObjectTypes.push_back(IddObjectType::OS_ShadingControl);
 
   iddObjectTypes.push_back(IddObjectType::OS_Construction);
@@ -2133,9 +2173,11 @@ void ForwardTranslator::translateSchedules(const model::Model & model)
   // loop over schedule type limits
   std::vector<WorkspaceObject> objects = model.getObjectsByType(IddObjectType::OS_ScheduleTypeLimits);
   std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+  std::vector<ModelObject> scheduleTypeLimits;
   for (const WorkspaceObject& workspaceObject : objects){
     model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
     translateAndMapModelObject(modelObject);
+    scheduleTypeLimits.push_back(modelObject);
   }
 
   // now loop over all schedule types
@@ -2149,7 +2191,18 @@ void ForwardTranslator::translateSchedules(const model::Model & model)
   iddObjectTypes.push_back(IddObjectType::OS_Schedule_FixedInterval);
   iddObjectTypes.push_back(IddObjectType::OS_Schedule_VariableInterval);
 
+  // compact, constant and interval schedules reference nothing but their schedule type limits, 
+  // consecutive runs of them are translated together so that they can be split up between threads
+  std::vector<ModelObject> independentSchedules;
   for (const IddObjectType& iddObjectType : iddObjectTypes){
+    bool independent = ((iddObjectType == IddObjectType::OS_Schedule_Compact) ||
+                        (iddObjectType == IddObjectType::OS_Schedule_Constant) ||
+                        (iddObjectType == IddObjectType::OS_Schedule_FixedInterval) ||
+                        (iddObjectType == IddObjectType::OS_Schedule_VariableInterval));
+    if (!independent){
+      translateIndependentObjects(independentSchedules, scheduleTypeLimits);
+      independentSchedules.clear();
+    }
     
     // get objects by type in sorted order
     objects = model.getObjectsByType(iddObjectType);
@@ -2157,29 +2210,138 @@ void ForwardTranslator::translateSchedules(const model::Model & model)
 
     for (const WorkspaceObject& workspaceObject : objects){
       model::ModelObject modelObject = workspaceObject.cast<ModelObject>();
-      boost::optional<IdfObject> result = translateAndMapModelObject(modelObject);
-
-      if ((iddObjectType == IddObjectType::OS_Schedule_Compact) ||
-          (iddObjectType == IddObjectType::OS_Schedule_Constant) ||
-          (iddObjectType == IddObjectType::OS_Schedule_Ruleset) ||
-          (iddObjectType == IddObjectType::OS_Schedule_FixedInterval) ||
-          (iddObjectType == IddObjectType::OS_Schedule_VariableInterval)){
-        if (istringEqual("Always_On", workspaceObject.name().get())){
-          m_alwaysOnSchedule = result;
-        }
+      if (independent){
+        independentSchedules.push_back(modelObject);
+      }else{
+        translateAndMapModelObject(modelObject);
+      }
+    }
+  }
+  translateIndependentObjects(independentSchedules, scheduleTypeLimits);
 
-        if (istringEqual("Always_Off", workspaceObject.name().get())){
-          m_alwaysOffSchedule = result;
+  // find the always on and always off schedules
+  for (const IddObjectType& iddObjectType : iddObjectTypes){
+    if ((iddObjectType == IddObjectType::OS_Schedule_Compact) ||
+        (iddObjectType == IddObjectType::OS_Schedule_Constant) ||
+        (iddObjectType == IddObjectType::OS_Schedule_Ruleset) ||
+        (iddObjectType == IddObjectType::OS_Schedule_FixedInterval) ||
+        (iddObjectType == IddObjectType::OS_Schedule_VariableInterval)){
+
+      objects = model.getObjectsByType(iddObjectType);
+      std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
+
+      for (const WorkspaceObject& workspaceObject : objects){
+        bool alwaysOn = istringEqual("Always_On", workspaceObject.name().get());
+        bool alwaysOff = istringEqual("Always_Off", workspaceObject.name().get());
+        if (alwaysOn || alwaysOff){
+          boost::optional<IdfObject> result;
+          ModelObjectMap::const_iterator it = m_map.find(workspaceObject.handle());
+          if (it != m_map.end()){
+            result = it->second;
+          }
+          if (alwaysOn){
+            m_alwaysOnSchedule = result;
+          }
+          if (alwaysOff){
+            m_alwaysOffSchedule = result;
+          }
         }
       }
     }
   }
 }
 
+void ForwardTranslator::translateIndependentObjects(std::vector<model::ModelObject> & modelObjects,
+                                                    const std::vector<model::ModelObject> & dependencies)
+{
+  // skip objects that have already been translated, as translateAndMapModelObject does
+  std::vector<ModelObject> toTranslate;
+  for (const ModelObject& modelObject : modelObjects){
+    if (m_map.find(modelObject.handle()) == m_map.end()){
+      toTranslate.push_back(modelObject);
+    }
+  }
+
+  // each chunk needs its own translator, so only split up reasonably large sets of objects
+  const unsigned minChunkSize = 16;
+  unsigned numThreads = std::max(QThread::idealThreadCount(), 1);
+  unsigned numChunks = std::min<unsigned>(numThreads, toTranslate.size() / minChunkSize);
+  if (!m_parallelTranslation || (numChunks < 2)){
+    for (ModelObject& modelObject : modelObjects){
+      translateAndMapModelObject(modelObject);
+    }
+    return;
+  }
+
+  // chunk translators look dependencies up instead of translating them again
+  std::vector<std::pair<Handle, IdfObject> > translatedDependencies;
+  for (const ModelObject& dependency : dependencies){
+    ModelObjectMap::const_iterator it = m_map.find(dependency.handle());
+    if (it != m_map.end()){
+      translatedDependencies.push_back(*it);
+    }
+  }
+
+  std::vector<detail::ParallelTranslationChunk> chunks(numChunks);
+  for (unsigned i = 0, n = toTranslate.size(); i < n; ++i){
+    chunks[(i * numChunks) / n].modelObjects.push_back(toTranslate[i]);
+  }
+  for (detail::ParallelTranslationChunk& chunk : chunks){
+    chunk.dependencies = translatedDependencies;
+  }
+
+  QtConcurrent::blockingMap(chunks, &ForwardTranslator::translateParallelChunk);
+
+  // chunks are contiguous ranges of toTranslate, so appending them in order gives the same 
+  // m_idfObjects as serial translation, messages are logged again on this thread so that 
+  // m_logSink and all other sinks see them once and in the serial order
+  for (const detail::ParallelTranslationChunk& chunk : chunks){
+    m_idfObjects.insert(m_idfObjects.end(), chunk.idfObjects.begin(), chunk.idfObjects.end());
+    m_map.insert(chunk.mappedObjects.begin(), chunk.mappedObjects.end());
+    for (const LogMessage& logMessage : chunk.logMessages){
+      logFree(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
+    }
+  }
+
+  if (m_progressBar){
+    m_progressBar->setValue(m_map.size());
+  }
+}
+
+void ForwardTranslator::translateParallelChunk(detail::ParallelTranslationChunk & chunk)
+{
+  // messages are held back from all sinks and logged by the calling translator after the map, 
+  // QtConcurrent may run some chunks on the calling thread where its m_logSink would also see them
+  Logger::instance().beginCapture();
+
+  {
+    ForwardTranslator translator;
+    translator.m_progressBar = nullptr;
+    translator.reset();
+    translator.m_map.insert(chunk.dependencies.begin(), chunk.dependencies.end());
+
+    for (ModelObject& modelObject : chunk.modelObjects){
+      translator.translateAndMapModelObject(modelObject);
+    }
+
+    for (const std::pair<Handle, IdfObject>& dependency : chunk.dependencies){
+      translator.m_map.erase(dependency.first);
+    }
+    chunk.idfObjects.swap(translator.m_idfObjects);
+    chunk.mappedObjects.assign(translator.m_map.begin(), translator.m_map.end());
+  }
+
+  chunk.logMessages = Logger::instance().endCapture();
+}
+
 void ForwardTranslator::reset()
 {
   m_idfObjects.clear();
 
+  m_idfObjectTypeIndex.clear();
+
+  m_numIndexedIdfObjects = 0;
+
   m_map.clear();
 
   m_anyNumberScheduleTypeLimits.reset();
@@ -2638,14 +2800,8 @@ void ForwardTranslator::createStandardOutputRequests()
   m_idfObjects.push_back(sqliteOutput);
 
   // ensure at least one life cycle cost exists to prevent crash in E+ 8
-  unsigned numCosts = 0;
-  for (const IdfObject& object : m_idfObjects){
-    if (object.iddObject().type() == openstudio::IddObjectType::LifeCycleCost_NonrecurringCost){
-      numCosts += 1;
-    }else if (object.iddObject().type() == openstudio::IddObjectType::LifeCycleCost_RecurringCosts){
-      numCosts += 1;
-    }
-  }
+  unsigned numCosts = idfObjectsByType(openstudio::IddObjectType::LifeCycleCost_NonrecurringCost).size();
+  numCosts += idfObjectsByType(openstudio::IddObjectType::LifeCycleCost_RecurringCosts).size();
   if (numCosts == 0){
     // add default cost
     IdfObject idfObject(openstudio::IddObjectType::LifeCycleCost_NonrecurringCost);
@@ -2678,6 +2834,60 @@ IdfObject ForwardTranslator::createRegisterAndNameIdfObject(const IddObjectType&
   return idfObject;
 }
 
+std::vector<IdfObject> ForwardTranslator::idfObjectsByType(const IddObjectType& iddObjectType)
+{
+  indexIdfObjects();
+
+  std::vector<IdfObject> result;
+  auto it = m_idfObjectTypeIndex.find(iddObjectType);
+  if (it != m_idfObjectTypeIndex.end()){
+    for (unsigned position : it->second){
+      result.push_back(m_idfObjects[position]);
+    }
+  }
+  return result;
+}
+
+boost::optional<IdfObject> ForwardTranslator::findIdfObject(const IddObjectType& iddObjectType,
+                                                            unsigned index,
+                                                            const std::string& value)
+{
+  indexIdfObjects();
+
+  auto it = m_idfObjectTypeIndex.find(iddObjectType);
+  if (it != m_idfObjectTypeIndex.end()){
+    for (unsigned position : it->second){
+      const IdfObject& idfObject = m_idfObjects[position];
+      OptionalString s = idfObject.getString(index,true);
+      if (s && istringEqual(*s, value)){
+        return idfObject;
+      }
+    }
+  }
+  return boost::none;
+}
+
+void ForwardTranslator::indexIdfObjects()
+{
+  // m_idfObjects is only appended to, apart from translators that pop_back an object they just 
+  // added; start over if the last indexed object is no longer where it was
+  unsigned n = m_idfObjects.size();
+  if ((m_numIndexedIdfObjects > n) || 
+      ((m_numIndexedIdfObjects > 0) && (m_idfObjects[m_numIndexedIdfObjects - 1].handle() != m_lastIndexedIdfObject)))
+  {
+    m_idfObjectTypeIndex.clear();
+    m_numIndexedIdfObjects = 0;
+  }
+
+  for (unsigned i = m_numIndexedIdfObjects; i < n; ++i){
+    m_idfObjectTypeIndex[m_idfObjects[i].iddObject().type()].push_back(i);
+  }
+  m_numIndexedIdfObjects = n;
+  if (n > 0){
+    m_lastIndexedIdfObject = m_idfObjects[n - 1].handle();
+  }
+}
+
 boost::optional<IdfFile> ForwardTranslator::findIdfFile(const std::string& path) {
   QFile file(QString().fromStdString(path));
   bool opened = file.open(QIODevice::ReadOnly | QIODevice::Text);
@@ -2731,15 +2941,11 @@ boost::optional<IdfObject> ForwardTranslator::createFluidProperties(const std::s
   sstm << glycolType << "_" << glycolConcentration;
   std::string glycolName = sstm.str();
 
-  for( auto it = m_idfObjects.begin();
-     it != m_idfObjects.end();
-     ++it )
+  if (boost::optional<IdfObject> existing = findIdfObject(openstudio::IddObjectType::FluidProperties_Name, 
+                                                          FluidProperties_NameFields::FluidName, 
+                                                          glycolName))
   {
-    if(it->iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name) {
-      if(istringEqual(it->getString(FluidProperties_NameFields::FluidName,true).get(), glycolName)) {
-        return *it;
-      }
-    }
+    return existing;
   }
 
   IdfObject fluidPropName(openstudio::IddObjectType::FluidProperties_Name);
@@ -2770,15 +2976,11 @@ boost::optional<IdfObject> ForwardTranslator::createFluidProperties(const std::s
   boost::optional<IdfObject> idfObject;
   boost::optional<IdfFile> idfFile;
 
-  for( auto it = m_idfObjects.begin();
-     it != m_idfObjects.end();
-     ++it )
+  if (boost::optional<IdfObject> existing = findIdfObject(openstudio::IddObjectType::FluidProperties_Name, 
+                                                          FluidProperties_NameFields::FluidName, 
+                                                          fluidType))
   {
-    if(it->iddObject().type().value() == openstudio::IddObjectType::FluidProperties_Name) {
-      if(istringEqual(it->getString(FluidProperties_NameFields::FluidName,true).get(), fluidType)) {
-        return *it;
-      }
-    }
+    return existing;
   }
 
   FluidPropertiesMap::const_iterator objInMap = m_fluidPropertiesMap.find( fluidType );
@@ -257,6 +257,7 @@ namespace energyplus {
 namespace detail
 {
   struct ForwardTranslatorInitializer;
+  struct ParallelTranslationChunk;
 };
 
 #define ENERGYPLUS_VERSION "8.2"
@@ -298,6 +299,13 @@ class ENERGYPLUS_API ForwardTranslator {
     */
   void setExcludeLCCObjects(bool excludeLCCObjects);
 
+  /** If parallelTranslation, objects that do not depend on any other model object (currently 
+    * materials, and compact, constant and interval schedules, which only depend on their schedule
+    * type limits) are translated on worker threads. The resulting Workspace
+    * is identical to the one produced by serial translation. Defaults to false.
+   */
+  void setParallelTranslation(bool parallelTranslation);
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -769,6 +777,15 @@ class ENERGYPLUS_API ForwardTranslator {
   // translate all schedules and find always on and always off schedules if they exist
   void translateSchedules(const model::Model & model);
 
+  // translate objects that do not reference other model objects, except for already translated 
+  // dependencies, on worker threads if m_parallelTranslation; results are added to m_idfObjects 
+  // and m_map in the order of modelObjects
+  void translateIndependentObjects(std::vector<model::ModelObject> & modelObjects,
+                                   const std::vector<model::ModelObject> & dependencies = std::vector<model::ModelObject>());
+
+  // translate one chunk of independent objects with a separate translator, called on a worker thread
+  static void translateParallelChunk(detail::ParallelTranslationChunk & chunk);
+
   // returns the always on schedule if found, otherwise creates one and saves for later
   IdfObject alwaysOnSchedule();
   boost::optional<IdfObject> m_alwaysOnSchedule;
@@ -803,6 +820,20 @@ class ENERGYPLUS_API ForwardTranslator {
   IdfObject createRegisterAndNameIdfObject(const IddObjectType& idfObjectType,
                                            const model::ModelObject& modelObject);
 
+  /** Returns the objects of type iddObjectType in m_idfObjects, in the order they were added. Uses
+   *  m_idfObjectTypeIndex rather than scanning m_idfObjects. */
+  std::vector<IdfObject> idfObjectsByType(const IddObjectType& iddObjectType);
+
+  /** Returns the first object of type iddObjectType in m_idfObjects whose field index is equal to 
+   *  value, ignoring case. Only objects of that type are examined, because translators often set
+   *  names after adding objects to m_idfObjects. */
+  boost::optional<IdfObject> findIdfObject(const IddObjectType& iddObjectType,
+                                           unsigned index,
+                                           const std::string& value);
+
+  // brings m_idfObjectTypeIndex up to date with m_idfObjects
+  void indexIdfObjects();
+
   static std::vector<IddObjectType> iddObjectsToTranslate();
   static std::vector<IddObjectType> iddObjectsToTranslateInitializer();
 
@@ -856,6 +887,13 @@ class ENERGYPLUS_API ForwardTranslator {
 
   std::vector<IdfObject> m_idfObjects;
 
+  // positions in m_idfObjects by object type, covering the first m_numIndexedIdfObjects objects
+  std::map<IddObjectType, std::vector<unsigned> > m_idfObjectTypeIndex;
+
+  unsigned m_numIndexedIdfObjects;
+
+  Handle m_lastIndexedIdfObject;
+
   boost::optional<IdfObject> m_anyNumberScheduleTypeLimits;
 
   StringStreamLogSink m_logSink;
@@ -870,6 +908,8 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_ipTabularOutput;
 
   bool m_excludeLCCObjects;
+
+  bool m_parallelTranslation;
 };
 
 namespace detail
@@ -0,0 +1,116 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "EnergyPlusFixture.hpp"
+
+#include "../ForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/ScheduleCompact.hpp"
+#include "../../model/ScheduleFixedInterval.hpp"
+#include "../../model/ScheduleTypeLimits.hpp"
+
+#include "../../utilities/idf/Workspace.hpp"
+#include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/time/Date.hpp"
+#include "../../utilities/time/Time.hpp"
+
+#include <QElapsedTimer>
+
+#include <sstream>
+
+using namespace openstudio::energyplus;
+using namespace openstudio::model;
+using namespace openstudio;
+
+namespace {
+
+  // logs the time to translate model serially and in parallel
+  void timeTranslation(const Model& model, const std::string& description)
+  {
+    QElapsedTimer timer;
+
+    ForwardTranslator serialTranslator;
+    timer.start();
+    Workspace serialWorkspace = serialTranslator.translateModel(model);
+    qint64 serialTime = timer.elapsed();
+
+    ForwardTranslator parallelTranslator;
+    parallelTranslator.setParallelTranslation(true);
+    timer.restart();
+    Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+    qint64 parallelTime = timer.elapsed();
+
+    LOG_FREE(Info, "ForwardTranslatorPerformance", "Translated " << description << " with "
+        << serialWorkspace.objects().size() << " objects serially in " << serialTime 
+        << "ms, in parallel in " << parallelTime << "ms.");
+  }
+
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorPerformance_ExampleModel)
+{
+  Model model = exampleModel();
+
+  timeTranslation(model, "the example model");
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorPerformance_Schedules)
+{
+  Model model = exampleModel();
+
+  ScheduleTypeLimits limits(model);
+  limits.setName("Performance Limits");
+  limits.setNumericType("Continuous");
+
+  // hourly schedules are the most expensive objects translated in parallel
+  Vector values(8760);
+  for (unsigned i = 0; i < values.size(); ++i){
+    values[i] = 0.5 * (i % 24);
+  }
+  TimeSeries timeSeries(Date(MonthOfYear::Jan, 1), Time(0, 0, 60), values, "");
+
+  unsigned numIntervalSchedules = 50;
+  for (unsigned i = 0; i < numIntervalSchedules; ++i) {
+    ScheduleFixedInterval schedule(model);
+    schedule.setName("Performance Interval Schedule " + QString::number(i).toStdString());
+    schedule.setTimeSeries(timeSeries);
+    schedule.setScheduleTypeLimits(limits);
+  }
+
+  unsigned numCompactSchedules = 500;
+  for (unsigned i = 0; i < numCompactSchedules; ++i) {
+    ScheduleCompact schedule(model, 0.001*i);
+    schedule.setName("Performance Compact Schedule " + QString::number(i).toStdString());
+    schedule.setScheduleTypeLimits(limits);
+  }
+
+  unsigned numMaterials = 2000;
+  for (unsigned i = 0; i < numMaterials; ++i) {
+    StandardOpaqueMaterial material(model, "Smooth", 0.01 + 0.0001*i);
+    material.setName("Performance Material " + QString::number(i).toStdString());
+  }
+
+  std::stringstream ss;
+  ss << "the example model with " << numIntervalSchedules << " extra hourly schedules, " 
+     << numCompactSchedules << " extra compact schedules and " << numMaterials << " extra materials";
+  timeTranslation(model, ss.str());
+}
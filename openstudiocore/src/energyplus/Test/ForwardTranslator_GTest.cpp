@@ -47,7 +47,11 @@
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/ScheduleTypeLimits.hpp"
+#include "../../model/ScheduleFixedInterval.hpp"
 #include "../../model/Construction.hpp"
+#include "../../model/RefrigerationCase.hpp"
+#include "../../model/RefrigerationSystem.hpp"
 #include "../../model/Version.hpp"
 #include "../../model/Version_Impl.hpp"
 
@@ -56,11 +60,16 @@
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/sql/SqlFile.hpp"
+#include "../../utilities/data/TimeSeries.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/IdfObject.hpp"
+#include "../../utilities/idf/Workspace.hpp"
+#include "../../utilities/idf/WorkspaceObject.hpp"
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/OS_Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
+#include <utilities/idd/FluidProperties_Name_FieldEnums.hxx>
+#include <utilities/idd/Refrigeration_System_FieldEnums.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
@@ -586,3 +595,99 @@ TEST_F(EnergyPlusFixture, ForwardTranslatorTest_MultiThreadedLogMessages) {
     EXPECT_EQ(numWarnings, thread4.translator.warnings().size());
   }
 }
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorTest_ParallelTranslation) {
+  Model model = exampleModel();
+
+  // enough materials to be split up between worker threads
+  for (unsigned i = 0; i < 100; ++i) {
+    StandardOpaqueMaterial material(model, "Smooth", 0.01 + 0.001*i);
+    material.setName("Material " + QString::number(i).toStdString());
+  }
+
+  // unit types that EnergyPlus does not support all translate to a single 'Any Number' limits
+  std::vector<std::string> unitTypes;
+  unitTypes.push_back("Temperature");
+  unitTypes.push_back("Pressure");
+  unitTypes.push_back("MassFlowRate");
+  unitTypes.push_back("RotationsPerMinute");
+  std::vector<ScheduleTypeLimits> scheduleTypeLimits;
+  for (unsigned i = 0; i < 20; ++i) {
+    ScheduleTypeLimits limits(model);
+    limits.setName("Limits " + QString::number(i).toStdString());
+    EXPECT_TRUE(limits.setUnitType(unitTypes[i % unitTypes.size()]));
+    scheduleTypeLimits.push_back(limits);
+  }
+
+  // schedules that reference those limits are split up between worker threads too
+  Vector values(168);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values[i] = 0.5 * (i % 24);
+  }
+  TimeSeries timeSeries(Date(MonthOfYear::Jan, 1), Time(0, 0, 60), values, "");
+  for (unsigned i = 0; i < 40; ++i) {
+    ScheduleFixedInterval intervalSchedule(model);
+    intervalSchedule.setName("Interval Schedule " + QString::number(i).toStdString());
+    EXPECT_TRUE(intervalSchedule.setTimeSeries(timeSeries));
+    EXPECT_TRUE(intervalSchedule.setScheduleTypeLimits(scheduleTypeLimits[i % scheduleTypeLimits.size()]));
+
+    ScheduleCompact compactSchedule(model, 0.1*i);
+    compactSchedule.setName("Compact Schedule " + QString::number(i).toStdString());
+    EXPECT_TRUE(compactSchedule.setScheduleTypeLimits(scheduleTypeLimits[i % scheduleTypeLimits.size()]));
+  }
+
+  ForwardTranslator serialTranslator;
+  Workspace serialWorkspace = serialTranslator.translateModel(model);
+
+  ForwardTranslator parallelTranslator;
+  parallelTranslator.setParallelTranslation(true);
+  Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+
+  unsigned numAnyNumber = 0;
+  for (const WorkspaceObject& limits : parallelWorkspace.getObjectsByType(IddObjectType::ScheduleTypeLimits)) {
+    if (limits.name() && (limits.name().get() == "Any Number")) {
+      ++numAnyNumber;
+    }
+  }
+  EXPECT_EQ(1u, numAnyNumber);
+
+  EXPECT_EQ(model.getObjectsByType(IddObjectType::OS_Material).size(),
+            parallelWorkspace.getObjectsByType(IddObjectType::Material).size());
+  EXPECT_EQ(serialTranslator.warnings().size(), parallelTranslator.warnings().size());
+  EXPECT_EQ(serialTranslator.errors().size(), parallelTranslator.errors().size());
+
+  // the produced idf text is identical
+  std::stringstream serialIdf, parallelIdf;
+  serialIdf << serialWorkspace;
+  parallelIdf << parallelWorkspace;
+  EXPECT_TRUE(serialIdf.str() == parallelIdf.str());
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslatorTest_SharedFluidProperties) {
+  Model model;
+  ScheduleCompact defrostSchedule(model);
+
+  // two systems with the same working fluid share one set of fluid properties
+  for (unsigned i = 0; i < 2; ++i) {
+    RefrigerationSystem system(model);
+    EXPECT_TRUE(system.setRefrigerationSystemWorkingFluidType("R410a"));
+    RefrigerationCase refrigerationCase(model, defrostSchedule);
+    EXPECT_TRUE(system.addCase(refrigerationCase));
+  }
+
+  ForwardTranslator translator;
+  Workspace workspace = translator.translateModel(model);
+
+  std::vector<WorkspaceObject> fluidNames = workspace.getObjectsByType(IddObjectType::FluidProperties_Name);
+  ASSERT_EQ(1u, fluidNames.size());
+  EXPECT_EQ("R410a", fluidNames[0].getString(FluidProperties_NameFields::FluidName).get());
+
+  std::vector<WorkspaceObject> systems = workspace.getObjectsByType(IddObjectType::Refrigeration_System);
+  ASSERT_EQ(2u, systems.size());
+  for (const WorkspaceObject& system : systems) {
+    EXPECT_EQ("R410a", system.getString(Refrigeration_SystemFields::RefrigerationSystemWorkingFluidType).get());
+  }
+
+  // a default life cycle cost is only added when there are none
+  EXPECT_EQ(1u, workspace.getObjectsByType(IddObjectType::LifeCycleCost_NonrecurringCost).size());
+}
@@ -270,6 +270,8 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     cxxFile->tempFile
       << "#include <utilities/idd/IddFactory.hxx>" << std::endl
       << "#include <utilities/idd/IddEnums.hxx>" << std::endl
+      << "#include <utilities/idd/IddFieldProperties.hpp>" << std::endl
+      << "#include <utilities/idd/IddObjectTable.hpp>" << std::endl
       << std::endl
       << "#include <utilities/core/Assert.hpp>" << std::endl
       << "#include <utilities/core/Compare.hpp>" << std::endl
@@ -19,6 +19,7 @@
 
 #include "IddFileFactoryData.hpp"
 #include "WriteEnums.hpp"
+#include "WriteIddTables.hpp"
 
 #include "../utilities/idd/IddRegex.hpp"
 
@@ -181,16 +182,9 @@ void IddFileFactoryData::parseFile(const path& outPath,
     objectName.first = m_convertName(objectName.second);
     m_objectNames.push_back(objectName);    
 
-    // start writing create function
-    cxxFile->tempFile
-      << std::endl
-      << "IddObject create" << objectName.first << "IddObject() {" << std::endl
-      << std::endl
-      << "  static IddObject object;" << std::endl
-      << std::endl
-      << "  if (object.type() == IddObjectType::Catchall) {" << std::endl
-      << "    std::stringstream ss;" << std::endl
-      << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+    // start collecting object text, exactly as IddObject::load would see it
+    std::string objectText = trimLine + "\n";
+    std::vector<std::string> objectLines(1u,m_readyLineForOutput(line));
 
     // start collecting field names
     // (requires \field tag, which is expected to occur one per line)
@@ -201,18 +195,58 @@ void IddFileFactoryData::parseFile(const path& outPath,
     while (std::getline(iddFile,line)) {
       ++lineNum; trimLine = line; boost::trim(trimLine);
       if (trimLine.empty()) { 
-        // finish writing create function
+        // write create function. the object is parsed here, once, and written out as static
+        // tables. if that fails, fall back on parsing the text at run time.
+        std::stringstream tables;
+        try {
+          writeIddObjectTable(tables,objectName.second,group,objectText);
+        }
+        catch (std::exception& e) {
+          std::cerr << "Unable to pre-parse " << objectName.second << ", its text will be parsed at "
+                    << "run time instead: " << e.what() << std::endl << std::endl;
+          tables.str("");
+        }
+
         cxxFile->tempFile
           << std::endl
-          << std::endl
-          << "    IddObjectType objType(IddObjectType::" << objectName.first << ");" << std::endl
-          << "    OptionalIddObject oObj = IddObject::load(\"" << objectName.second << "\"," << std::endl
-          << "                                             \"" << group << "\"," << std::endl
-          << "                                             ss.str()," << std::endl
-          << "                                             objType);" << std::endl
-          << "    OS_ASSERT(oObj);" << std::endl
-          << "    object = *oObj;" << std::endl
-          << "  }" << std::endl
+          << "IddObject create" << objectName.first << "IddObject() {" << std::endl
+          << std::endl;
+
+        if (!tables.str().empty()) {
+          cxxFile->tempFile
+            << tables.str()
+            << std::endl
+            << "  static IddObject object;" << std::endl
+            << std::endl
+            << "  if (object.type() == IddObjectType::Catchall) {" << std::endl
+            << "    object = IddObject::fromTable(table,IddObjectType(IddObjectType::" << objectName.first << "));" << std::endl
+            << "  }" << std::endl;
+        }
+        else {
+          cxxFile->tempFile
+            << "  static IddObject object;" << std::endl
+            << std::endl
+            << "  if (object.type() == IddObjectType::Catchall) {" << std::endl
+            << "    std::stringstream ss;";
+          for (const std::string& objectLine : objectLines) {
+            cxxFile->tempFile
+              << std::endl
+              << "    ss << \"" << objectLine << "\\n\";";
+          }
+          cxxFile->tempFile
+            << std::endl
+            << std::endl
+            << "    IddObjectType objType(IddObjectType::" << objectName.first << ");" << std::endl
+            << "    OptionalIddObject oObj = IddObject::load(\"" << objectName.second << "\"," << std::endl
+            << "                                             \"" << group << "\"," << std::endl
+            << "                                             ss.str()," << std::endl
+            << "                                             objType);" << std::endl
+            << "    OS_ASSERT(oObj);" << std::endl
+            << "    object = *oObj;" << std::endl
+            << "  }" << std::endl;
+        }
+
+        cxxFile->tempFile
           << std::endl
           << "  OS_ASSERT(object.type() == IddObjectType::" << objectName.first << ");" << std::endl
           << "  return object;" << std::endl
@@ -307,10 +341,9 @@ void IddFileFactoryData::parseFile(const path& outPath,
         break; 
       }
 
-      // continue writing create function
-      cxxFile->tempFile
-        << std::endl
-        << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+      // continue collecting object text
+      objectText += trimLine + "\n";
+      objectLines.push_back(m_readyLineForOutput(line));
 
       // look for field name
       std::string fieldName;
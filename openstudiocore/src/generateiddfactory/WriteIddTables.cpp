@@ -0,0 +1,225 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "WriteIddTables.hpp"
+
+#include "../utilities/idd/IddParser.hpp"
+
+#include <boost/lexical_cast.hpp>
+#include <boost/optional.hpp>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace openstudio {
+
+namespace {
+
+  // write s as a C++ string literal. long strings are split into adjacent literals to stay
+  // clear of compiler limits, and '?' is escaped to avoid trigraphs.
+  void writeLiteral(std::ostream& os, const std::string& s) {
+    os << "\"";
+    unsigned n = 0;
+    for (char c : s) {
+      if (n == 1024) {
+        os << "\"" << std::endl << "      \"";
+        n = 0;
+      }
+      ++n;
+      switch (c) {
+      case '\\': os << "\\\\"; break;
+      case '"': os << "\\\""; break;
+      case '?': os << "\\?"; break;
+      case '\n': os << "\\n"; break;
+      case '\r': os << "\\r"; break;
+      case '\t': os << "\\t"; break;
+      default:
+        unsigned char uc = static_cast<unsigned char>(c);
+        if ((uc < 0x20) || (uc == 0x7f)) {
+          os << "\\" << std::oct << std::setw(3) << std::setfill('0') << unsigned(uc)
+             << std::dec << std::setfill(' ');
+        }
+        else {
+          os << c;
+        }
+      }
+    }
+    os << "\"";
+  }
+
+  void writeOptionalLiteral(std::ostream& os, const boost::optional<std::string>& s) {
+    if (s) {
+      writeLiteral(os,*s);
+    }
+    else {
+      os << "nullptr";
+    }
+  }
+
+  void writeDouble(std::ostream& os, const boost::optional<double>& value) {
+    if (!value) {
+      os << "0";
+      return;
+    }
+    if (!std::isfinite(*value)) {
+      throw std::runtime_error("Cannot write non-finite value to a table.");
+    }
+    std::stringstream ss;
+    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << *value;
+    os << ss.str();
+  }
+
+  // write a static array of strings named prefix + suffix if strings is not empty, and return
+  // the "pointer,count" initializer that refers to it
+  std::string writeStringArray(std::ostream& os,
+                               const std::string& prefix,
+                               const std::string& suffix,
+                               const std::vector<std::string>& strings)
+  {
+    if (strings.empty()) {
+      return "nullptr,0";
+    }
+    std::string arrayName = prefix + suffix;
+    os << "  static const char* const " << arrayName << "[] = {";
+    for (unsigned i = 0, n = strings.size(); i < n; ++i) {
+      if (i > 0) { os << ","; }
+      writeLiteral(os,strings[i]);
+    }
+    os << "};" << std::endl;
+    return arrayName + "," + boost::lexical_cast<std::string>(strings.size());
+  }
+
+  // write the arrays that fields refer to, followed by the IddFieldTable array named
+  // arrayName, and return the "pointer,count" initializer that refers to it
+  std::string writeFieldTables(std::ostream& os,
+                               const std::string& arrayName,
+                               const std::vector<iddParser::IddFieldData>& fields)
+  {
+    if (fields.empty()) {
+      return "nullptr,0";
+    }
+
+    std::vector<std::string> objectLists, references, externalLists, keys;
+    for (unsigned i = 0, n = fields.size(); i < n; ++i) {
+      const iddParser::IddFieldData& field = fields[i];
+      std::string prefix = arrayName + boost::lexical_cast<std::string>(i);
+      objectLists.push_back(writeStringArray(os,prefix,"ObjectLists",field.objectLists));
+      references.push_back(writeStringArray(os,prefix,"References",field.references));
+      externalLists.push_back(writeStringArray(os,prefix,"ExternalLists",field.externalLists));
+      if (field.keys.empty()) {
+        keys.push_back("nullptr,0");
+      }
+      else {
+        os << "  static const IddKeyTable " << prefix << "Keys[] = {";
+        for (unsigned j = 0, m = field.keys.size(); j < m; ++j) {
+          if (j > 0) { os << ","; }
+          os << std::endl << "    {";
+          writeLiteral(os,field.keys[j].name);
+          os << ",";
+          writeLiteral(os,field.keys[j].note);
+          os << "}";
+        }
+        os << "};" << std::endl;
+        keys.push_back(prefix + "Keys," + boost::lexical_cast<std::string>(field.keys.size()));
+      }
+    }
+
+    os << "  static const IddFieldTable " << arrayName << "[] = {";
+    for (unsigned i = 0, n = fields.size(); i < n; ++i) {
+      const iddParser::IddFieldData& field = fields[i];
+      if (i > 0) { os << ","; }
+      os << std::endl << "    {";
+      writeLiteral(os,field.name);
+      os << ",";
+      writeLiteral(os,field.fieldId);
+      os << ",IddFieldType::" << field.type << ",";
+      writeLiteral(os,field.note);
+      os << "," << std::endl
+         << "     " << std::boolalpha << field.required << "," << field.autosizable << ","
+         << field.autocalculatable << "," << field.retaincase << "," << field.deprecated << ","
+         << field.beginExtensible << ",";
+      writeOptionalLiteral(os,field.units);
+      os << ",";
+      writeOptionalLiteral(os,field.ipUnits);
+      os << "," << std::endl
+         << "     IddFieldProperties::" << field.minBoundType << ",";
+      writeDouble(os,field.minBoundValue);
+      os << ",";
+      writeOptionalLiteral(os,field.minBoundText);
+      os << ",IddFieldProperties::" << field.maxBoundType << ",";
+      writeDouble(os,field.maxBoundValue);
+      os << ",";
+      writeOptionalLiteral(os,field.maxBoundText);
+      os << "," << std::endl << "     ";
+      writeOptionalLiteral(os,field.stringDefault);
+      os << "," << bool(field.numericDefault) << ",";
+      writeDouble(os,field.numericDefault);
+      os << "," << std::endl
+         << "     " << objectLists[i] << "," << references[i] << "," << externalLists[i] << ","
+         << keys[i] << "}";
+    }
+    os << "};" << std::endl;
+
+    return arrayName + "," + boost::lexical_cast<std::string>(fields.size());
+  }
+
+} // anonymous namespace
+
+void writeIddObjectTable(std::ostream& os,
+                         const std::string& name,
+                         const std::string& group,
+                         const std::string& text)
+{
+  iddParser::IddObjectData object;
+  object.name = name;
+  object.group = group;
+  iddParser::parseObject(object,text,[](bool error, const std::string& message) {
+    if (error) {
+      std::cerr << message << std::endl;
+    }
+  });
+
+  std::stringstream ss;
+  std::string fields = writeFieldTables(ss,"fields",object.fields);
+  std::string extensibleFields = writeFieldTables(ss,"extensibleFields",object.extensibleFields);
+
+  ss << "  static const IddObjectTable table = {" << std::endl << "    ";
+  writeLiteral(ss,object.name);
+  ss << ",";
+  writeLiteral(ss,object.group);
+  ss << "," << std::endl << "    ";
+  writeLiteral(ss,object.memo);
+  ss << "," << std::endl
+     << "    " << std::boolalpha << object.unique << "," << object.required << ","
+     << object.obsolete << "," << object.hasURL << "," << object.extensible << ","
+     << object.numExtensible << "," << object.numExtensibleGroupsRequired << ",";
+  writeLiteral(ss,object.format);
+  ss << "," << object.minFields << "," << bool(object.maxFields) << ","
+     << (object.maxFields ? *object.maxFields : 0u) << "," << std::endl
+     << "    " << fields << "," << extensibleFields << "};" << std::endl;
+
+  os << ss.str();
+}
+
+} // openstudio
@@ -0,0 +1,40 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef GENERATEIDDFACTORY_WRITEIDDTABLES_HPP
+#define GENERATEIDDFACTORY_WRITEIDDTABLES_HPP
+
+#include <ostream>
+#include <string>
+
+namespace openstudio {
+
+/** Parses text, the full text of IddObject name in Idd group group, with the same
+ *  iddParser::parseObject that IddObject::load uses at run time, and writes the result to os as function-local static
+ *  IddFieldTable and IddKeyTable arrays followed by an IddObjectTable named table, ready to be
+ *  passed to IddObject::fromTable. Throws std::runtime_error if the text cannot be parsed, in
+ *  which case nothing is written to os. */
+void writeIddObjectTable(std::ostream& os,
+                         const std::string& name,
+                         const std::string& group,
+                         const std::string& text);
+
+} // openstudio
+
+#endif // GENERATEIDDFACTORY_WRITEIDDTABLES_HPP
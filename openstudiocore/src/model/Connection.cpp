@@ -20,6 +20,7 @@
 #include "Connection.hpp"
 #include "Connection_Impl.hpp"
 #include "ModelObject.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
@@ -38,6 +39,7 @@ namespace detail {
     : ModelObject_Impl(idfObject, model, keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == Connection::iddObjectType());
+    connect(this, &Connection_Impl::onImmediateChange, model, &Model_Impl::incrementConnectionRevision);
   }
 
   Connection_Impl::Connection_Impl(const openstudio::detail::WorkspaceObject_Impl& other, 
@@ -46,13 +48,16 @@ namespace detail {
     : ModelObject_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == Connection::iddObjectType());
+    connect(this, &Connection_Impl::onImmediateChange, model, &Model_Impl::incrementConnectionRevision);
   }
 
   Connection_Impl::Connection_Impl(const Connection_Impl& other, 
                                    Model_Impl* model, 
                                    bool keepHandle)
     : ModelObject_Impl(other,model,keepHandle)
-  {}
+  {
+    connect(this, &Connection_Impl::onImmediateChange, model, &Model_Impl::incrementConnectionRevision);
+  }
 
   // virtual destructor
   Connection_Impl::~Connection_Impl(){}
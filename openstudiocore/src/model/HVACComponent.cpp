@@ -32,6 +32,8 @@
 #include "Model.hpp"
 #include "Model_Impl.hpp"
 
+#include <utilities/idd/IddEnums.hxx>
+#include "../utilities/idf/WorkspaceObjectDiff.hpp"
 #include "../utilities/core/Assert.hpp"
 
 namespace openstudio {
@@ -42,6 +44,7 @@ namespace detail {
   HVACComponent_Impl::HVACComponent_Impl(IddObjectType type, Model_Impl* model)
     : ParentObject_Impl(type,model)
   {
+    connect(this, &HVACComponent_Impl::onImmediateChange, this, &HVACComponent_Impl::checkPortChange);
   }
 
   HVACComponent_Impl::HVACComponent_Impl(const IdfObject& idfObject,
@@ -49,6 +52,7 @@ namespace detail {
                                          bool keepHandle)
                                            : ParentObject_Impl(idfObject, model, keepHandle)
   {
+    connect(this, &HVACComponent_Impl::onImmediateChange, this, &HVACComponent_Impl::checkPortChange);
   }
 
   HVACComponent_Impl::HVACComponent_Impl(
@@ -57,6 +61,7 @@ namespace detail {
       bool keepHandle)
         : ParentObject_Impl(other,model,keepHandle)
   {
+    connect(this, &HVACComponent_Impl::onImmediateChange, this, &HVACComponent_Impl::checkPortChange);
   }
 
   HVACComponent_Impl::HVACComponent_Impl(const HVACComponent_Impl& other,
@@ -64,6 +69,31 @@ namespace detail {
                                          bool keepHandles)
                                            : ParentObject_Impl(other,model,keepHandles)
   {
+    connect(this, &HVACComponent_Impl::onImmediateChange, this, &HVACComponent_Impl::checkPortChange);
+  }
+
+  void HVACComponent_Impl::checkPortChange()
+  {
+    // only pointers to Connection objects change the loop topology. diffs accumulate over a
+    // batch edit, and the earlier ones were checked when they were made, so only look at the
+    // newest one.
+    if (m_diffs.empty()) {
+      return;
+    }
+    boost::optional<WorkspaceObjectDiff> pointerDiff = m_diffs.back().optionalCast<WorkspaceObjectDiff>();
+    if (!pointerDiff) {
+      return;
+    }
+    for (const boost::optional<Handle>& handle : {pointerDiff->oldHandle(), pointerDiff->newHandle()}) {
+      if (!handle) {
+        continue;
+      }
+      boost::optional<WorkspaceObject> object = workspace().getObject(*handle);
+      if (object && (object->iddObject().type() == IddObjectType::OS_Connection)) {
+        model().getImpl<Model_Impl>()->incrementConnectionRevision();
+        return;
+      }
+    }
   }
 
   boost::optional<Loop> HVACComponent_Impl::loop() const
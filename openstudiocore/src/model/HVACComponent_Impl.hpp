@@ -114,6 +114,10 @@ class MODEL_API HVACComponent_Impl : public ParentObject_Impl {
   boost::optional<ModelObject> airLoopHVACAsModelObject() const;
   boost::optional<ModelObject> plantLoopAsModelObject() const;
   boost::optional<ModelObject> airLoopHVACOutdoorAirSystemAsModelObject() const;
+
+ private slots:
+
+  void checkPortChange();
 };
 
 } // detail
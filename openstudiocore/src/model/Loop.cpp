@@ -40,16 +40,258 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
 
+#include <map>
+#include <unordered_map>
+
 namespace openstudio {
 
 namespace model {
 
 namespace detail {
+
+  namespace {
+
+    enum PathSearchState { Unvisited, OnStack, Finished };
+
+    // Collects the components on any path from an inlet to a sink, in the order a depth first
+    // enumeration of every path discovers them: all of the first path, then whatever each later
+    // path adds. search() does not descend into a component a second time once all of its paths
+    // to the sink have been seen, which keeps it linear in the size of the graph. That is only
+    // equivalent to the full enumeration when the graph has no cycles, so search() flags any cycle
+    // and enumerate() remains available as the exhaustive fallback.
+    struct PathSearch
+    {
+      PathSearch(const std::vector<std::vector<unsigned> >& t_successors, unsigned inlet, unsigned t_sink)
+        : successors(t_successors),
+          sink(t_sink),
+          state(t_successors.size(), Unvisited),
+          reachesSink(t_successors.size(), false),
+          inPaths(t_successors.size(), false),
+          stack(1, inlet),
+          cyclic(false)
+      {
+        state[inlet] = OnStack;
+      }
+
+      // record the path made up of the stack, followed by the sink if includeSink
+      void addPath(bool includeSink)
+      {
+        for( unsigned i : stack )
+        {
+          if( !inPaths[i] )
+          {
+            inPaths[i] = true;
+            paths.push_back(i);
+          }
+        }
+        if( includeSink && !inPaths[sink] )
+        {
+          inPaths[sink] = true;
+          paths.push_back(sink);
+        }
+      }
+
+      void search(unsigned i)
+      {
+        const std::vector<unsigned>& next = successors[i];
+
+        for( unsigned j : next )
+        {
+          if( j == sink )
+          {
+            addPath(true);
+            reachesSink[i] = true;
+          }
+        }
+
+        for( unsigned j : next )
+        {
+          if( j == sink )
+          {
+            continue;
+          }
+          if( state[j] == OnStack )
+          {
+            cyclic = true;
+            continue;
+          }
+          if( state[j] == Finished )
+          {
+            // every path from j to the sink is already in paths, only the stack can be new
+            if( reachesSink[j] )
+            {
+              addPath(false);
+              reachesSink[i] = true;
+            }
+            continue;
+          }
+          state[j] = OnStack;
+          stack.push_back(j);
+          search(j);
+          stack.pop_back();
+          state[j] = Finished;
+          if( reachesSink[j] )
+          {
+            reachesSink[i] = true;
+          }
+        }
+      }
+
+      void enumerate(unsigned i)
+      {
+        const std::vector<unsigned>& next = successors[i];
+
+        for( unsigned j : next )
+        {
+          if( (state[j] != OnStack) && (j == sink) )
+          {
+            addPath(true);
+          }
+        }
+
+        for( unsigned j : next )
+        {
+          if( (state[j] == OnStack) || (j == sink) )
+          {
+            continue;
+          }
+          state[j] = OnStack;
+          stack.push_back(j);
+          enumerate(j);
+          stack.pop_back();
+          state[j] = Unvisited;
+        }
+      }
+
+      const std::vector<std::vector<unsigned> >& successors;
+      unsigned sink;
+      std::vector<PathSearchState> state;
+      std::vector<bool> reachesSink;
+      std::vector<bool> inPaths;
+      std::vector<unsigned> stack;
+      std::vector<unsigned> paths;
+      bool cyclic;
+    };
+
+  }
+
+  struct Loop_Impl::LoopGraph
+  {
+    explicit LoopGraph(bool t_isDemandComponents)
+      : isDemandComponents(t_isDemandComponents)
+    {
+    }
+
+    unsigned index(const HVACComponent& component)
+    {
+      auto it = indices.find(component.handle());
+      if( it != indices.end() )
+      {
+        return it->second;
+      }
+      unsigned result = components.size();
+      components.push_back(component);
+      indices.insert(std::make_pair(component.handle(), result));
+      successors.push_back(std::vector<unsigned>());
+      successorsFound.push_back(false);
+      return result;
+    }
+
+    // Looks up the edges of every component reachable from inlet without passing through sink,
+    // and returns which components those are.
+    std::vector<bool> expand(unsigned inlet, unsigned sink)
+    {
+      std::vector<bool> visited(components.size(), false);
+      std::vector<unsigned> toVisit(1, inlet);
+      visited[inlet] = true;
+
+      while( !toVisit.empty() )
+      {
+        unsigned i = toVisit.back();
+        toVisit.pop_back();
+        if( i == sink )
+        {
+          continue;
+        }
+
+        if( !successorsFound[i] )
+        {
+          std::vector<HVACComponent> edges = components[i].getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
+          std::vector<unsigned> next;
+          for( const auto & edge : edges )
+          {
+            next.push_back(index(edge));
+          }
+          successors[i] = next;
+          successorsFound[i] = true;
+          visited.resize(components.size(), false);
+        }
+
+        for( unsigned j : successors[i] )
+        {
+          if( !visited[j] )
+          {
+            visited[j] = true;
+            toVisit.push_back(j);
+          }
+        }
+      }
+
+      return visited;
+    }
+
+    // All components between inlet and outlet, in the order of the original recursive search
+    const std::vector<unsigned>& paths(unsigned inlet, unsigned outlet)
+    {
+      std::pair<unsigned, unsigned> key(inlet, outlet);
+      auto it = pathsCache.find(key);
+      if( it == pathsCache.end() )
+      {
+        expand(inlet, outlet);
+
+        PathSearch pathSearch(successors, inlet, outlet);
+        pathSearch.search(inlet);
+        if( pathSearch.cyclic )
+        {
+          PathSearch exhaustiveSearch(successors, inlet, outlet);
+          exhaustiveSearch.enumerate(inlet);
+          pathSearch.paths = exhaustiveSearch.paths;
+        }
+        it = pathsCache.insert(std::make_pair(key, pathSearch.paths)).first;
+      }
+      return it->second;
+    }
+
+    // Flags for the components reachable from inlet without passing through outlet
+    const std::vector<bool>& reachable(unsigned inlet, unsigned outlet)
+    {
+      std::pair<unsigned, unsigned> key(inlet, outlet);
+      if( reachableKey != key )
+      {
+        reachableFlags = expand(inlet, outlet);
+        reachableKey = key;
+      }
+      return reachableFlags;
+    }
+
+    bool isDemandComponents;
+
+    std::vector<HVACComponent> components;
+    std::unordered_map<openstudio::Handle, unsigned, UUIDHash> indices;
+    std::vector<std::vector<unsigned> > successors;
+    std::vector<bool> successorsFound;
+
+    std::map<std::pair<unsigned, unsigned>, std::vector<unsigned> > pathsCache;
+    boost::optional<std::pair<unsigned, unsigned> > reachableKey;
+    std::vector<bool> reachableFlags;
+  };
+
   Loop_Impl::Loop_Impl(IddObjectType type, Model_Impl* model)
     : ParentObject_Impl(type,model)
   {
@@ -106,35 +348,6 @@ namespace detail {
     return ParentObject_Impl::remove();
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // searches all paths of nodes between the source and sink until a handle match is found
-  boost::optional<ModelObject> findModelObject(const openstudio::Handle & handle, const HVACComponent & sink, std::vector<HVACComponent> & visited, bool isDemandComponents)
-  {
-    HVACComponent hvacComponent = visited.back();
-    if( handle == hvacComponent.handle() ) { 
-      return hvacComponent;
-    }
-    std::vector<HVACComponent> nodes = hvacComponent.getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
-
-    for(std::vector<HVACComponent>::iterator it = nodes.begin();
-        it != nodes.end();
-        it++)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(), visited.end(), *it) != visited.end() ||
-          *it == sink )
-      {
-        continue; 
-      }
-      visited.push_back(*it);
-      boost::optional<ModelObject> foundHandle = findModelObject(handle, sink, visited, isDemandComponents);
-      if( foundHandle ) { return *foundHandle; }
-      visited.pop_back();
-    }
-    return boost::none;
-  }
-
   OptionalModelObject Loop_Impl::component(openstudio::Handle handle)
   {
     boost::optional<ModelObject> supplyComp = this->supplyComponent(handle);
@@ -144,24 +357,12 @@ namespace detail {
 
   boost::optional<ModelObject> Loop_Impl::demandComponent(openstudio::Handle handle) const
   {
-    Node inletComp = this->demandInletNode();
-    Node outletComp = this->demandOutletNode();
-    if( handle == inletComp.handle() ) { return inletComp; }
-    if( handle == outletComp.handle() ) { return outletComp; }
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    return findModelObject(handle, outletComp, visited, true);
+    return componentOnSide(handle, true);
   }
 
   boost::optional<ModelObject> Loop_Impl::supplyComponent(openstudio::Handle handle) const
   {
-    Node inletComp = this->supplyInletNode();
-    Node outletComp = this->supplyOutletNode();
-    if( handle == inletComp.handle() ) { return inletComp; }
-    if( handle == outletComp.handle() ) { return outletComp; }
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    return findModelObject(handle, outletComp, visited, false);
+    return componentOnSide(handle, false);
   }
 
   ModelObject Loop_Impl::clone(Model model) const
@@ -230,87 +431,11 @@ namespace detail {
     return result;
   }
 
-  // Recursive depth first search
-  // start algorithm with one source node in the visited vector
-  // when complete, paths will be populated with all nodes between the source node and sink
-  void findModelObjects(const HVACComponent & sink, std::vector<HVACComponent> & visited, std::vector<HVACComponent> & paths, bool isDemandComponents)
-  {
-    std::vector<HVACComponent> nodes = visited.back().getImpl<HVACComponent_Impl>()->edges(isDemandComponents);
-
-    for(const auto & node : nodes)
-    {
-      // if it node has already been visited then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() )
-      {
-        continue; 
-      }
-      if( node == sink )
-      {
-        visited.push_back(node);
-        // Avoid pushing duplicate nodes into paths
-        if( paths.empty() )
-        {
-          paths.insert(paths.end(), visited.begin(), visited.end());
-        }
-        else
-        {
-          for( const auto & visitedit : visited )
-          {
-            if( std::find(paths.begin(),paths.end(),visitedit) == paths.end() )
-            {
-              paths.push_back(visitedit);
-            }
-          }
-        }
-        visited.pop_back();
-      }
-    }
-
-    for(const auto & node : nodes)
-    {
-      // if it node has already been visited or node is sink then continue
-      if( std::find(visited.begin(),visited.end(),node) != visited.end() ||
-          node == sink )
-      {
-        continue;
-      }
-      visited.push_back(node);
-      findModelObjects(sink, visited, paths, isDemandComponents);
-      visited.pop_back();
-    }
-  }
-
   std::vector<ModelObject> Loop_Impl::demandComponents( HVACComponent inletComp,
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type ) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, true);
-    }
-    std::vector<ModelObject> _demandComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
-
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _demandComponents;
-    }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & demandComponent : _demandComponents)
-    {
-      if( type == demandComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(demandComponent);
-      }
-    }
-
-    return reducedModelObjects;
+    return componentsBetween(inletComp, outletComp, type, true);
   }
 
   std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const
@@ -343,33 +468,7 @@ namespace detail {
                                                         HVACComponent outletComp,
                                                         openstudio::IddObjectType type) const
   {
-    std::vector<HVACComponent> visited;
-    visited.push_back(inletComp);
-    std::vector<HVACComponent> allPaths;
-
-    if( inletComp == outletComp ) {
-      allPaths.push_back(inletComp);
-    }
-    else {
-      findModelObjects(outletComp, visited, allPaths, false);
-    }
-    std::vector<ModelObject> _supplyComponents = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
-
-    // Filter modelObjects for type
-    if( type == IddObjectType::Catchall ) {
-      return _supplyComponents;
-    }
-    std::vector<ModelObject> reducedModelObjects;
-    
-    for(const auto & supplyComponent : _supplyComponents)
-    {
-      if( type == supplyComponent.iddObject().type() )
-      {
-        reducedModelObjects.push_back(supplyComponent);
-      }
-    }
-
-    return reducedModelObjects;
+    return componentsBetween(inletComp, outletComp, type, false);
   }
 
   std::vector<ModelObject> Loop_Impl::components(HVACComponent inletComp,
@@ -388,6 +487,74 @@ namespace detail {
     return std::vector<ModelObject>();
   }
 
+  Loop_Impl::LoopGraph& Loop_Impl::loopGraph(bool isDemandComponents) const
+  {
+    unsigned revision = model().getImpl<Model_Impl>()->connectionRevision();
+    if( !m_cachedConnectionRevision || (*m_cachedConnectionRevision != revision) )
+    {
+      m_cachedSupplyGraph.reset();
+      m_cachedDemandGraph.reset();
+      m_cachedConnectionRevision = revision;
+    }
+
+    std::shared_ptr<LoopGraph>& graph = isDemandComponents ? m_cachedDemandGraph : m_cachedSupplyGraph;
+    if( !graph )
+    {
+      graph = std::make_shared<LoopGraph>(isDemandComponents);
+    }
+    return *graph;
+  }
+
+  std::vector<ModelObject> Loop_Impl::componentsBetween(const HVACComponent& inletComp,
+                                                        const HVACComponent& outletComp,
+                                                        openstudio::IddObjectType type,
+                                                        bool isDemandComponents) const
+  {
+    std::vector<ModelObject> result;
+
+    if( inletComp == outletComp )
+    {
+      if( (type == IddObjectType::Catchall) || (type == inletComp.iddObject().type()) )
+      {
+        result.push_back(inletComp);
+      }
+      return result;
+    }
+
+    LoopGraph& graph = loopGraph(isDemandComponents);
+    const std::vector<unsigned>& paths = graph.paths(graph.index(inletComp), graph.index(outletComp));
+
+    // Filter modelObjects for type
+    for( unsigned i : paths )
+    {
+      const HVACComponent& component = graph.components[i];
+      if( (type == IddObjectType::Catchall) || (type == component.iddObject().type()) )
+      {
+        result.push_back(component);
+      }
+    }
+
+    return result;
+  }
+
+  boost::optional<ModelObject> Loop_Impl::componentOnSide(openstudio::Handle handle, bool isDemandComponents) const
+  {
+    Node inletComp = isDemandComponents ? this->demandInletNode() : this->supplyInletNode();
+    Node outletComp = isDemandComponents ? this->demandOutletNode() : this->supplyOutletNode();
+    if( handle == inletComp.handle() ) { return inletComp; }
+    if( handle == outletComp.handle() ) { return outletComp; }
+
+    LoopGraph& graph = loopGraph(isDemandComponents);
+    const std::vector<bool>& reachable = graph.reachable(graph.index(inletComp), graph.index(outletComp));
+
+    auto it = graph.indices.find(handle);
+    if( (it != graph.indices.end()) && (it->second < reachable.size()) && reachable[it->second] )
+    {
+      return ModelObject(graph.components[it->second]);
+    }
+    return boost::none;
+  }
+
 } // detail
 
 Loop::Loop(IddObjectType type,const Model& model)
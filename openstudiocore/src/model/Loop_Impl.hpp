@@ -121,6 +121,25 @@ namespace detail {
     boost::optional<ModelObject> demandInletNodeAsModelObject();
     boost::optional<ModelObject> demandOutletNodeAsModelObject();
 
+    // Adjacency of the components reached by the supply (edges(false)) or demand (edges(true))
+    // topology queries, along with the results of previous queries. Defined in Loop.cpp.
+    struct LoopGraph;
+
+    // Returns the graph for one side of the loop, discarding both graphs if the model's
+    // connections have changed since they were built.
+    LoopGraph& loopGraph(bool isDemandComponents) const;
+
+    std::vector<ModelObject> componentsBetween(const HVACComponent& inletComp,
+                                               const HVACComponent& outletComp,
+                                               openstudio::IddObjectType type,
+                                               bool isDemandComponents) const;
+
+    boost::optional<ModelObject> componentOnSide(openstudio::Handle handle, bool isDemandComponents) const;
+
+    mutable boost::optional<unsigned> m_cachedConnectionRevision;
+    mutable std::shared_ptr<LoopGraph> m_cachedSupplyGraph;
+    mutable std::shared_ptr<LoopGraph> m_cachedDemandGraph;
+
   };
 
 } // detail
@@ -66,15 +66,19 @@ namespace detail {
 
   // default constructor
   Model_Impl::Model_Impl()
-    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio)
+    : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio),
+      m_connectionRevision(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    mf_trackConnectionRevision();
   }
 
   Model_Impl::Model_Impl(const IdfFile& idfFile)
-    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft))
+    : Workspace_Impl(idfFile,StrictnessLevel(StrictnessLevel::Draft)),
+      m_connectionRevision(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    mf_trackConnectionRevision();
     if (iddFileType() != IddFileType::OpenStudio) {
       LOG_AND_THROW("Models must be constructed with the OpenStudio Idd as the underlying "
           << "data schema. (Attempted construction from IdfFile with IddFileType "
@@ -84,9 +88,11 @@ namespace detail {
 
   Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace,
                          bool keepHandles)
-    : openstudio::detail::Workspace_Impl(workspace,keepHandles)
+    : openstudio::detail::Workspace_Impl(workspace,keepHandles),
+      m_connectionRevision(0)
   {
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    mf_trackConnectionRevision();
     if (iddFileType() != IddFileType::OpenStudio) {
       LOG_AND_THROW("Models must be constructed with the OpenStudio Idd as the underlying "
         << "data schema. (Attempted construction from Workspace with IddFileType "
@@ -97,10 +103,12 @@ namespace detail {
   // copy constructor, used for clone
   Model_Impl::Model_Impl(const Model_Impl& other, bool keepHandles)
     : Workspace_Impl(other, keepHandles),
-      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile))
+      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
+      m_connectionRevision(0)
   {
     // notice we are cloning the sqlfile too, if necessary
     // careful not to call anything that calls shared_from_this here, this is not yet constructed
+    mf_trackConnectionRevision();
   }
 
   // copy constructor used for cloneSubset
@@ -109,9 +117,11 @@ namespace detail {
                          bool keepHandles,
                          StrictnessLevel level)
     : Workspace_Impl(other,hs,keepHandles,level),
-      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile))
+      m_sqlFile((other.m_sqlFile)?(std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))):(other.m_sqlFile)),
+      m_connectionRevision(0)
   {
     // notice we are cloning the sqlfile too, if necessary
+    mf_trackConnectionRevision();
   }
   Workspace Model_Impl::clone(bool keepHandles) const {
     // copy everything but objects
@@ -1061,6 +1071,8 @@ if (_className::iddObjectType() == typeToCreate) { \
     disconnect(sourceObject,sourcePort);
     disconnect(targetObject,targetPort);
 
+    ++m_connectionRevision;
+
     Connection c(m);
     c.setSourceObject(sourceObject);
     c.setSourceObjectPort(sourcePort);
@@ -1074,6 +1086,8 @@ if (_className::iddObjectType() == typeToCreate) { \
   void Model_Impl::disconnect(ModelObject object,
                               unsigned port)
   {
+    ++m_connectionRevision;
+
     if( boost::optional<HVACComponent> hvacComponent = object.optionalCast<HVACComponent>() )
     {
       std::shared_ptr<HVACComponent_Impl> hvacComponentImpl;
@@ -1204,6 +1218,36 @@ if (_className::iddObjectType() == typeToCreate) { \
     }
   }
 
+  unsigned Model_Impl::connectionRevision() const
+  {
+    return m_connectionRevision;
+  }
+
+  void Model_Impl::incrementConnectionRevision()
+  {
+    ++m_connectionRevision;
+  }
+
+  void Model_Impl::mf_trackConnectionRevision()
+  {
+    QObject::connect(this, static_cast<void (Model_Impl::*)(const WorkspaceObject&, const openstudio::IddObjectType&, const openstudio::UUID&) const>(&Model_Impl::addWorkspaceObject),
+                     this, &Model_Impl::updateConnectionRevision);
+    QObject::connect(this, static_cast<void (Model_Impl::*)(const WorkspaceObject&, const openstudio::IddObjectType&, const openstudio::UUID&) const>(&Model_Impl::removeWorkspaceObject),
+                     this, &Model_Impl::updateConnectionRevision);
+  }
+
+  void Model_Impl::updateConnectionRevision(const WorkspaceObject& object,
+                                            const openstudio::IddObjectType& iddObjectType,
+                                            const openstudio::UUID& handle)
+  {
+    if ((iddObjectType == IddObjectType::OS_Connection) ||
+        (iddObjectType == IddObjectType::OS_PortList) ||
+        object.optionalCast<HVACComponent>())
+    {
+      ++m_connectionRevision;
+    }
+  }
+
   void Model_Impl::clearCachedBuilding()
   {
     m_cachedBuilding.reset();
@@ -193,6 +193,16 @@ namespace detail {
 
     void disconnect(ModelObject object, unsigned port);
 
+    /** Returns a counter that is incremented whenever HVAC connections in the model may have
+     *  changed, i.e. on connect, disconnect, the addition or removal of Connection, PortList
+     *  and HVACComponent objects, and direct edits of Connection and PortList fields or of
+     *  HVACComponent port fields. Used to invalidate cached loop topology. */
+    unsigned connectionRevision() const;
+
+    /** Increments connectionRevision(). Called by the objects that make up HVAC connections when
+     *  their fields are edited directly. */
+    void incrementConnectionRevision();
+
    public slots :
 
     virtual void obsoleteComponentWatcher(const ComponentWatcher& watcher);
@@ -224,6 +234,10 @@ namespace detail {
 
     void mf_createComponentWatcher(ComponentData& componentData);
 
+    void mf_trackConnectionRevision();
+
+    unsigned m_connectionRevision;
+
   private:
 
     mutable boost::optional<Building> m_cachedBuilding;
@@ -240,6 +254,10 @@ namespace detail {
     void clearCachedYearDescription();
     void clearCachedWeatherFile();
 
+    void updateConnectionRevision(const WorkspaceObject& object,
+                                  const openstudio::IddObjectType& iddObjectType,
+                                  const openstudio::UUID& handle);
+
   };
 
 } // detail
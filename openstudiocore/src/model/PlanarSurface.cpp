@@ -66,7 +66,7 @@ namespace model {
       : ParentObject_Impl(type, model)
     {
       // connect signals
-      connect(this, &PlanarSurface_Impl::onChange, this, &PlanarSurface_Impl::clearCachedVariables);
+      connect(this, &PlanarSurface_Impl::onImmediateChange, this, &PlanarSurface_Impl::clearCachedVariables);
     }
 
     // constructor
@@ -76,7 +76,7 @@ namespace model {
       : ParentObject_Impl(idfObject, model, keepHandle)
     {
       // connect signals
-      connect(this, &PlanarSurface_Impl::onChange, this, &PlanarSurface_Impl::clearCachedVariables);
+      connect(this, &PlanarSurface_Impl::onImmediateChange, this, &PlanarSurface_Impl::clearCachedVariables);
     }
 
     PlanarSurface_Impl::PlanarSurface_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -85,7 +85,7 @@ namespace model {
       : ParentObject_Impl(other,model,keepHandle)
     {
       // connect signals
-      connect(this, &PlanarSurface_Impl::onChange, this, &PlanarSurface_Impl::clearCachedVariables);
+      connect(this, &PlanarSurface_Impl::onImmediateChange, this, &PlanarSurface_Impl::clearCachedVariables);
     }
 
     PlanarSurface_Impl::PlanarSurface_Impl(const PlanarSurface_Impl& other,
@@ -94,7 +94,7 @@ namespace model {
       : ParentObject_Impl(other,model,keepHandle)
     {
       // connect signals
-      connect(this, &PlanarSurface_Impl::onChange, this, &PlanarSurface_Impl::clearCachedVariables);
+      connect(this, &PlanarSurface_Impl::onImmediateChange, this, &PlanarSurface_Impl::clearCachedVariables);
     }
 
     boost::optional<ConstructionBase> PlanarSurface_Impl::construction() const
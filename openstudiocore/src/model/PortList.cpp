@@ -47,6 +47,7 @@ PortList_Impl::PortList_Impl(const IdfObject& idfObject,
   : ModelObject_Impl(idfObject,model,keepHandle)
 {
   OS_ASSERT(idfObject.iddObject().type() == PortList::iddObjectType());
+  connect(this, &PortList_Impl::onImmediateChange, model, &Model_Impl::incrementConnectionRevision);
 }
 
 PortList_Impl::PortList_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -55,13 +56,16 @@ PortList_Impl::PortList_Impl(const openstudio::detail::WorkspaceObject_Impl& oth
   : ModelObject_Impl(other,model,keepHandle)
 {
   OS_ASSERT(other.iddObject().type() == PortList::iddObjectType());
+  connect(this, &PortList_Impl::onImmediateChange, model, &Model_Impl::incrementConnectionRevision);
 }
 
 PortList_Impl::PortList_Impl(const PortList_Impl& other,
                              Model_Impl* model,
                              bool keepHandle)
   : ModelObject_Impl(other,model,keepHandle)
-{}
+{
+  connect(this, &PortList_Impl::onImmediateChange, model, &Model_Impl::incrementConnectionRevision);
+}
 
 const std::vector<std::string>& PortList_Impl::outputVariableNames() const
 {
@@ -43,18 +43,39 @@
 #include "../utilities/time/Time.hpp"
 #include "../utilities/data/Vector.hpp"
 
+#include <algorithm>
+
 namespace openstudio {
 namespace model {
 
 namespace detail {
 
+  namespace {
+
+    // openstudio::interp for a point inside the table built by ScheduleDay_Impl::buildInterpTable,
+    // it is the first table time not less than days
+    double interpScheduleDay(const std::vector<double>& x, const std::vector<double>& y,
+                             std::vector<double>::const_iterator it, double days, bool linear)
+    {
+      unsigned ib = static_cast<unsigned>(it - x.begin());
+      unsigned ia = ib - 1;
+      if (linear){
+        double wa = (x[ib] - days) / (x[ib] - x[ia]);
+        double wb = (days - x[ia]) / (x[ib] - x[ia]);
+        return wa*y[ia] + wb*y[ib];
+      }
+      return y[ib];
+    }
+
+  }
+
   ScheduleDay_Impl::ScheduleDay_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : ScheduleBase_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == ScheduleDay::iddObjectType());
 
     // connect signals
-    connect(this, &ScheduleDay_Impl::onChange, this, &ScheduleDay_Impl::clearCachedVariables);
+    connect(this, &ScheduleDay_Impl::onImmediateChange, this, &ScheduleDay_Impl::clearCachedVariables);
   }
 
   ScheduleDay_Impl::ScheduleDay_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -65,7 +86,7 @@ namespace detail {
     OS_ASSERT(other.iddObject().type() == ScheduleDay::iddObjectType());
 
     // connect signals
-    connect(this, &ScheduleDay_Impl::onChange, this, &ScheduleDay_Impl::clearCachedVariables);
+    connect(this, &ScheduleDay_Impl::onImmediateChange, this, &ScheduleDay_Impl::clearCachedVariables);
   }
 
   ScheduleDay_Impl::ScheduleDay_Impl(const ScheduleDay_Impl& other,
@@ -74,7 +95,7 @@ namespace detail {
     : ScheduleBase_Impl(other,model,keepHandle)
   {
     // connect signals
-    connect(this, &ScheduleDay_Impl::onChange, this, &ScheduleDay_Impl::clearCachedVariables);
+    connect(this, &ScheduleDay_Impl::onImmediateChange, this, &ScheduleDay_Impl::clearCachedVariables);
   }
 
   std::vector<IdfObject> ScheduleDay_Impl::remove() {
@@ -202,22 +223,54 @@ namespace detail {
 
   double ScheduleDay_Impl::getValue(const openstudio::Time& time) const
   {
-    if (time.totalDays() < 0.0 || time.totalDays() > 1.0){
+    double days = time.totalDays();
+    if (days < 0.0 || days > 1.0){
+      return 0.0;
+    }
+
+    buildInterpTable();
+    const std::vector<double>& x = m_cachedInterpTimes.get();
+
+    // no values
+    if (x.size() == 2){
       return 0.0;
     }
 
+    std::vector<double>::const_iterator it = std::lower_bound(x.begin(), x.end(), days);
+    return interpScheduleDay(x, m_cachedInterpValues, it, days, m_cachedInterpolatetoTimestep);
+  }
+
+  void ScheduleDay_Impl::appendValues(const std::vector<double>& sortedDays, std::vector<double>& result) const
+  {
+    buildInterpTable();
+    const std::vector<double>& x = m_cachedInterpTimes.get();
+
+    // times are sorted, so each search can start where the last one ended
+    std::vector<double>::const_iterator it = x.begin();
+    for (double days : sortedDays){
+      if (days < 0.0 || days > 1.0 || x.size() == 2){
+        result.push_back(0.0);
+        continue;
+      }
+      it = std::lower_bound(it, x.end(), days);
+      result.push_back(interpScheduleDay(x, m_cachedInterpValues, it, days, m_cachedInterpolatetoTimestep));
+    }
+  }
+
+  void ScheduleDay_Impl::buildInterpTable() const
+  {
+    if (m_cachedInterpTimes){
+      return;
+    }
+
     std::vector<double> values = this->values(); // these are already sorted
     std::vector<openstudio::Time> times = this->times(); // these are already sorted
 
     unsigned N = times.size();
     OS_ASSERT(values.size() == N);
 
-    if (N == 0){
-      return 0.0;
-    }
-
-    openstudio::Vector x(N + 2);
-    openstudio::Vector y(N + 2);
+    std::vector<double> x(N + 2);
+    std::vector<double> y(N + 2);
 
     x[0] = -0.000001;
     y[0] = 0.0;
@@ -230,16 +283,9 @@ namespace detail {
     x[N + 1] = 1.000001;
     y[N + 1] = 0.0;
 
-    InterpMethod interpMethod;
-    if (this->interpolatetoTimestep()){
-      interpMethod = LinearInterp;
-    }else{
-      interpMethod = HoldNextInterp;
-    }
-
-    double result = interp(x, y, time.totalDays(), interpMethod, NoneExtrap);
-
-    return result;
+    m_cachedInterpValues.swap(y);
+    m_cachedInterpolatetoTimestep = this->interpolatetoTimestep();
+    m_cachedInterpTimes = x;
   }
 
   boost::optional<Quantity> ScheduleDay_Impl::getValueAsQuantity(const openstudio::Time& time, bool returnIP) const {
@@ -410,6 +456,7 @@ namespace detail {
   {
     m_cachedTimes.reset();
     m_cachedValues.reset();
+    m_cachedInterpTimes.reset();
   }
 
 } // detail
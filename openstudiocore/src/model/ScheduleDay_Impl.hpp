@@ -91,6 +91,10 @@ namespace detail {
     /// Returns the value in effect at the given time.  If time is less than 0 days or greater than 1 day, 0 is returned.
     double getValue(const openstudio::Time& time) const;
 
+    /// Appends the value in effect at each of the given times, in days and sorted in increasing
+    /// order, to result. Gives the same values as calling getValue for each time.
+    void appendValues(const std::vector<double>& sortedDays, std::vector<double>& result) const;
+
     boost::optional<Quantity> getValueAsQuantity(const openstudio::Time& time, bool returnIP=false) const;
 
     //@}
@@ -134,8 +138,15 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleDay");
 
+    void buildInterpTable() const;
+
     mutable boost::optional<std::vector<openstudio::Time> > m_cachedTimes;
     mutable boost::optional<std::vector<double> > m_cachedValues;
+
+    // table interpolated by getValue, times in days bracketed by zero values just outside the day
+    mutable boost::optional<std::vector<double> > m_cachedInterpTimes;
+    mutable std::vector<double> m_cachedInterpValues;
+    mutable bool m_cachedInterpolatetoTimestep;
   };
 
 } // detail
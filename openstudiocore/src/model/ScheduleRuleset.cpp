@@ -37,16 +37,50 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/time/Date.hpp"
+#include "../utilities/time/Time.hpp"
 
 namespace openstudio {
 namespace model {
 
 namespace detail {
 
+  namespace {
+
+    // each day between start date (inclusive) and end date (inclusive), wrapping around the end of the year
+    std::vector<openstudio::Date> datesBetween(const openstudio::Date& startDate, const openstudio::Date& endDate)
+    {
+      std::vector<openstudio::Date> dates;
+      if (startDate <= endDate){
+        openstudio::Date date = startDate;
+        while (date <= endDate){
+          dates.push_back(date);
+          date += Time(1);
+        }
+      }else{
+        openstudio::Date date = startDate;
+        openstudio::Date endOfYear(MonthOfYear::Dec, 31);
+        while (date <= endOfYear){
+          dates.push_back(date);
+          date += Time(1);
+        }
+        date = openstudio::Date(MonthOfYear::Jan, 1);
+        while (date <= endDate){
+          dates.push_back(date);
+          date += Time(1);
+        }
+      }
+      return dates;
+    }
+
+  }
+
   ScheduleRuleset_Impl::ScheduleRuleset_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : Schedule_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == ScheduleRuleset::iddObjectType());
+
+    // connect signals
+    connect(this, &ScheduleRuleset_Impl::onImmediateChange, this, &ScheduleRuleset_Impl::clearCachedVariables);
   }
 
   ScheduleRuleset_Impl::ScheduleRuleset_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -55,13 +89,19 @@ namespace detail {
     : Schedule_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == ScheduleRuleset::iddObjectType());
+
+    // connect signals
+    connect(this, &ScheduleRuleset_Impl::onImmediateChange, this, &ScheduleRuleset_Impl::clearCachedVariables);
   }
 
   ScheduleRuleset_Impl::ScheduleRuleset_Impl(const ScheduleRuleset_Impl& other,
                                        Model_Impl* model,
                                        bool keepHandle)
     : Schedule_Impl(other,model,keepHandle)
-  {}
+  {
+    // connect signals
+    connect(this, &ScheduleRuleset_Impl::onImmediateChange, this, &ScheduleRuleset_Impl::clearCachedVariables);
+  }
 
   ModelObject ScheduleRuleset_Impl::clone(Model model) const {
     ModelObject newScheduleRulesetAsModelObject = ModelObject_Impl::clone(model);
@@ -339,6 +379,9 @@ namespace detail {
 
   bool ScheduleRuleset_Impl::setScheduleRuleIndex(ScheduleRule& scheduleRule, unsigned index)
   {
+    // called when rules are added, removed, or reordered
+    clearCachedVariables();
+
     std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
     unsigned N = scheduleRules.size();
 
@@ -403,26 +446,7 @@ namespace detail {
     // need to check or adjust assumed base year on input date?
 
     // populate dates to check
-    std::vector<openstudio::Date> dates;
-    if (startDate <= endDate){
-      openstudio::Date date = startDate;
-      while (date <= endDate){
-        dates.push_back(date);
-        date += Time(1);
-      }
-    }else{
-      openstudio::Date date = startDate;
-      openstudio::Date endOfYear(MonthOfYear::Dec, 31);
-      while (date <= endOfYear){
-        dates.push_back(date);
-        date += Time(1);
-      }
-      date = openstudio::Date(MonthOfYear::Jan, 1);
-      while (date <= endDate){
-        dates.push_back(date);
-        date += Time(1);
-      }
-    }
+    std::vector<openstudio::Date> dates = datesBetween(startDate, endDate);
 
     unsigned numDates = dates.size();
 
@@ -465,6 +489,37 @@ namespace detail {
     return result;
   }
 
+  double ScheduleRuleset_Impl::getValue(const openstudio::Date& date, const openstudio::Time& time) const
+  {
+    return daySchedule(date).getImpl<ScheduleDay_Impl>()->getValue(time);
+  }
+
+  std::vector<double> ScheduleRuleset_Impl::getValues(const openstudio::Date& startDate, const openstudio::Date& endDate, const openstudio::Time& timeStep) const
+  {
+    std::vector<double> result;
+
+    int secondsPerStep = timeStep.totalSeconds();
+    if ((secondsPerStep <= 0) || (86400 % secondsPerStep != 0)){
+      LOG(Error, "Time step " << timeStep << " does not divide a day into whole intervals in " << briefDescription() << ".");
+      return result;
+    }
+
+    // times in days at the end of each time step, as ScheduleDay::getValue would compute them
+    unsigned stepsPerDay = 86400 / secondsPerStep;
+    std::vector<double> stepTimes(stepsPerDay);
+    for (unsigned i = 0; i < stepsPerDay; ++i){
+      stepTimes[i] = openstudio::Time(0, 0, 0, (i + 1)*secondsPerStep).totalDays();
+    }
+
+    std::vector<openstudio::Date> dates = datesBetween(startDate, endDate);
+    result.reserve(dates.size()*stepsPerDay);
+    for (const openstudio::Date& date : dates){
+      daySchedule(date).getImpl<ScheduleDay_Impl>()->appendValues(stepTimes, result);
+    }
+
+    return result;
+  }
+
   bool ScheduleRuleset_Impl::moveToEnd(ScheduleRule& scheduleRule)
   {
     std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
@@ -478,6 +533,64 @@ namespace detail {
     }
   }
 
+  void ScheduleRuleset_Impl::compileDaySchedules() const
+  {
+    if (m_cachedYear){
+      return;
+    }
+
+    YearDescription yd = this->model().getUniqueModelObject<YearDescription>();
+    openstudio::Date jan1 = yd.makeDate(MonthOfYear::Jan, 1);
+    openstudio::Date dec31 = yd.makeDate(MonthOfYear::Dec, 31);
+
+    // the cache depends on the calendar and on each rule, changes to the day schedules themselves
+    // are handled by their own caches
+    connect(yd.getImpl<YearDescription_Impl>().get(), &YearDescription_Impl::onImmediateChange,
+            this, &ScheduleRuleset_Impl::clearCachedVariables, Qt::UniqueConnection);
+
+    m_cachedDaySchedules.clear();
+    m_cachedDaySchedules.push_back(this->defaultDaySchedule());
+    for (const ScheduleRule& scheduleRule : this->scheduleRules()){
+      std::shared_ptr<ScheduleRule_Impl> ruleImpl = scheduleRule.getImpl<ScheduleRule_Impl>();
+      connect(ruleImpl.get(), &ScheduleRule_Impl::onImmediateChange,
+              this, &ScheduleRuleset_Impl::clearCachedVariables, Qt::UniqueConnection);
+      connect(ruleImpl.get(), &ScheduleRule_Impl::onRemoveFromWorkspace,
+              this, &ScheduleRuleset_Impl::clearCachedVariables, Qt::UniqueConnection);
+      m_cachedDaySchedules.push_back(scheduleRule.daySchedule());
+    }
+
+    // the default day schedule is first, followed by the rules in order
+    std::vector<int> activeRuleIndices = this->getActiveRuleIndices(jan1, dec31);
+    m_cachedDayScheduleIndices.clear();
+    m_cachedDayScheduleIndices.reserve(activeRuleIndices.size());
+    for (int i : activeRuleIndices){
+      m_cachedDayScheduleIndices.push_back(i + 1);
+    }
+
+    m_cachedYear = jan1.year();
+  }
+
+  ScheduleDay ScheduleRuleset_Impl::daySchedule(const openstudio::Date& date) const
+  {
+    compileDaySchedules();
+
+    if (date.year() == m_cachedYear.get()){
+      unsigned index = date.dayOfYear() - 1;
+      if (index < m_cachedDayScheduleIndices.size()){
+        return m_cachedDaySchedules[m_cachedDayScheduleIndices[index]];
+      }
+    }
+
+    return getDaySchedules(date, date).front();
+  }
+
+  void ScheduleRuleset_Impl::clearCachedVariables()
+  {
+    m_cachedYear.reset();
+    m_cachedDaySchedules.clear();
+    m_cachedDayScheduleIndices.clear();
+  }
+
   boost::optional<ScheduleDay> ScheduleRuleset_Impl::optionalDefaultDaySchedule() const {
     return getObject<ScheduleRuleset>().getModelObjectTarget<ScheduleDay>(OS_Schedule_RulesetFields::DefaultDayScheduleName);
   }
@@ -568,6 +681,16 @@ std::vector<ScheduleDay> ScheduleRuleset::getDaySchedules(const openstudio::Date
   return getImpl<detail::ScheduleRuleset_Impl>()->getDaySchedules(startDate, endDate);
 }
   
+double ScheduleRuleset::getValue(const openstudio::Date& date, const openstudio::Time& time) const
+{
+  return getImpl<detail::ScheduleRuleset_Impl>()->getValue(date, time);
+}
+
+std::vector<double> ScheduleRuleset::getValues(const openstudio::Date& startDate, const openstudio::Date& endDate, const openstudio::Time& timeStep) const
+{
+  return getImpl<detail::ScheduleRuleset_Impl>()->getValues(startDate, endDate, timeStep);
+}
+
 bool ScheduleRuleset::moveToEnd(ScheduleRule& scheduleRule)
 {
   return getImpl<detail::ScheduleRuleset_Impl>()->moveToEnd(scheduleRule);
@@ -26,6 +26,7 @@
 namespace openstudio {
 
 class Date;
+class Time;
 
 namespace model {
 
@@ -122,6 +123,17 @@ class MODEL_API ScheduleRuleset : public Schedule {
   std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, 
                                            const openstudio::Date& endDate) const;
 
+  /// Returns the value in effect at the given time of day, between 0 and 1 day, on the given date.
+  double getValue(const openstudio::Date& date, const openstudio::Time& time) const;
+
+  /// Returns the values at the end of each time step between start date (inclusive) and end date 
+  /// (inclusive), e.g. 8760 values for a full non-leap year with an hourly time step. The time 
+  /// step must divide a day into whole intervals. The day schedule in effect on each day of the 
+  /// year is cached until this schedule, its rules, or the model's YearDescription change.
+  std::vector<double> getValues(const openstudio::Date& startDate, 
+                                const openstudio::Date& endDate,
+                                const openstudio::Time& timeStep) const;
+
   //@}
  protected:
 
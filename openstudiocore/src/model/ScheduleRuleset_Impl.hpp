@@ -26,6 +26,7 @@
 namespace openstudio {
 
 class Date;
+class Time;
 
 namespace model {
 
@@ -36,6 +37,7 @@ namespace detail {
 
   /** ScheduleRuleset_Impl is a Schedule_Impl that is the implementation class for ScheduleRuleset.*/
   class MODEL_API ScheduleRuleset_Impl : public Schedule_Impl {
+    Q_OBJECT;
    public:
 
     /** @name Constructors and Destructors */
@@ -130,6 +132,12 @@ namespace detail {
 
     /// Returns a vector of day schedules between start date (inclusive) and end date (inclusive).
     std::vector<ScheduleDay> getDaySchedules(const openstudio::Date& startDate, const openstudio::Date& endDate) const;
+
+    /// Returns the value in effect at the given time of day on the given date.
+    double getValue(const openstudio::Date& date, const openstudio::Time& time) const;
+
+    /// Returns the values at the end of each time step between start date (inclusive) and end date (inclusive).
+    std::vector<double> getValues(const openstudio::Date& startDate, const openstudio::Date& endDate, const openstudio::Time& timeStep) const;
     
     // Moves this rule to the last position. Called in ScheduleRule remove.
     bool moveToEnd(ScheduleRule& scheduleRule);
@@ -138,10 +146,25 @@ namespace detail {
     virtual void ensureNoLeapDays();
 
     //@}
+   private slots:
+
+    void clearCachedVariables();
+
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleRuleset");
 
     boost::optional<ScheduleDay> optionalDefaultDaySchedule() const;
+
+    // fills the day schedule cache for the year of the model's YearDescription
+    void compileDaySchedules() const;
+
+    // day schedule in effect on date, uses the cache for dates in its year
+    ScheduleDay daySchedule(const openstudio::Date& date) const;
+
+    // year of the cache, the day schedules in effect during it, and the index of the one in effect on each day
+    mutable boost::optional<int> m_cachedYear;
+    mutable std::vector<ScheduleDay> m_cachedDaySchedules;
+    mutable std::vector<unsigned> m_cachedDayScheduleIndices;
   };
 
 } // detail
@@ -105,6 +105,7 @@
 
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
+#include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Vector3d.hpp"
 #include "../utilities/geometry/EulerAngles.hpp"
@@ -120,13 +121,105 @@
 #include <boost/geometry/multi/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 
+#include <QtConcurrentMap>
+
 #include <cmath>
+#include <tuple>
 
 namespace openstudio {
 namespace model {
 
 namespace detail {
 
+  // tolerance on vertex distances used when matching surfaces
+  static const double matchSurfacesTol = 0.01;
+
+  /** Matches surface with otherSurface, and then their sub surfaces, if the surfaces face opposite 
+   *  directions and have the same vertices. vertices and outwardNormal are those of surface, 
+   *  transformation takes otherSurface's space coordinates to surface's space coordinates. Returns
+   *  true if the surfaces were matched. */
+  static bool matchSurface(Surface& surface,
+                           const std::vector<Point3d>& vertices,
+                           const Vector3d& outwardNormal,
+                           Surface& otherSurface,
+                           const Transformation& transformation)
+  {
+    std::vector<Point3d> otherVertices = transformation*otherSurface.vertices();
+
+    boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
+    if (!otherOutwardNormal){
+      return false;
+    }
+
+    double dot = outwardNormal.dot(*otherOutwardNormal);
+
+    if (dot > -0.98){
+      return false;
+    }
+
+    std::reverse(otherVertices.begin(), otherVertices.end());
+
+    if (!circularEqual(vertices, otherVertices, matchSurfacesTol)){
+      return false;
+    }
+
+    // TODO: check constructions?
+    surface.setAdjacentSurface(otherSurface);
+    otherSurface.setAdjacentSurface(surface);
+
+    // once surfaces are matched, check subsurfaces
+    for (SubSurface subSurface : surface.subSurfaces()){
+
+      std::vector<Point3d> subSurfaceVertices = subSurface.vertices();
+
+      for (SubSurface otherSubSurface : otherSurface.subSurfaces()){
+
+        std::vector<Point3d> otherSubSurfaceVertices = transformation*otherSubSurface.vertices();
+        std::reverse(otherSubSurfaceVertices.begin(), otherSubSurfaceVertices.end());
+
+        if (circularEqual(subSurfaceVertices, otherSubSurfaceVertices, matchSurfacesTol)){
+
+          // TODO: check constructions?
+          subSurface.setAdjacentSubSurface(otherSubSurface);
+          otherSubSurface.setAdjacentSubSurface(subSurface);
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /** Returns the pairs (i, j), i < j, of spaces whose bounding boxes intersect, in lexicographic order. */
+  static std::vector<std::pair<unsigned, unsigned> > intersectingSpaces(const std::vector<BoundingBox>& bounds)
+  {
+    double tol = 0.001; // default tolerance of BoundingBox::intersects
+
+    // sweep over the boxes in order of minimum x, only testing boxes that overlap in x
+    std::vector<unsigned> order;
+    for (unsigned i = 0; i < bounds.size(); ++i){
+      if (!bounds[i].isEmpty()){
+        order.push_back(i);
+      }
+    }
+    std::sort(order.begin(), order.end(), [&bounds](unsigned a, unsigned b){
+      return bounds[a].minX().get() < bounds[b].minX().get();
+    });
+
+    std::vector<std::pair<unsigned, unsigned> > result;
+    for (unsigned k = 0; k < order.size(); ++k){
+      BoundingBox bound = bounds[order[k]];
+      double maxX = bound.maxX().get() + tol;
+      for (unsigned l = k + 1; (l < order.size()) && (bounds[order[l]].minX().get() <= maxX); ++l){
+        if (bound.intersects(bounds[order[l]], tol)){
+          result.push_back(std::make_pair(std::min(order[k], order[l]), std::max(order[k], order[l])));
+        }
+      }
+    }
+    std::sort(result.begin(), result.end());
+
+    return result;
+  }
+
   Space_Impl::Space_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
     : PlanarSurfaceGroup_Impl(idfObject,model,keepHandle)
   {
@@ -2197,8 +2290,6 @@ namespace detail {
 
   void Space_Impl::matchSurfaces(Space& other)
   {
-    double tol = 0.01;
-
     if (this->handle() == other.handle()){
       return;
     }
@@ -2206,6 +2297,8 @@ namespace detail {
     // transform from other to this coordinates
     Transformation transformation = this->transformation().inverse()*other.transformation();
 
+    std::vector<Surface> otherSurfaces = other.surfaces();
+
     for (Surface surface : this->surfaces()){
 
       std::vector<Point3d> vertices = surface.vertices();
@@ -2215,53 +2308,18 @@ namespace detail {
         continue;
       }
 
-      for (Surface otherSurface : other.surfaces()){
-
-        std::vector<Point3d> otherVertices = transformation*otherSurface.vertices();
-
-        boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
-        if (!otherOutwardNormal){
-          continue;
-        }
-
-        double dot = outwardNormal->dot(*otherOutwardNormal);
-
-        if (dot > -0.98){
-          continue;
-        }
-
-        std::reverse(otherVertices.begin(), otherVertices.end());
-
-        if (circularEqual(vertices, otherVertices, tol)){
-
-          // TODO: check constructions?
-          surface.setAdjacentSurface(otherSurface);
-          otherSurface.setAdjacentSurface(surface);
-
-          // once surfaces are matched, check subsurfaces
-          for (SubSurface subSurface : surface.subSurfaces()){
-
-            vertices = subSurface.vertices();
-
-            for (SubSurface otherSubSurface : otherSurface.subSurfaces()){
-
-              otherVertices = transformation*otherSubSurface.vertices();
-              std::reverse(otherVertices.begin(), otherVertices.end());
-
-              if (circularEqual(vertices, otherVertices, tol)){
-
-                // TODO: check constructions?
-                subSurface.setAdjacentSubSurface(otherSubSurface);
-                otherSubSurface.setAdjacentSubSurface(subSurface);
-              }
-            }
-          }
-        }
+      for (Surface otherSurface : otherSurfaces){
+        matchSurface(surface, vertices, *outwardNormal, otherSurface, transformation);
       }
     }
   }
 
   void Space_Impl::intersectSurfaces(Space& other)
+  {
+    intersectSurfaces(other, PrecomputedIntersectionMap());
+  }
+
+  void Space_Impl::intersectSurfaces(Space& other, const PrecomputedIntersectionMap& precomputedIntersections)
   {
     if (this->handle() == other.handle()){
       return;
@@ -2312,8 +2370,14 @@ namespace detail {
           }
           completedIntersections.insert(intersectionKey);
 
+          const PrecomputedIntersection* precomputed = nullptr;
+          auto it = precomputedIntersections.find(std::make_pair(surface.handle(), otherSurface.handle()));
+          if (it != precomputedIntersections.end()){
+            precomputed = it->second;
+          }
+
           // number of surfaces in each space will only increase in intersect
-          boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
+          boost::optional<SurfaceIntersection> intersection = surface.getImpl<detail::Surface_Impl>()->computeIntersection(otherSurface, precomputed);
           if (intersection){
             std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
             newSurfaces.insert(newSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
@@ -3394,36 +3458,185 @@ Space::Space(std::shared_ptr<detail::Space_Impl> impl)
 /// @endcond
 
 void intersectSurfaces(std::vector<Space>& spaces)
+{
+  intersectSurfaces(spaces, false);
+}
+
+void intersectSurfaces(std::vector<Space>& spaces, bool computeInParallel)
 {
   std::vector<BoundingBox> bounds;
   for (const Space& space : spaces){
     bounds.push_back(space.transformation()*space.boundingBox());
   }
 
-  for (unsigned i = 0; i < spaces.size(); ++i){
-    for (unsigned j = i+1; j < spaces.size(); ++j){
-      if (!bounds[i].intersects(bounds[j])){
+  std::vector<std::pair<unsigned, unsigned> > spacePairs = detail::intersectingSpaces(bounds);
+
+  if (!computeInParallel){
+    for (const std::pair<unsigned, unsigned>& spacePair : spacePairs){
+      spaces[spacePair.first].intersectSurfaces(spaces[spacePair.second]);
+    }
+    return;
+  }
+
+  // the geometry of each candidate pair of surfaces is computed up front on worker threads from the 
+  // current vertices, the model is only changed below on this thread, one pair of spaces at a time in 
+  // the same order as before so that new surfaces and their names do not depend on thread timing
+  std::vector<std::vector<Surface> > surfaces;
+  std::vector<std::vector<Plane> > planes;
+  std::vector<std::vector<std::vector<Point3d> > > buildingVertices;
+  for (const Space& space : spaces){
+    Transformation transformation = space.transformation();
+    surfaces.push_back(std::vector<Surface>());
+    planes.push_back(std::vector<Plane>());
+    buildingVertices.push_back(std::vector<std::vector<Point3d> >());
+    for (const Surface& surface : space.surfaces()){
+      // same tests as Space_Impl::intersectSurfaces and Surface_Impl::computeIntersection
+      if (!surface.subSurfaces().empty() || surface.adjacentSurface()){
         continue;
       }
-      spaces[i].intersectSurfaces(spaces[j]);
+      surfaces.back().push_back(surface);
+      planes.back().push_back(transformation * surface.plane());
+      buildingVertices.back().push_back(transformation * surface.vertices());
+    }
+  }
+
+  std::vector<detail::PrecomputedIntersection> precomputedIntersections;
+  for (const std::pair<unsigned, unsigned>& spacePair : spacePairs){
+    unsigned i = spacePair.first;
+    unsigned j = spacePair.second;
+    for (unsigned k = 0; k < surfaces[i].size(); ++k){
+      for (unsigned m = 0; m < surfaces[j].size(); ++m){
+        if (!planes[i][k].reverseEqual(planes[j][m])){
+          continue;
+        }
+        if ((buildingVertices[i][k].size() < 3) || (buildingVertices[j][m].size() < 3)){
+          continue;
+        }
+        detail::PrecomputedIntersection precomputed;
+        precomputed.surfaceHandle = surfaces[i][k].handle();
+        precomputed.otherSurfaceHandle = surfaces[j][m].handle();
+        precomputed.buildingVertices = buildingVertices[i][k];
+        precomputed.otherBuildingVertices = buildingVertices[j][m];
+        precomputed.computed = false;
+        precomputedIntersections.push_back(precomputed);
+      }
     }
   }
+
+  QtConcurrent::blockingMap(precomputedIntersections, 
+                            static_cast<void (*)(detail::PrecomputedIntersection&)>(&detail::Surface_Impl::computeFaceIntersection));
+
+  detail::PrecomputedIntersectionMap precomputedIntersectionMap;
+  for (const detail::PrecomputedIntersection& precomputed : precomputedIntersections){
+    precomputedIntersectionMap[std::make_pair(precomputed.surfaceHandle, precomputed.otherSurfaceHandle)] = &precomputed;
+  }
+
+  for (const std::pair<unsigned, unsigned>& spacePair : spacePairs){
+    spaces[spacePair.first].getImpl<detail::Space_Impl>()->intersectSurfaces(spaces[spacePair.second], precomputedIntersectionMap);
+  }
 }
 
 void matchSurfaces(std::vector<Space>& spaces)
 {
+  // Matching surfaces have the same number of vertices, and the centroids of their vertices are 
+  // within the matching tolerance of each other. Surfaces are bucketed by vertex count and by the 
+  // grid cell holding their vertex centroid (in building coordinates), so that each surface is 
+  // only compared with the surfaces in the cells near its own centroid.
+  double cellSize = 1.0;
+  double searchRadius = 2.0*detail::matchSurfacesTol;
+  typedef std::tuple<unsigned, long long, long long, long long> CellKey;
+  std::map<CellKey, std::vector<std::pair<unsigned, unsigned> > > cells;
+
   std::vector<BoundingBox> bounds;
-  for (const Space& space : spaces){
-    bounds.push_back(space.transformation()*space.boundingBox());
+  std::vector<std::vector<Surface> > surfaces;
+  std::vector<std::vector<std::vector<Point3d> > > vertices;
+  std::vector<std::vector<Point3d> > centroids;
+  for (unsigned i = 0; i < spaces.size(); ++i){
+    Transformation transformation = spaces[i].transformation();
+    bounds.push_back(transformation*spaces[i].boundingBox());
+    surfaces.push_back(spaces[i].surfaces());
+    vertices.push_back(std::vector<std::vector<Point3d> >());
+    centroids.push_back(std::vector<Point3d>());
+    for (unsigned k = 0; k < surfaces[i].size(); ++k){
+      vertices[i].push_back(surfaces[i][k].vertices());
+      std::vector<Point3d> buildingVertices = transformation*vertices[i][k];
+      double x = 0, y = 0, z = 0;
+      for (const Point3d& point : buildingVertices){
+        x += point.x();
+        y += point.y();
+        z += point.z();
+      }
+      double n = std::max<double>(buildingVertices.size(), 1);
+      Point3d centroid(x/n, y/n, z/n);
+      centroids[i].push_back(centroid);
+      CellKey key(buildingVertices.size(), 
+                  static_cast<long long>(std::floor(centroid.x()/cellSize)),
+                  static_cast<long long>(std::floor(centroid.y()/cellSize)),
+                  static_cast<long long>(std::floor(centroid.z()/cellSize)));
+      cells[key].push_back(std::make_pair(i, k));
+    }
+  }
+
+  // collect candidate surface pairs in the order that matching every pair of spaces would visit them
+  std::set<std::tuple<unsigned, unsigned, unsigned, unsigned> > candidates; // space i, space j, surface k, surface m
+  for (unsigned i = 0; i < spaces.size(); ++i){
+    for (unsigned k = 0; k < surfaces[i].size(); ++k){
+      const Point3d& centroid = centroids[i][k];
+      unsigned numVertices = vertices[i][k].size();
+      long long minX = static_cast<long long>(std::floor((centroid.x() - searchRadius)/cellSize));
+      long long maxX = static_cast<long long>(std::floor((centroid.x() + searchRadius)/cellSize));
+      long long minY = static_cast<long long>(std::floor((centroid.y() - searchRadius)/cellSize));
+      long long maxY = static_cast<long long>(std::floor((centroid.y() + searchRadius)/cellSize));
+      long long minZ = static_cast<long long>(std::floor((centroid.z() - searchRadius)/cellSize));
+      long long maxZ = static_cast<long long>(std::floor((centroid.z() + searchRadius)/cellSize));
+      for (long long x = minX; x <= maxX; ++x){
+        for (long long y = minY; y <= maxY; ++y){
+          for (long long z = minZ; z <= maxZ; ++z){
+            auto it = cells.find(CellKey(numVertices, x, y, z));
+            if (it == cells.end()){
+              continue;
+            }
+            for (const std::pair<unsigned, unsigned>& other : it->second){
+              unsigned j = other.first;
+              unsigned m = other.second;
+              if ((j > i) && (getDistance(centroid, centroids[j][m]) <= searchRadius)){
+                candidates.insert(std::make_tuple(i, j, k, m));
+              }
+            }
+          }
+        }
+      }
+    }
   }
 
-  for (unsigned i = 0; i < spaces.size(); ++i){
-    for (unsigned j = i+1; j < spaces.size(); ++j){
-      if (!bounds[i].intersects(bounds[j])){
-        continue;
+  // apply the same test as Space::matchSurfaces to each candidate
+  boost::optional<std::pair<unsigned, unsigned> > spacePair;
+  bool skipSpacePair = false;
+  Transformation transformation;
+  for (const std::tuple<unsigned, unsigned, unsigned, unsigned>& candidate : candidates){
+    unsigned i = std::get<0>(candidate);
+    unsigned j = std::get<1>(candidate);
+    unsigned k = std::get<2>(candidate);
+    unsigned m = std::get<3>(candidate);
+
+    if (!spacePair || (spacePair->first != i) || (spacePair->second != j)){
+      spacePair = std::make_pair(i, j);
+      skipSpacePair = (spaces[i].handle() == spaces[j].handle()) || !bounds[i].intersects(bounds[j]);
+      if (!skipSpacePair){
+        // transform from space j to space i coordinates
+        transformation = spaces[i].transformation().inverse()*spaces[j].transformation();
       }
-      spaces[i].matchSurfaces(spaces[j]);
     }
+    if (skipSpacePair){
+      continue;
+    }
+
+    boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices[i][k]);
+    if (!outwardNormal){
+      continue;
+    }
+
+    detail::matchSurface(surfaces[i][k], vertices[i][k], *outwardNormal, surfaces[j][m], transformation);
   }
 }
 
@@ -575,6 +575,10 @@ class MODEL_API Space : public PlanarSurfaceGroup {
 /** Intersect surfaces within spaces. */
 MODEL_API void intersectSurfaces(std::vector<Space>& spaces);
 
+/** Intersect surfaces within spaces. If computeInParallel is true the intersections of candidate pairs 
+ *  of surfaces are computed ahead of time on the global thread pool, the result is the same as when it is false. */
+MODEL_API void intersectSurfaces(std::vector<Space>& spaces, bool computeInParallel);
+
 /** Match surfaces and sub surfaces within spaces. */
 MODEL_API void matchSurfaces(std::vector<Space>& spaces);
 
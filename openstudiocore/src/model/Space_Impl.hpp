@@ -64,6 +64,8 @@ class Space;
 
 namespace detail {
 
+  struct PrecomputedIntersection;
+
   /** Space_Impl is a PlanarSurfaceGroup_Impl that is the implementation class for Space.*/
   class MODEL_API Space_Impl : public PlanarSurfaceGroup_Impl {
     Q_OBJECT;
@@ -503,6 +505,10 @@ namespace detail {
     /** Intersect surfaces in this space with those in the other. */
     void intersectSurfaces(Space& other);
 
+    /** Intersect surfaces in this space with those in the other, using intersections computed ahead of time 
+     *  for pairs of surfaces keyed by their handles where they are still valid. */
+    void intersectSurfaces(Space& other, const std::map<std::pair<Handle, Handle>, const PrecomputedIntersection*>& precomputedIntersections);
+
     /** Find surfaces within angular range, specified in degrees and in the site coordinate system, an unset optional means no limit.
         Values for degrees from North are between 0 and 360 and for degrees tilt they are between 0 and 180.
         Note that maxDegreesFromNorth may be less than minDegreesFromNorth,
@@ -806,9 +806,46 @@ namespace detail {
   }
 
   boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface)
+  {
+    return computeIntersection(otherSurface, nullptr);
+  }
+
+  boost::optional<IntersectionResult> Surface_Impl::computeFaceIntersection(const std::vector<Point3d>& buildingVertices,
+                                                                           const std::vector<Point3d>& otherBuildingVertices,
+                                                                           const Transformation& faceTransformationInverse)
   {
     double tol = 0.01; // 1 cm tolerance
 
+    // put building vertices into face coordinates
+    std::vector<Point3d> faceVertices = faceTransformationInverse * buildingVertices;
+    std::vector<Point3d> otherFaceVertices = faceTransformationInverse * otherBuildingVertices;
+
+    // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
+    std::reverse(faceVertices.begin(), faceVertices.end());
+    //std::reverse(otherFaceVertices.begin(), otherFaceVertices.end());
+
+    return openstudio::intersect(faceVertices, otherFaceVertices, tol);
+  }
+
+  void Surface_Impl::computeFaceIntersection(PrecomputedIntersection& precomputed)
+  {
+    Logger::instance().beginCapture();
+
+    precomputed.computed = false;
+    try {
+      Transformation faceTransformationInverse = Transformation::alignFace(precomputed.buildingVertices).inverse();
+      precomputed.intersection = computeFaceIntersection(precomputed.buildingVertices, precomputed.otherBuildingVertices, faceTransformationInverse);
+      precomputed.computed = true;
+    }catch(const std::exception&){
+      // computeIntersection will try again and report the error
+    }
+
+    precomputed.logMessages = Logger::instance().endCapture();
+  }
+
+  boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface, const PrecomputedIntersection* precomputed)
+  {
+
     boost::optional<Space> space = this->space();
     boost::optional<Space> otherSpace = otherSurface.space();
     if (!space || !otherSpace || space->handle() == otherSpace->handle()){
@@ -860,17 +897,24 @@ namespace detail {
       return boost::none;
     }
 
-    // put building vertices into face coordinates
-    std::vector<Point3d> faceVertices = faceTransformationInverse * buildingVertices;
-    std::vector<Point3d> otherFaceVertices = faceTransformationInverse * otherBuildingVertices;
-
-    // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
-    std::reverse(faceVertices.begin(), faceVertices.end());
-    //std::reverse(otherFaceVertices.begin(), otherFaceVertices.end());
-
     //LOG(Info, "Trying intersection of '" << this->name().get() << "' with '" << otherSurface.name().get());
 
-    boost::optional<IntersectionResult> intersection = openstudio::intersect(faceVertices, otherFaceVertices, tol);
+    // the precomputed result is only valid if neither surface has changed since it was computed,
+    // the geometry is a pure function of the building vertices so the result is the same as computing it here
+    boost::optional<IntersectionResult> intersection;
+    if (precomputed && precomputed->computed &&
+        (precomputed->buildingVertices == buildingVertices) &&
+        (precomputed->otherBuildingVertices == otherBuildingVertices))
+    {
+      intersection = precomputed->intersection;
+
+      // messages from computing the intersection were held back on the worker thread
+      for (const LogMessage& logMessage : precomputed->logMessages){
+        logFree(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
+      }
+    }else{
+      intersection = computeFaceIntersection(buildingVertices, otherBuildingVertices, faceTransformationInverse);
+    }
     if (!intersection){
       //LOG(Info, "No intersection");
       return boost::none;
@@ -23,7 +23,12 @@
 #include "ModelAPI.hpp"
 #include "PlanarSurface_Impl.hpp"
 
+#include "../utilities/geometry/Intersection.hpp"
+
 namespace openstudio {
+
+class Transformation;
+
 namespace model {
 
 class Space;
@@ -35,6 +40,22 @@ class ConstructionBase;
 
 namespace detail {
 
+  /** Intersection of a pair of surfaces computed ahead of time by Surface_Impl::computeFaceIntersection,
+   *  it is only used while the building vertices of both surfaces are unchanged. Messages logged while 
+   *  computing it are held in logMessages and only logged if the intersection is used. */
+  struct PrecomputedIntersection {
+    Handle surfaceHandle;
+    Handle otherSurfaceHandle;
+    std::vector<Point3d> buildingVertices;
+    std::vector<Point3d> otherBuildingVertices;
+    bool computed;
+    boost::optional<IntersectionResult> intersection;
+    std::vector<LogMessage> logMessages;
+  };
+
+  /** PrecomputedIntersections keyed by the handles of the pair of surfaces. */
+  typedef std::map<std::pair<Handle, Handle>, const PrecomputedIntersection*> PrecomputedIntersectionMap;
+
   /** Surface_Impl is a PlanarSurface_Impl that is the implementation class for Surface.*/
   class MODEL_API Surface_Impl : public PlanarSurface_Impl {
     Q_OBJECT;
@@ -207,6 +228,20 @@ namespace detail {
     bool intersect(Surface& otherSurface);
     boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+    /** As computeIntersection, but uses precomputed if it matches the current vertices of both surfaces. */
+    boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface, const PrecomputedIntersection* precomputed);
+
+    /** The geometric part of computeIntersection, works on the vertices of both surfaces in building coordinates
+     *  and faceTransformationInverse, the transformation from building coordinates to face coordinates of buildingVertices.
+     *  Does not access the model so it can be called from worker threads. */
+    static boost::optional<IntersectionResult> computeFaceIntersection(const std::vector<Point3d>& buildingVertices,
+                                                                      const std::vector<Point3d>& otherBuildingVertices,
+                                                                      const Transformation& faceTransformationInverse);
+
+    /** Fills in precomputed.intersection, sets precomputed.computed to false if the face transformation fails.
+     *  Messages logged on this thread meanwhile are captured in precomputed.logMessages. */
+    static void computeFaceIntersection(PrecomputedIntersection& precomputed);
+
     boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
     bool isPartOfEnvelope() const;
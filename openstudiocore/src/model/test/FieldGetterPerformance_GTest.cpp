@@ -0,0 +1,112 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelFixture.hpp"
+
+#include "../Model.hpp"
+#include "../Surface.hpp"
+#include "../Surface_Impl.hpp"
+#include "../ScheduleFixedInterval.hpp"
+#include "../ScheduleFixedInterval_Impl.hpp"
+#include "../ModelExtensibleGroup.hpp"
+
+#include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <boost/timer.hpp>
+
+using namespace openstudio::model;
+using namespace openstudio;
+
+TEST_F(ModelFixture, FieldGetterPerformance_SurfaceVertices)
+{
+  Model model;
+
+  unsigned numSurfaces = 1000;
+  std::vector<Surface> surfaces;
+  for (unsigned i = 0; i < numSurfaces; ++i) {
+    Point3dVector vertices;
+    vertices.push_back(Point3d(0.1*i, 0, 3));
+    vertices.push_back(Point3d(0.1*i, 0, 0));
+    vertices.push_back(Point3d(0.1*i + 10, 0, 0));
+    vertices.push_back(Point3d(0.1*i + 10, 0, 3));
+    surfaces.push_back(Surface(vertices, model));
+  }
+
+  // Surface caches its vertices, so read the vertex fields directly as vertices() does on first use
+  unsigned numPasses = 100;
+  boost::timer t;
+  double sum = 0.0;
+  for (unsigned pass = 0; pass < numPasses; ++pass) {
+    for (const Surface& surface : surfaces) {
+      for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(surface.extensibleGroups())) {
+        sum += group.getDouble(0).get() + group.getDouble(1).get() + group.getDouble(2).get();
+      }
+    }
+  }
+  double getterTime = t.elapsed();
+
+  // the first pass fills the vertex caches from the fields, later passes are served from them
+  t.restart();
+  for (const Surface& surface : surfaces) {
+    EXPECT_EQ(4u, surface.vertices().size());
+  }
+  double firstVerticesTime = t.elapsed();
+
+  t.restart();
+  for (unsigned pass = 1; pass < numPasses; ++pass) {
+    for (const Surface& surface : surfaces) {
+      sum += surface.vertices()[0].z();
+    }
+  }
+  double verticesTime = t.elapsed();
+
+  EXPECT_GT(sum, 0.0);
+  LOG(Info, "Read " << numPasses << " x " << numSurfaces << " x 4 vertices through getDouble in " 
+      << getterTime << "s, Surface::vertices() for " << numSurfaces << " surfaces in " 
+      << firstVerticesTime << "s the first time and " << verticesTime << "s for the next "
+      << numPasses - 1 << " passes.");
+}
+
+TEST_F(ModelFixture, FieldGetterPerformance_ScheduleFixedIntervalTimeSeries)
+{
+  Model model;
+  ScheduleFixedInterval schedule(model);
+
+  Vector values(8760);
+  for (unsigned i = 0; i < values.size(); ++i){
+    values[i] = 0.5 * (i % 24);
+  }
+  TimeSeries timeSeries(Date(MonthOfYear::Jan, 1), Time(0, 0, 60), values, "");
+  EXPECT_TRUE(schedule.setTimeSeries(timeSeries));
+
+  unsigned numPasses = 20;
+  boost::timer t;
+  for (unsigned pass = 0; pass < numPasses; ++pass) {
+    TimeSeries result = schedule.timeSeries();
+    ASSERT_EQ(values.size(), result.values().size());
+    EXPECT_DOUBLE_EQ(values[23], result.values()[23]);
+  }
+  double timeSeriesTime = t.elapsed();
+
+  LOG(Info, "ScheduleFixedInterval::timeSeries() of 8760 values, " << numPasses << " times, in " 
+      << timeSeriesTime << "s.");
+}
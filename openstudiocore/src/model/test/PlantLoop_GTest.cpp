@@ -37,6 +37,8 @@
 #include "../CoilCoolingWater.hpp"
 #include "../ScheduleCompact.hpp"
 #include "../LifeCycleCost.hpp"
+#include "../Connection.hpp"
+#include "../Connection_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
@@ -326,3 +328,73 @@ TEST_F(ModelFixture, PlantLoop_edges)
   }
   EXPECT_TRUE(found_demand_chiller);
 }
+
+TEST_F(ModelFixture, PlantLoop_TopologyCache)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+
+  CoilHeatingWater coil(m,s);
+  CoilHeatingWater coil2(m,s);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil2));
+
+  // repeated queries give the same components in the same order
+  std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+  ASSERT_EQ(10u, demandComponents.size());
+  EXPECT_EQ(plantLoop.demandInletNode(), demandComponents.front());
+  EXPECT_TRUE(demandComponents == plantLoop.demandComponents());
+  EXPECT_EQ(2u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+
+  EXPECT_TRUE(plantLoop.demandComponent(coil.handle()));
+  EXPECT_TRUE(plantLoop.demandComponent(coil2.handle()));
+  EXPECT_FALSE(plantLoop.supplyComponent(coil.handle()));
+  EXPECT_TRUE(plantLoop.component(plantLoop.supplyOutletNode().handle()));
+
+  // changing the connections invalidates the cached topology
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coil2));
+  EXPECT_EQ(7u, plantLoop.demandComponents().size());
+  EXPECT_FALSE(plantLoop.demandComponent(coil2.handle()));
+  EXPECT_TRUE(plantLoop.demandComponent(coil.handle()));
+
+  CurveBiquadratic ccFofT(m);
+  CurveBiquadratic eirToCorfOfT(m);
+  CurveQuadratic eiToCorfOfPlr(m);
+  ChillerElectricEIR chiller(m,ccFofT,eirToCorfOfT,eiToCorfOfPlr);
+  EXPECT_FALSE(plantLoop.supplyComponent(chiller.handle()));
+  Node supplyOutletNode = plantLoop.supplyOutletNode();
+  ASSERT_TRUE(chiller.addToNode(supplyOutletNode));
+  EXPECT_TRUE(plantLoop.supplyComponent(chiller.handle()));
+  EXPECT_EQ(1u, plantLoop.supplyComponents(ChillerElectricEIR::iddObjectType()).size());
+}
+
+TEST_F(ModelFixture, PlantLoop_TopologyCache_ConnectionEdits)
+{
+  Model m;
+  PlantLoop plantLoop(m);
+
+  CurveBiquadratic ccFofT(m);
+  CurveBiquadratic eirToCorfOfT(m);
+  CurveQuadratic eiToCorfOfPlr(m);
+  ChillerElectricEIR chiller(m,ccFofT,eirToCorfOfT,eiToCorfOfPlr);
+  Node supplyOutletNode = plantLoop.supplyOutletNode();
+  ASSERT_TRUE(chiller.addToNode(supplyOutletNode));
+  EXPECT_EQ(1u, plantLoop.supplyComponents(ChillerElectricEIR::iddObjectType()).size());
+  unsigned numSupplyComponents = plantLoop.supplyComponents().size();
+
+  // edit a Connection directly so the chiller is bypassed
+  boost::optional<Connection> chillerInletConnection;
+  for (Connection connection : m.getModelObjects<Connection>()) {
+    if (connection.targetObject() && (connection.targetObject()->handle() == chiller.handle())) {
+      chillerInletConnection = connection;
+    }
+  }
+  ASSERT_TRUE(chillerInletConnection);
+  chillerInletConnection->setTargetObject(supplyOutletNode);
+  chillerInletConnection->setTargetObjectPort(supplyOutletNode.inletPort());
+
+  EXPECT_TRUE(plantLoop.supplyComponents(ChillerElectricEIR::iddObjectType()).empty());
+  EXPECT_FALSE(plantLoop.supplyComponent(chiller.handle()));
+  EXPECT_EQ(numSupplyComponents - 1u, plantLoop.supplyComponents().size());
+}
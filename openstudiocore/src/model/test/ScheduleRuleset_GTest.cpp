@@ -924,3 +924,129 @@ Nov 11  Veterans Day
 Nov 26  Thanksgiving Day
 Dec 25  Christmas Day
 */
+
+TEST_F(ModelFixture, ScheduleRuleset_GetValues)
+{
+  Model model;
+  YearDescription yd = model.getUniqueModelObject<YearDescription>();
+  openstudio::Date jan1 = yd.makeDate(openstudio::MonthOfYear::Jan, 1);
+  openstudio::Date dec31 = yd.makeDate(openstudio::MonthOfYear::Dec, 31);
+
+  ScheduleRuleset schedule(model);
+  ScheduleDay weekday = schedule.defaultDaySchedule();
+  weekday.clearValues();
+  weekday.addValue(openstudio::Time(0,8), 0.1);
+  weekday.addValue(openstudio::Time(0,18), 1.0);
+  weekday.addValue(openstudio::Time(0,24), 0.1);
+
+  ScheduleRule weekendRule(schedule);
+  weekendRule.setApplySaturday(true);
+  weekendRule.setApplySunday(true);
+  ScheduleDay weekend = weekendRule.daySchedule();
+  weekend.clearValues();
+  weekend.addValue(openstudio::Time(0,24), 0.05);
+
+  // compare against the day schedules in effect on each day
+  auto expectValues = [&](const openstudio::Time& timeStep) {
+    std::vector<double> values = schedule.getValues(jan1, dec31, timeStep);
+    std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(jan1, dec31);
+    int stepsPerDay = 86400 / timeStep.totalSeconds();
+    ASSERT_EQ(daySchedules.size()*stepsPerDay, values.size());
+    for (unsigned i = 0; i < daySchedules.size(); ++i){
+      for (int j = 0; j < stepsPerDay; ++j){
+        openstudio::Time time(0, 0, 0, (j + 1)*timeStep.totalSeconds());
+        ASSERT_EQ(daySchedules[i].getValue(time), values[i*stepsPerDay + j]) << "day " << i << " step " << j;
+      }
+    }
+  };
+
+  std::vector<double> values = schedule.getValues(jan1, dec31, openstudio::Time(0,1));
+  ASSERT_EQ(8760u, values.size());
+  expectValues(openstudio::Time(0,1));
+  expectValues(openstudio::Time(0,0,15));
+
+  // Jan 1 2009 is a Thursday
+  EXPECT_EQ(0.1, schedule.getValue(jan1, openstudio::Time(0,8)));
+  EXPECT_EQ(1.0, schedule.getValue(jan1, openstudio::Time(0,12)));
+  EXPECT_EQ(0.05, schedule.getValue(yd.makeDate(openstudio::MonthOfYear::Jan, 3), openstudio::Time(0,12)));
+
+  // changing a day schedule
+  weekend.addValue(openstudio::Time(0,12), 0.5);
+  EXPECT_EQ(0.5, schedule.getValue(yd.makeDate(openstudio::MonthOfYear::Jan, 3), openstudio::Time(0,12)));
+  expectValues(openstudio::Time(0,1));
+
+  // changing a rule
+  weekendRule.setApplySaturday(false);
+  EXPECT_EQ(1.0, schedule.getValue(yd.makeDate(openstudio::MonthOfYear::Jan, 3), openstudio::Time(0,12)));
+  expectValues(openstudio::Time(0,1));
+
+  // adding a rule
+  ScheduleRule holidayRule(schedule);
+  holidayRule.setApplyThursday(true);
+  holidayRule.setStartDate(jan1);
+  holidayRule.setEndDate(jan1);
+  holidayRule.daySchedule().clearValues();
+  holidayRule.daySchedule().addValue(openstudio::Time(0,24), 0.0);
+  EXPECT_EQ(0.0, schedule.getValue(jan1, openstudio::Time(0,12)));
+  expectValues(openstudio::Time(0,1));
+
+  // removing a rule
+  holidayRule.remove();
+  EXPECT_EQ(1.0, schedule.getValue(jan1, openstudio::Time(0,12)));
+  expectValues(openstudio::Time(0,1));
+
+  // changing the calendar, Jan 1 is now a Sunday
+  EXPECT_TRUE(yd.setDayofWeekforStartDay("Sunday"));
+  jan1 = yd.makeDate(openstudio::MonthOfYear::Jan, 1);
+  dec31 = yd.makeDate(openstudio::MonthOfYear::Dec, 31);
+  EXPECT_EQ(0.5, schedule.getValue(jan1, openstudio::Time(0,6)));
+  expectValues(openstudio::Time(0,1));
+
+  // time step must divide the day
+  EXPECT_TRUE(schedule.getValues(jan1, dec31, openstudio::Time(0,0,7)).empty());
+}
+
+TEST_F(ModelFixture, ScheduleRuleset_GetValues_BatchEdit)
+{
+  Model model;
+  YearDescription yd = model.getUniqueModelObject<YearDescription>();
+  openstudio::Date jan1 = yd.makeDate(openstudio::MonthOfYear::Jan, 1);
+  openstudio::Date jan3 = yd.makeDate(openstudio::MonthOfYear::Jan, 3);
+
+  ScheduleRuleset schedule(model);
+  ScheduleDay weekday = schedule.defaultDaySchedule();
+  weekday.clearValues();
+  weekday.addValue(openstudio::Time(0,24), 1.0);
+
+  ScheduleRule weekendRule(schedule);
+  weekendRule.setApplySaturday(true);
+  weekendRule.setApplySunday(true);
+  ScheduleDay weekend = weekendRule.daySchedule();
+  weekend.clearValues();
+  weekend.addValue(openstudio::Time(0,24), 0.05);
+
+  // Jan 1 2009 is a Thursday
+  EXPECT_EQ(1.0, schedule.getValue(jan1, openstudio::Time(0,12)));
+  EXPECT_EQ(0.05, schedule.getValue(jan3, openstudio::Time(0,12)));
+
+  {
+    Workspace::BatchEdit batchEdit(model);
+
+    // changing a day schedule
+    weekend.addValue(openstudio::Time(0,12), 0.5);
+    EXPECT_EQ(0.5, weekend.getValue(openstudio::Time(0,6)));
+    EXPECT_EQ(0.5, schedule.getValue(jan3, openstudio::Time(0,6)));
+
+    // changing a rule
+    weekendRule.setApplySaturday(false);
+    EXPECT_EQ(1.0, schedule.getValue(jan3, openstudio::Time(0,6)));
+
+    // changing the calendar, Jan 1 is now a Sunday
+    EXPECT_TRUE(yd.setDayofWeekforStartDay("Sunday"));
+    jan1 = yd.makeDate(openstudio::MonthOfYear::Jan, 1);
+    EXPECT_EQ(0.5, schedule.getValue(jan1, openstudio::Time(0,6)));
+  }
+
+  EXPECT_EQ(0.5, schedule.getValue(jan1, openstudio::Time(0,6)));
+  EXPECT_EQ(0.05, schedule.getValue(jan1, openstudio::Time(0,18)));
+}
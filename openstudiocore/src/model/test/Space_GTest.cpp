@@ -60,8 +60,10 @@
 #include "../../utilities/geometry/BoundingBox.hpp"
 #include "../../utilities/idf/WorkspaceObjectWatcher.hpp"
 #include "../../utilities/core/Compare.hpp"
+#include "../../utilities/core/StringStreamLogSink.hpp"
 
 #include <iostream>
+#include <algorithm>
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -759,6 +761,207 @@ TEST_F(ModelFixture, Space_SurfaceMatch_LargeTest)
   model.save(toPath("./Space_SurfaceMatch_LargeTest.osm"), true);
 }
 
+TEST_F(ModelFixture, Space_SurfaceMatch_SameAsPairwise)
+{
+  Model model;
+
+  // 4 x 3 x 2 grid of 10 x 10 x 3 boxes, with a window in every north and south wall
+  for (unsigned i = 0; i < 4; ++i){
+    for (unsigned j = 0; j < 3; ++j){
+      for (unsigned k = 0; k < 2; ++k){
+        Point3dVector floorPrint;
+        floorPrint.push_back(Point3d(10*i, 10*j + 10, 3*k));
+        floorPrint.push_back(Point3d(10*i + 10, 10*j + 10, 3*k));
+        floorPrint.push_back(Point3d(10*i + 10, 10*j, 3*k));
+        floorPrint.push_back(Point3d(10*i, 10*j, 3*k));
+        boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+        ASSERT_TRUE(space);
+
+        std::vector<Surface> searchResults = space->findSurfaces(180.0,180.0,90.0,90.0);
+        ASSERT_EQ(1u, searchResults.size());
+        Point3dVector subSurfacePoints;
+        subSurfacePoints.push_back(Point3d(10*i + 2, 10*j, 3*k + 2));
+        subSurfacePoints.push_back(Point3d(10*i + 2, 10*j, 3*k + 1));
+        subSurfacePoints.push_back(Point3d(10*i + 8, 10*j, 3*k + 1));
+        subSurfacePoints.push_back(Point3d(10*i + 8, 10*j, 3*k + 2));
+        SubSurface southWindow(subSurfacePoints, model);
+        southWindow.setSurface(searchResults[0]);
+
+        searchResults = space->findSurfaces(0.0,0.0,90.0,90.0);
+        ASSERT_EQ(1u, searchResults.size());
+        subSurfacePoints.clear();
+        subSurfacePoints.push_back(Point3d(10*i + 8, 10*j + 10, 3*k + 2));
+        subSurfacePoints.push_back(Point3d(10*i + 8, 10*j + 10, 3*k + 1));
+        subSurfacePoints.push_back(Point3d(10*i + 2, 10*j + 10, 3*k + 1));
+        subSurfacePoints.push_back(Point3d(10*i + 2, 10*j + 10, 3*k + 2));
+        SubSurface northWindow(subSurfacePoints, model);
+        northWindow.setSurface(searchResults[0]);
+      }
+    }
+  }
+
+  SpaceVector spaces = model.getModelObjects<Space>();
+  ASSERT_EQ(24u, spaces.size());
+
+  std::map<Handle, Handle> pairwise;
+  for (unsigned i = 0; i < spaces.size(); ++i){
+    for (unsigned j = i+1; j < spaces.size(); ++j){
+      spaces[i].matchSurfaces(spaces[j]);
+    }
+  }
+  for (const Surface& surface : model.getModelObjects<Surface>()){
+    if (boost::optional<Surface> adjacentSurface = surface.adjacentSurface()){
+      pairwise[surface.handle()] = adjacentSurface->handle();
+    }
+  }
+  for (const SubSurface& subSurface : model.getModelObjects<SubSurface>()){
+    if (boost::optional<SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface()){
+      pairwise[subSurface.handle()] = adjacentSubSurface->handle();
+    }
+  }
+  // 3*3*2 east-west walls, 4*2*2 north-south walls, 4*3 floor-ceilings and 4*2*2 windows in 
+  // north-south walls are shared, and each is counted from both sides
+  EXPECT_EQ(2u*(18u + 16u + 12u) + 2u*16u, pairwise.size());
+
+  unmatchSurfaces(spaces);
+  for (const Surface& surface : model.getModelObjects<Surface>()){
+    EXPECT_FALSE(surface.adjacentSurface());
+  }
+
+  matchSurfaces(spaces);
+
+  std::map<Handle, Handle> modelWide;
+  for (const Surface& surface : model.getModelObjects<Surface>()){
+    if (boost::optional<Surface> adjacentSurface = surface.adjacentSurface()){
+      modelWide[surface.handle()] = adjacentSurface->handle();
+    }
+  }
+  for (const SubSurface& subSurface : model.getModelObjects<SubSurface>()){
+    if (boost::optional<SubSurface> adjacentSubSurface = subSurface.adjacentSubSurface()){
+      modelWide[subSurface.handle()] = adjacentSubSurface->handle();
+    }
+  }
+  EXPECT_TRUE(pairwise == modelWide);
+}
+
+namespace {
+
+  // one two story space next to four one story spaces, with a space above them all
+  std::vector<Space> createIntersectTestSpaces(Model& model)
+  {
+    std::vector<Space> result;
+
+    std::vector<std::vector<double> > boxes;
+    boxes.push_back({0, 0, 0, 10, 20, 6});
+    boxes.push_back({10, 0, 0, 20, 10, 3});
+    boxes.push_back({10, 10, 0, 20, 20, 3});
+    boxes.push_back({10, 0, 3, 20, 10, 6});
+    boxes.push_back({10, 10, 3, 20, 20, 6});
+    boxes.push_back({0, 0, 6, 20, 20, 9});
+
+    for (const std::vector<double>& box : boxes){
+      Point3dVector floorPrint;
+      floorPrint.push_back(Point3d(box[0], box[4], box[2]));
+      floorPrint.push_back(Point3d(box[3], box[4], box[2]));
+      floorPrint.push_back(Point3d(box[3], box[1], box[2]));
+      floorPrint.push_back(Point3d(box[0], box[1], box[2]));
+      boost::optional<Space> space = Space::fromFloorPrint(floorPrint, box[5] - box[2], model);
+      EXPECT_TRUE(space);
+      if (space){
+        result.push_back(*space);
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<std::map<std::string, Point3dVector> > intersectTestResults(const std::vector<Space>& spaces)
+  {
+    std::vector<std::map<std::string, Point3dVector> > result;
+    for (const Space& space : spaces){
+      result.push_back(std::map<std::string, Point3dVector>());
+      for (const Surface& surface : space.surfaces()){
+        result.back()[surface.name().get()] = surface.vertices();
+      }
+    }
+    return result;
+  }
+
+  std::vector<std::string> intersectTestLogMessages(const StringStreamLogSink& sink)
+  {
+    std::vector<std::string> result;
+    for (const LogMessage& logMessage : sink.logMessages()){
+      result.push_back(logMessage.logChannel() + ": " + logMessage.logMessage());
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+}
+
+TEST_F(ModelFixture, Space_Intersect_SameAsPairwise)
+{
+  // the model-wide intersectSurfaces computes the geometry ahead of time on worker threads, 
+  // the result must be the same as intersecting each pair of spaces in turn
+  Model pairwiseModel;
+  std::vector<Space> pairwiseSpaces = createIntersectTestSpaces(pairwiseModel);
+  ASSERT_EQ(6u, pairwiseSpaces.size());
+  for (unsigned i = 0; i < pairwiseSpaces.size(); ++i){
+    for (unsigned j = i+1; j < pairwiseSpaces.size(); ++j){
+      pairwiseSpaces[i].intersectSurfaces(pairwiseSpaces[j]);
+    }
+  }
+
+  Model modelWideModel;
+  std::vector<Space> modelWideSpaces = createIntersectTestSpaces(modelWideModel);
+  ASSERT_EQ(6u, modelWideSpaces.size());
+  intersectSurfaces(modelWideSpaces, true);
+
+  EXPECT_LT(36u, pairwiseModel.getModelObjects<Surface>().size());
+  EXPECT_EQ(pairwiseModel.getModelObjects<Surface>().size(), modelWideModel.getModelObjects<Surface>().size());
+  EXPECT_TRUE(intersectTestResults(pairwiseSpaces) == intersectTestResults(modelWideSpaces));
+
+  // all shared walls, floors and ceilings match after intersection
+  matchSurfaces(modelWideSpaces);
+  unsigned numMatched = 0;
+  for (const Surface& surface : modelWideModel.getModelObjects<Surface>()){
+    if (surface.adjacentSurface()){
+      ++numMatched;
+    }
+  }
+  // 2 walls and 2 floors between the one story spaces, 4 walls between them and the two story space, 
+  // and 3 ceilings below the top space, each counted from both sides
+  EXPECT_EQ(2u*(2u + 4u + 2u + 3u), numMatched);
+}
+
+TEST_F(ModelFixture, Space_Intersect_ParallelLogMessages)
+{
+  // messages from intersections computed on worker threads are only logged if the intersection is used,
+  // so the same messages are logged as when computing in serial
+  std::vector<std::string> serialMessages;
+  {
+    Model model;
+    std::vector<Space> spaces = createIntersectTestSpaces(model);
+    StringStreamLogSink sink;
+    sink.setLogLevel(Info);
+    intersectSurfaces(spaces, false);
+    serialMessages = intersectTestLogMessages(sink);
+  }
+
+  std::vector<std::string> parallelMessages;
+  {
+    Model model;
+    std::vector<Space> spaces = createIntersectTestSpaces(model);
+    StringStreamLogSink sink;
+    sink.setLogLevel(Info);
+    intersectSurfaces(spaces, true);
+    parallelMessages = intersectTestLogMessages(sink);
+  }
+
+  EXPECT_FALSE(serialMessages.empty());
+  EXPECT_EQ(serialMessages, parallelMessages);
+}
+
 TEST_F(ModelFixture, Space_FindSurfaces)
 {
   Model model;
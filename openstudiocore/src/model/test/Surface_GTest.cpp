@@ -86,6 +86,8 @@
 #include <boost/algorithm/string/case_conv.hpp>
 #include <boost/math/constants/constants.hpp>
 
+#include <algorithm>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using std::string;
@@ -3388,3 +3390,70 @@ TEST_F(ModelFixture, Surface_Intersect_OneToFour){
     }
   }
 }
+
+TEST_F(ModelFixture, Surface_VertexFieldsFollowSetVertices)
+{
+  Model model;
+
+  Point3dVector vertices;
+  vertices.push_back(Point3d(0, 0, 3));
+  vertices.push_back(Point3d(0, 0, 0));
+  vertices.push_back(Point3d(10, 0, 0));
+  vertices.push_back(Point3d(10, 0, 3));
+  Surface surface(vertices, model);
+
+  // read the vertex fields twice, so the second read comes from the parsed field values
+  for (unsigned i = 0; i < 2; ++i) {
+    std::vector<IdfExtensibleGroup> groups = surface.extensibleGroups();
+    ASSERT_EQ(4u, groups.size());
+    EXPECT_DOUBLE_EQ(10.0, groups[2].getDouble(0).get());
+    EXPECT_DOUBLE_EQ(3.0, groups[3].getDouble(2).get());
+  }
+
+  for (Point3d& vertex : vertices) {
+    vertex = Point3d(vertex.x() + 0.5, vertex.y(), 2.0 * vertex.z());
+  }
+  EXPECT_TRUE(surface.setVertices(vertices));
+
+  std::vector<IdfExtensibleGroup> groups = surface.extensibleGroups();
+  ASSERT_EQ(4u, groups.size());
+  EXPECT_DOUBLE_EQ(10.5, groups[2].getDouble(0).get());
+  EXPECT_DOUBLE_EQ(6.0, groups[3].getDouble(2).get());
+  ASSERT_EQ(4u, surface.vertices().size());
+  EXPECT_DOUBLE_EQ(6.0, surface.vertices()[3].z());
+}
+
+TEST_F(ModelFixture, Surface_BatchEdit)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 1, 0));
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(1, 0, 0));
+  points.push_back(Point3d(1, 1, 0));
+  Surface surface(points, model);
+  EXPECT_DOUBLE_EQ(1.0, surface.grossArea());
+  EXPECT_DOUBLE_EQ(1.0, surface.outwardNormal().z());
+
+  {
+    Workspace::BatchEdit batchEdit(model);
+
+    // cached geometry reflects edits made inside the batch
+    points.clear();
+    points.push_back(Point3d(0, 1, 0));
+    points.push_back(Point3d(0, 0, 0));
+    points.push_back(Point3d(2, 0, 0));
+    points.push_back(Point3d(2, 1, 0));
+    EXPECT_TRUE(surface.setVertices(points));
+    EXPECT_DOUBLE_EQ(2.0, surface.grossArea());
+    EXPECT_EQ(4u, surface.vertices().size());
+
+    std::reverse(points.begin(), points.end());
+    EXPECT_TRUE(surface.setVertices(points));
+    EXPECT_DOUBLE_EQ(-1.0, surface.outwardNormal().z());
+  }
+
+  EXPECT_DOUBLE_EQ(2.0, surface.grossArea());
+  EXPECT_DOUBLE_EQ(-1.0, surface.outwardNormal().z());
+}
@@ -0,0 +1,171 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "FileEventMonitor.hpp"
+
+#include "../../utilities/core/String.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QSocketNotifier>
+
+#ifdef Q_OS_LINUX
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+namespace openstudio {
+namespace runmanager {
+namespace detail {
+
+  FileEventMonitor::FileEventMonitor()
+    : m_fd(-1)
+  {
+  }
+
+  FileEventMonitor::~FileEventMonitor()
+  {
+    stop();
+  }
+
+  bool FileEventMonitor::watch(const QString &t_dir)
+  {
+#ifdef Q_OS_LINUX
+    if (m_fd < 0)
+    {
+      m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+      if (m_fd < 0)
+      {
+        LOG(Info, "Unable to initialize inotify: " << strerror(errno));
+        return false;
+      }
+
+      m_notifier = std::make_shared<QSocketNotifier>(m_fd, QSocketNotifier::Read);
+      connect(m_notifier.get(), &QSocketNotifier::activated, this, &FileEventMonitor::readEvents);
+    }
+
+    QString dir = QDir(t_dir).absolutePath();
+    int wd = inotify_add_watch(m_fd, QFile::encodeName(dir).constData(),
+        IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR);
+
+    if (wd < 0)
+    {
+      LOG(Info, "Unable to watch directory " << toString(dir) << ": " << strerror(errno));
+      return false;
+    }
+
+    m_dirs[wd] = dir;
+    return true;
+#else
+    LOG(Debug, "File events are not supported on this platform, not watching " << toString(t_dir));
+    return false;
+#endif
+  }
+
+  void FileEventMonitor::stop()
+  {
+    m_notifier.reset();
+
+#ifdef Q_OS_LINUX
+    if (m_fd >= 0)
+    {
+      // closing the descriptor removes all of its watches
+      close(m_fd);
+    }
+#endif
+
+    m_fd = -1;
+    m_dirs.clear();
+  }
+
+  bool FileEventMonitor::active() const
+  {
+    return m_fd >= 0 && !m_dirs.empty();
+  }
+
+  void FileEventMonitor::readEvents()
+  {
+#ifdef Q_OS_LINUX
+    alignas(struct inotify_event) char buffer[4096];
+
+    while (m_fd >= 0)
+    {
+      ssize_t len = read(m_fd, buffer, sizeof(buffer));
+
+      if (len <= 0)
+      {
+        // EAGAIN, all queued events have been read
+        break;
+      }
+
+      const char *ptr = buffer;
+      while (ptr < buffer + len)
+      {
+        const struct inotify_event *event = reinterpret_cast<const struct inotify_event *>(ptr);
+        ptr += sizeof(struct inotify_event) + event->len;
+
+        if (event->mask & IN_Q_OVERFLOW)
+        {
+          LOG(Debug, "inotify event queue overflowed");
+          emit overflowed();
+          continue;
+        }
+
+        auto dir = m_dirs.find(event->wd);
+        if (dir == m_dirs.end())
+        {
+          continue;
+        }
+
+        if (event->mask & IN_IGNORED)
+        {
+          // the directory itself was removed
+          m_dirs.erase(dir);
+          continue;
+        }
+
+        if (event->len == 0)
+        {
+          continue;
+        }
+
+        QString path = dir->second + "/" + QFile::decodeName(event->name);
+
+        if (event->mask & IN_ISDIR)
+        {
+          if (event->mask & (IN_CREATE | IN_MOVED_TO))
+          {
+            emit directoryCreated(path);
+          }
+        } else if (event->mask & IN_MODIFY) {
+          emit fileModified(path);
+        } else {
+          emit fileChanged(path);
+        }
+      }
+    }
+#endif
+  }
+
+}
+}
+}
@@ -0,0 +1,92 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef RUNMANAGER_LIB_FILEEVENTMONITOR_HPP
+#define RUNMANAGER_LIB_FILEEVENTMONITOR_HPP
+
+#include "RunManagerAPI.hpp"
+#include "../../utilities/core/Logger.hpp"
+
+#include <QObject>
+#include <QString>
+
+#include <map>
+#include <memory>
+
+class QSocketNotifier;
+
+namespace openstudio {
+namespace runmanager {
+namespace detail {
+
+  /**
+   * Reports files being created, written and removed in a set of directories as it happens, so that
+   * the directories do not need to be rescanned to find out what changed. Only files directly inside
+   * of the watched directories are reported.
+   *
+   * Implemented with inotify on Linux. On other platforms, or when the system is out of inotify
+   * resources, watch() returns false and the caller must fall back to rescanning.
+   */
+  class RUNMANAGER_API FileEventMonitor : public QObject
+  {
+    Q_OBJECT;
+
+    public:
+      FileEventMonitor();
+      virtual ~FileEventMonitor();
+
+      /// Starts watching the given directory
+      /// \returns false if the directory cannot be watched
+      bool watch(const QString &t_dir);
+
+      /// Stops watching all directories
+      void stop();
+
+      /// \returns true if at least one directory is being watched
+      bool active() const;
+
+    signals:
+      /// A file was created, closed after writing, removed or renamed
+      void fileChanged(const QString &t_path);
+
+      /// A file was written to. Emitted for every write, receivers will usually want to batch these up
+      void fileModified(const QString &t_path);
+
+      /// A subdirectory was created in a watched directory
+      void directoryCreated(const QString &t_path);
+
+      /// Events were dropped by the system, the watched directories must be rescanned
+      void overflowed();
+
+    private slots:
+      void readEvents();
+
+    private:
+      REGISTER_LOGGER("openstudio.runmanager.FileEventMonitor");
+
+      int m_fd;
+      std::map<int, QString> m_dirs; //< watched directories by watch descriptor
+      std::shared_ptr<QSocketNotifier> m_notifier;
+  };
+
+}
+}
+}
+
+#endif // RUNMANAGER_LIB_FILEEVENTMONITOR_HPP
@@ -122,6 +122,11 @@ namespace detail {
     
     connect(&m_process, &MyQProcess::stateChanged, this, &LocalProcess::processStateChanged);
 
+    connect(&m_fileEventMonitor, &FileEventMonitor::fileChanged, this, &LocalProcess::fileEvent);
+    connect(&m_fileEventMonitor, &FileEventMonitor::fileModified, this, &LocalProcess::fileModifiedEvent);
+    connect(&m_fileEventMonitor, &FileEventMonitor::directoryCreated, this, &LocalProcess::directoryCreatedEvent);
+    connect(&m_fileEventMonitor, &FileEventMonitor::overflowed, this, static_cast<void (LocalProcess::*)()>(&LocalProcess::directoryChanged));
+
 
     LOG(Debug, "Setting working directory: " << toString(m_outdir));
     m_process.setWorkingDirectory(openstudio::toQString(m_outdir));
@@ -213,12 +218,58 @@ namespace detail {
     directoryChanged(openstudio::toQString(m_outdir));
   }
 
+  void LocalProcess::checkFiles()
+  {
+    if (m_fileEventMonitor.active())
+    {
+      // files being written are only looked at once per tick, not on every write
+      std::set<QString> modifiedFiles;
+      modifiedFiles.swap(m_modifiedFiles);
+
+      for (const auto & modifiedFile : modifiedFiles)
+      {
+        updateOutputFile(modifiedFile);
+      }
+
+      m_process.checkProcessStatus();
+    } else {
+      directoryChanged(openstudio::toQString(m_outdir));
+    }
+  }
+
+  bool LocalProcess::watchOutputDirectories()
+  {
+    if (!m_fileEventMonitor.watch(openstudio::toQString(m_outdir)))
+    {
+      m_fileEventMonitor.stop();
+      return false;
+    }
+
+    QDir subdirs(openstudio::toQString(m_outdir), "mergedjob-*", QDir::Name, QDir::Dirs);
+    for (const auto & mergedjobdir : subdirs.entryInfoList())
+    {
+      if (!m_fileEventMonitor.watch(mergedjobdir.absoluteFilePath()))
+      {
+        m_fileEventMonitor.stop();
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   void LocalProcess::start()
   {
+    // Start watching before scanning, so that no file created in between is missed
+    if (!watchOutputDirectories())
+    {
+      LOG(Debug, "Output files of " << openstudio::toString(m_tool.localBinPath) << " will be found by rescanning " << openstudio::toString(m_outdir));
+    }
+
     directoryChanged(openstudio::toQString(m_outdir));
 
     m_fileCheckTimer.start(2000); // check for updated files every 2 seconds.
-    connect(&m_fileCheckTimer, &QTimer::timeout, this, static_cast<void (LocalProcess::*)()>(&LocalProcess::directoryChanged));
+    connect(&m_fileCheckTimer, &QTimer::timeout, this, &LocalProcess::checkFiles);
     emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Starting));
 
     LOG(Error, "Starting LocalProcess: " << openstudio::toString(m_tool.localBinPath));
@@ -325,7 +376,14 @@ namespace detail {
   std::vector<FileInfo> LocalProcess::outputFiles() const
   {
     QMutexLocker l(&m_mutex);
-    return std::vector<FileInfo>(m_outfiles.begin(), m_outfiles.end());
+    std::vector<FileInfo> ret;
+
+    for (const auto & outfile : m_outfiles)
+    {
+      ret.push_back(outfile.second);
+    }
+
+    return ret;
   }
 
   std::vector<FileInfo> LocalProcess::inputFiles() const
@@ -365,11 +423,22 @@ namespace detail {
 
     {
       QMutexLocker l(&m_mutex);
+      // there is one entry per path in both, so the map is in the same order as the set
+      std::vector<FileInfo> known;
+      for (const auto & outfile : m_outfiles)
+      {
+        known.push_back(outfile.second);
+      }
+
       std::set_symmetric_difference(fs.begin(), fs.end(), 
-          m_outfiles.begin(), m_outfiles.end(),
+          known.begin(), known.end(),
           std::back_inserter(diff));
 
-      m_outfiles = fs;
+      m_outfiles.clear();
+      for (const auto & file : fs)
+      {
+        m_outfiles.insert(m_outfiles.end(), std::make_pair(file.fullPath, file));
+      }
     }
 
     std::for_each(diff.begin(), diff.end(), std::bind(&LocalProcess::emitUpdatedFileInfo, this, std::placeholders::_1));
@@ -377,6 +446,71 @@ namespace detail {
     m_process.checkProcessStatus();
   }
 
+  void LocalProcess::updateOutputFile(const QString &t_path)
+  {
+    QFileInfo qfi(t_path);
+
+    // same filtering as dirFiles()
+    if (qfi.fileName().startsWith(".") || isRequiredFile(qfi.fileName()))
+    {
+      return;
+    }
+
+    FileInfo fi = RunManager_Util::dirFile(qfi);
+    bool changed = false;
+
+    {
+      QMutexLocker l(&m_mutex);
+      auto itr = m_outfiles.find(fi.fullPath);
+
+      if (fi.exists && !qfi.isDir())
+      {
+        if (itr == m_outfiles.end())
+        {
+          m_outfiles.insert(std::make_pair(fi.fullPath, fi));
+          changed = true;
+        } else if (itr->second.lastModified != fi.lastModified) {
+          itr->second = fi;
+          changed = true;
+        }
+      } else if (itr != m_outfiles.end()) {
+        m_outfiles.erase(itr);
+        changed = true;
+      }
+    }
+
+    if (changed)
+    {
+      emitOutputFileChanged(fi);
+    }
+  }
+
+  void LocalProcess::fileEvent(const QString &t_path)
+  {
+    m_modifiedFiles.erase(t_path);
+    updateOutputFile(t_path);
+  }
+
+  void LocalProcess::fileModifiedEvent(const QString &t_path)
+  {
+    m_modifiedFiles.insert(t_path);
+  }
+
+  void LocalProcess::directoryCreatedEvent(const QString &t_path)
+  {
+    if (QFileInfo(t_path).fileName().startsWith("mergedjob-"))
+    {
+      if (!m_fileEventMonitor.watch(t_path))
+      {
+        LOG(Debug, "Unable to watch " << toString(t_path) << ", falling back to rescanning");
+        m_fileEventMonitor.stop();
+      }
+
+      // files may have been created in it before it was watched
+      directoryChanged(openstudio::toQString(m_outdir));
+    }
+  }
+
 
   LocalProcess::FileSet LocalProcess::dirFiles(const QString &dir) const
   {
@@ -404,19 +538,7 @@ namespace detail {
     // Filter out all files that are part of the set of input files. Everything remaining should be an outputfile
     for (const auto & fileInfo : fil)
     {
-      bool partofinput = false;
-      for (const auto & requiredFile : m_requiredFiles)
-      {
-        QString fileName = fileInfo.fileName();
-        QString fileName2 = toQString(requiredFile.second.filename());
-        if (fileName == fileName2)
-        {
-          partofinput = true;
-          break;
-        }
-      }
-
-      if (!partofinput)
+      if (!isRequiredFile(fileInfo.fileName()))
       {
         filtered.push_back(fileInfo);
       }
@@ -436,6 +558,19 @@ namespace detail {
     return out;
   }
 
+  bool LocalProcess::isRequiredFile(const QString &t_fileName) const
+  {
+    for (const auto & requiredFile : m_requiredFiles)
+    {
+      if (t_fileName == toQString(requiredFile.second.filename()))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
   void LocalProcess::cleanUpRequiredFiles()
   {
     for (const auto & copiedRequiredFile : m_copiedRequiredFiles)
@@ -467,6 +602,7 @@ namespace detail {
   void LocalProcess::processZombied(QProcess::ProcessError /*t_e*/)
   {
     m_fileCheckTimer.stop();
+    m_fileEventMonitor.stop();
 
     LOG(Info, "Process appears to be zombied"); 
 
@@ -484,6 +620,7 @@ namespace detail {
   void LocalProcess::processError(QProcess::ProcessError t_e)
   {
     m_fileCheckTimer.stop();
+    m_fileEventMonitor.stop();
     QFileInfo qfi(toQString(m_tool.localBinPath));
     QFileInfo outdirfi(toQString(m_outdir));
     LOG(Error, "LocalProcess processError: " << t_e 
@@ -528,6 +665,7 @@ namespace detail {
   {
     LOG(Debug, "processFinished: " << t_exitCode << " " << t_exitStatus);
     m_fileCheckTimer.stop();
+    m_fileEventMonitor.stop();
 
     directoryChanged(openstudio::toQString(m_outdir));
     emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Finishing));
@@ -548,7 +686,7 @@ namespace detail {
 
   void LocalProcess::processReadyReadStandardError()
   {
-    directoryChanged(openstudio::toQString(m_outdir));
+    checkFiles();
 
     if (!stopped())
     {
@@ -558,7 +696,7 @@ namespace detail {
 
   void LocalProcess::processReadyReadStandardOutput()
   {
-    directoryChanged(openstudio::toQString(m_outdir));
+    checkFiles();
     if (!stopped())
     {
       handleOutput(m_process.readAllStandardOutput(), false);
@@ -570,7 +708,7 @@ namespace detail {
     // Send stdin input meant for process
     emitStatusChanged(AdvancedStatus(AdvancedStatusEnum::Processing));
     emit started();
-    directoryChanged(openstudio::toQString(m_outdir));
+    checkFiles();
 
     // If there is stdin to write and the process has not already finished by the time we process
     // this signal...
@@ -25,6 +25,7 @@
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/Path.hpp"
 #include "Job_Impl.hpp"
+#include "FileEventMonitor.hpp"
 #include "../../energyplus/ErrorFile.hpp"
 
 #include <QProcess>
@@ -113,6 +114,16 @@ namespace detail {
       /// used to determine when files have changed
       FileSet dirFiles(const QString &dir) const;
 
+      /// \returns true if the file name is one of the required files, which are not output files
+      bool isRequiredFile(const QString &t_fileName) const;
+
+      /// Starts watching the output directory and merged job subdirectories for file events
+      /// \returns false if they cannot be watched and must be rescanned instead
+      bool watchOutputDirectories();
+
+      /// Updates the known output files from the current state of a single file
+      void updateOutputFile(const QString &t_path);
+
       static void kill(QProcess &t_process, bool t_force); //< Does an appropriate process tree kill on Windows
 
       static std::set<openstudio::path> copyRequiredFiles(const ToolInfo &t_tool, const std::vector<std::pair<openstudio::path, openstudio::path> > &t_requiredFiles, 
@@ -129,8 +140,15 @@ namespace detail {
       /// Set of files that have been copied into place because they were required and can be deleted after the process has completed
       const std::set<openstudio::path> m_copiedRequiredFiles;
 
-      /// List of files that are known about.
-      FileSet m_outfiles;
+      /// Files that are known about, by full path.
+      std::map<openstudio::path, FileInfo> m_outfiles;
+
+      /// Reports changes to the output files while the process runs, so the output directory does not need
+      /// to be rescanned. Not active if file events are not available, see FileEventMonitor.
+      FileEventMonitor m_fileEventMonitor;
+
+      /// Files written to since the last fileCheckTimer tick. Only used from this object's thread.
+      std::set<QString> m_modifiedFiles;
 
       /// QProcess used to monitor the execution of the process.
       MyQProcess m_process;
@@ -166,9 +184,21 @@ namespace detail {
       /// connected to QFilesystemWatcher::directoryChanged
       void directoryChanged(const QString& d);
 
-      /// connected to fileCheckTimer
+      /// connected to FileEventMonitor::overflowed, rescans the output directory
       void directoryChanged();
 
+      /// connected to fileCheckTimer
+      void checkFiles();
+
+      /// connected to FileEventMonitor::fileChanged
+      void fileEvent(const QString &t_path);
+
+      /// connected to FileEventMonitor::fileModified
+      void fileModifiedEvent(const QString &t_path);
+
+      /// connected to FileEventMonitor::directoryCreated
+      void directoryCreatedEvent(const QString &t_path);
+
       /// connected to QFilesystemWatcher::fileChanged
       void fileChanged(const QString& d);
 
@@ -1440,9 +1440,8 @@ namespace detail {
       m_workPending(false), m_paused(t_paused), m_continue(true),
       m_localProcessCreator(new LocalProcessCreator()),
       m_temporaryDB(t_temporaryDB),
-      m_lastRunning(0),
-      m_lastRunningLocally(0),
-      m_lastStatistics(QDateTime::currentDateTime())
+      m_nextSequence(0),
+      m_lastRescan(QDateTime::currentDateTime())
   {
     if (!t_initui && t_useStatusGUI)
     {
@@ -1497,6 +1496,7 @@ namespace detail {
     QMutexLocker lock(&m_mutex);
     std::deque<Job> q = m_queue;
     m_queue.clear();
+    clearScheduledJobs();
     for (auto & job : q)
     {
       job.setCanceled(true);
@@ -2088,6 +2088,7 @@ namespace detail {
       // create the corresponding QStandardItem model object
       job.setIndex(m_queue.size());
       m_queue.push_back(job);
+      scheduleJob(job);
 
       if (!parent && m_useStatusGUI)
       {
@@ -2101,12 +2102,9 @@ namespace detail {
         m_model.appendRow(cols);
       }
 
-      if (!parent)
-      {
-        // is a top-level job, add connection for changes
-        job.connect(SIGNAL(treeChanged(const openstudio::UUID &)), this,
-            SLOT(treeStateChanged(const openstudio::UUID &)), Qt::QueuedConnection);
-      }
+      // every change to a job can change what is runnable, add connection for changes
+      job.connect(SIGNAL(treeChanged(const openstudio::UUID &)), this,
+          SLOT(treeStateChanged(const openstudio::UUID &)), Qt::QueuedConnection);
 
       job.connect(SIGNAL(finishedExt(const openstudio::UUID &, const openstudio::runmanager::JobErrors &, const openstudio::DateTime &, const std::vector<openstudio::runmanager::FileInfo> &)), this,
           SLOT(jobFinished(const openstudio::UUID &, const openstudio::runmanager::JobErrors &, const openstudio::DateTime &, const std::vector<openstudio::runmanager::FileInfo> &)), Qt::QueuedConnection);
@@ -2196,6 +2194,8 @@ namespace detail {
       m_queue.erase(itr);
     }
 
+    unscheduleJob(job);
+
     WorkflowItem *item = getWorkflowItem(job);
 
     if (item)
@@ -2216,8 +2216,60 @@ namespace detail {
   }
 
 
-  void RunManager_Impl::treeStateChanged(const openstudio::UUID &)
+  void RunManager_Impl::treeStateChanged(const openstudio::UUID &t_uuid)
   {
+    QMutexLocker lock(&m_mutex);
+
+    ScheduledJob *scheduledJob = findScheduledJob(t_uuid);
+
+    if (scheduledJob)
+    {
+      Job job = scheduledJob->job;
+
+      if (job.running())
+      {
+        m_runningJobs.insert(std::make_pair(t_uuid, job));
+      } else {
+        m_runningJobs.erase(t_uuid);
+      }
+
+      // Whatever changed may change the runnable state of this job, of its children and finished job,
+      // which wait on it, and of the finished jobs of its ancestors, which wait on their whole trees
+      markReady(job);
+
+      for (const auto & child : job.children())
+      {
+        markReady(child);
+      }
+
+      if (job.finishedJob())
+      {
+        markReady(*job.finishedJob());
+      }
+
+      updateJobStatistics(*scheduledJob);
+
+      for (boost::optional<Job> parent = job.parent(); parent; parent = parent->parent())
+      {
+        if (parent->finishedJob())
+        {
+          markReady(*parent->finishedJob());
+        }
+
+        if (!parent->parent())
+        {
+          // the top level job counts the running workflows
+          ScheduledJob *topLevelJob = findScheduledJob(parent->uuid());
+          if (topLevelJob)
+          {
+            updateJobStatistics(*topLevelJob);
+          }
+        }
+      }
+    }
+
+    lock.unlock();
+
     processQueue();
   }
 
@@ -2383,6 +2435,7 @@ namespace detail {
       itr->setIndex(toswapindex);
       toswap->setIndex(itrindex);
 
+      swapScheduledOrder(*itr, *toswap);
       std::swap(*itr, *toswap);
     }
 
@@ -2442,6 +2495,7 @@ namespace detail {
         itr->setIndex(toswapindex);
         toswap->setIndex(itrindex);
 
+        swapScheduledOrder(*itr, *toswap);
         std::swap(*itr, *toswap);
       }
     }
@@ -2520,75 +2574,207 @@ namespace detail {
     m_waitCondition.wakeAll();
   }
 
-  std::map<std::string, double> RunManager_Impl::generateStatistics(const std::deque<runmanager::Job> &t_jobs)
+  RunManager_Impl::JobStatistics::JobStatistics()
+    : workflows(0), runningWorkflows(0), runningJobs(0), completedJobs(0), failedJobs(0),
+      successfulJobs(0), totalErrors(0), totalWarnings(0), secondsJobsRunning(0)
+  {
+  }
+
+  RunManager_Impl::JobStatistics &RunManager_Impl::JobStatistics::operator+=(const JobStatistics &t_other)
   {
-    int locallyrunningjobs = 0;
-    int runningjobs = 0;
-    int runningworkflows = 0;
-    int secondsjobsrunning = 0;
-    int totaljobs = 0;
-    int totalworkflows = 0;
-    int completedjobs = 0;
-    int totalwarnings = 0;
-    int totalerrors = 0;
-    int failedjobs = 0;
-    int successfuljobs = 0;
+    workflows += t_other.workflows;
+    runningWorkflows += t_other.runningWorkflows;
+    runningJobs += t_other.runningJobs;
+    completedJobs += t_other.completedJobs;
+    failedJobs += t_other.failedJobs;
+    successfulJobs += t_other.successfulJobs;
+    totalErrors += t_other.totalErrors;
+    totalWarnings += t_other.totalWarnings;
+    secondsJobsRunning += t_other.secondsJobsRunning;
+    return *this;
+  }
 
-    for (const auto & job : t_jobs)
+  RunManager_Impl::JobStatistics &RunManager_Impl::JobStatistics::operator-=(const JobStatistics &t_other)
+  {
+    workflows -= t_other.workflows;
+    runningWorkflows -= t_other.runningWorkflows;
+    runningJobs -= t_other.runningJobs;
+    completedJobs -= t_other.completedJobs;
+    failedJobs -= t_other.failedJobs;
+    successfulJobs -= t_other.successfulJobs;
+    totalErrors -= t_other.totalErrors;
+    totalWarnings -= t_other.totalWarnings;
+    secondsJobsRunning -= t_other.secondsJobsRunning;
+    return *this;
+  }
+
+  RunManager_Impl::ScheduledJob::ScheduledJob(const Job &t_job, unsigned long long t_sequence)
+    : job(t_job), sequence(t_sequence)
+  {
+  }
+
+  RunManager_Impl::JobStatistics RunManager_Impl::jobStatistics(const Job &t_job)
+  {
+    JobStatistics stats;
+
+    if (!t_job.parent())
     {
-      ++totaljobs;
-      if (!job.parent())
+      ++stats.workflows;
+      if (t_job.childrenRunning())
+      {
+        ++stats.runningWorkflows;
+      }
+    }
+
+    if (t_job.running())
+    {
+      ++stats.runningJobs;
+    } else {
+      boost::optional<openstudio::DateTime> start = t_job.startTime();
+      boost::optional<openstudio::DateTime> end = t_job.endTime();
+      if (end && start
+          && *end >= *start)
       {
-        ++totalworkflows;
-        if (job.childrenRunning())
+        ++stats.completedJobs;
+
+        openstudio::runmanager::JobErrors errors = t_job.errors();
+        if (errors.result != ruleset::OSResultValue::Fail)
         {
-          ++runningworkflows;
+          ++stats.successfulJobs;
+        } else {
+          ++stats.failedJobs;
         }
+
+        stats.totalErrors += errors.errors().size();
+        stats.totalWarnings += errors.warnings().size();
+
+        stats.secondsJobsRunning += (*end - *start).totalSeconds();
       }
+    }
 
+    return stats;
+  }
 
-      if (job.running())
-      {
-        ++locallyrunningjobs;
-        ++runningjobs;
-      } else {
-        boost::optional<openstudio::DateTime> start = job.startTime();
-        boost::optional<openstudio::DateTime> end = job.endTime();
-        if (end && start
-            && *end >= *start)
-        {
-          ++completedjobs;
+  std::map<std::string, double> RunManager_Impl::statisticsMap(const JobStatistics &t_totals, int t_numJobs)
+  {
+    std::map<std::string, double> stats;
+    stats["Total Errors"] = t_totals.totalErrors;
+    stats["Total Warnings"] = t_totals.totalWarnings;
+    stats["Number of Jobs"] = t_numJobs;
+    stats["Number of Workflows"] = t_totals.workflows;
+    stats["Running Jobs"] = t_totals.runningJobs;
+    stats["Running Workflows"] = t_totals.runningWorkflows;
+    stats["Average Time to Complete Job"] = double(t_totals.secondsJobsRunning) / double(t_totals.completedJobs);
+    stats["Completed Jobs"] = t_totals.completedJobs;
+    stats["Failed Jobs"] = t_totals.failedJobs;
+    stats["Successful Jobs"] = t_totals.successfulJobs;
+    stats["Locally Running Jobs"] = t_totals.runningJobs;
 
-          openstudio::runmanager::JobErrors errors = job.errors();
-          if (errors.result != ruleset::OSResultValue::Fail)
-          {
-            ++successfuljobs;
-          } else {
-            ++failedjobs;
-          }
+    return stats;
+  }
 
-          totalerrors += errors.errors().size();
-          totalwarnings += errors.warnings().size();
+  RunManager_Impl::ScheduledJob *RunManager_Impl::findScheduledJob(const openstudio::UUID &t_uuid)
+  {
+    auto itr = m_scheduledJobs.find(t_uuid);
 
-          secondsjobsrunning += (*end - *start).totalSeconds();
+    if (itr == m_scheduledJobs.end())
+    {
+      // updateJob() may have given a queued job a new uuid, rekey any that have changed
+      std::vector<std::pair<openstudio::UUID, ScheduledJob> > changed;
+      for (auto scheduled = m_scheduledJobs.begin(); scheduled != m_scheduledJobs.end();)
+      {
+        if (scheduled->first != scheduled->second.job.uuid())
+        {
+          changed.push_back(std::make_pair(scheduled->second.job.uuid(), scheduled->second));
+          m_runningJobs.erase(scheduled->first);
+          scheduled = m_scheduledJobs.erase(scheduled);
+        } else {
+          ++scheduled;
         }
       }
+
+      m_scheduledJobs.insert(changed.begin(), changed.end());
+      itr = m_scheduledJobs.find(t_uuid);
     }
 
-    std::map<std::string, double> stats;
-    stats["Total Errors"] = totalerrors;
-    stats["Total Warnings"] = totalwarnings;
-    stats["Number of Jobs"] = totaljobs;
-    stats["Number of Workflows"] = totalworkflows;
-    stats["Running Jobs"] = runningjobs;
-    stats["Running Workflows"] = runningworkflows;
-    stats["Average Time to Complete Job"] = double(secondsjobsrunning) / double(completedjobs);
-    stats["Completed Jobs"] = completedjobs;
-    stats["Failed Jobs"] = failedjobs;
-    stats["Successful Jobs"] = successfuljobs;
-    stats["Locally Running Jobs"] = locallyrunningjobs;
+    if (itr != m_scheduledJobs.end())
+    {
+      return &itr->second;
+    }
 
-    return stats;
+    return nullptr;
+  }
+
+  void RunManager_Impl::scheduleJob(const Job &t_job)
+  {
+    auto itr = m_scheduledJobs.insert(std::make_pair(t_job.uuid(), ScheduledJob(t_job, m_nextSequence++))).first;
+    updateJobStatistics(itr->second);
+    m_readyJobs.insert(std::make_pair(itr->second.sequence, t_job));
+  }
+
+  void RunManager_Impl::unscheduleJob(const Job &t_job)
+  {
+    auto itr = m_scheduledJobs.find(t_job.uuid());
+
+    if (itr != m_scheduledJobs.end())
+    {
+      m_statisticsTotals -= itr->second.statistics;
+      m_readyJobs.erase(itr->second.sequence);
+      m_scheduledJobs.erase(itr);
+    }
+
+    m_runningJobs.erase(t_job.uuid());
+  }
+
+  void RunManager_Impl::clearScheduledJobs()
+  {
+    m_scheduledJobs.clear();
+    m_readyJobs.clear();
+    m_runningJobs.clear();
+    m_statisticsTotals = JobStatistics();
+  }
+
+  void RunManager_Impl::markReady(const Job &t_job)
+  {
+    auto itr = m_scheduledJobs.find(t_job.uuid());
+
+    if (itr != m_scheduledJobs.end())
+    {
+      m_readyJobs.insert(std::make_pair(itr->second.sequence, itr->second.job));
+    }
+  }
+
+  void RunManager_Impl::updateJobStatistics(ScheduledJob &t_scheduledJob)
+  {
+    m_statisticsTotals -= t_scheduledJob.statistics;
+    t_scheduledJob.statistics = jobStatistics(t_scheduledJob.job);
+    m_statisticsTotals += t_scheduledJob.statistics;
+  }
+
+  void RunManager_Impl::swapScheduledOrder(const Job &t_lhs, const Job &t_rhs)
+  {
+    auto lhs = m_scheduledJobs.find(t_lhs.uuid());
+    auto rhs = m_scheduledJobs.find(t_rhs.uuid());
+
+    if (lhs == m_scheduledJobs.end() || rhs == m_scheduledJobs.end())
+    {
+      return;
+    }
+
+    bool lhsReady = m_readyJobs.erase(lhs->second.sequence) > 0;
+    bool rhsReady = m_readyJobs.erase(rhs->second.sequence) > 0;
+
+    std::swap(lhs->second.sequence, rhs->second.sequence);
+
+    if (lhsReady)
+    {
+      m_readyJobs.insert(std::make_pair(lhs->second.sequence, lhs->second.job));
+    }
+
+    if (rhsReady)
+    {
+      m_readyJobs.insert(std::make_pair(rhs->second.sequence, rhs->second.job));
+    }
   }
 
   std::map<std::string, double> RunManager_Impl::statistics() const
@@ -2720,6 +2906,7 @@ namespace detail {
 
     std::deque<Job> q = m_queue;
     m_queue.clear();
+    clearScheduledJobs();
     for (auto & job : q)
     {
       job.setCanceled(true);
@@ -2745,6 +2932,11 @@ namespace detail {
 
   void RunManager_Impl::run()
   {
+    // Jobs found not runnable are only checked again when a job they depend on signals a change.
+    // Every queued job is rechecked this often to pick up changes that are not signaled, such as
+    // input files modified on disk.
+    const int rescanSeconds = 30;
+
     while (getContinue())
     {
       //openstudio::Application::instance().processEvents(1);
@@ -2760,88 +2952,84 @@ namespace detail {
 
       //LOG(Info, boost::posix_time::microsec_clock::local_time() << " kicking off new jobs ");
 
-      bool statschanged = false;
-      std::map<std::string, double> oldstats = m_statistics;
-
-      if (!m_paused && !m_processingQueue && m_continue)
+      if (m_lastRescan.addSecs(rescanSeconds) < QDateTime::currentDateTime())
       {
-        std::deque<openstudio::runmanager::Job> queue(m_queue);
-
+        for (const auto & scheduledJob : m_scheduledJobs)
+        {
+          m_readyJobs.insert(std::make_pair(scheduledJob.second.sequence, scheduledJob.second.job));
+        }
 
-        lock.unlock();
+        m_lastRescan = QDateTime::currentDateTime();
+      }
 
+      if (!m_paused && !m_processingQueue && m_continue)
+      {
         m_processingQueue = true;
 
+        // drop the jobs that have finished since the last pass
+        for (auto itr = m_runningJobs.begin(); itr != m_runningJobs.end();)
+        {
+          if (!itr->second.running())
+          {
+            itr = m_runningJobs.erase(itr);
+          } else {
+            ++itr;
+          }
+        }
 
-        int running = std::count_if(queue.begin(), queue.end(), std::bind(&openstudio::runmanager::Job::running, std::placeholders::_1));
-        int runningLocally = running;
-
-        auto itr = queue.begin();
-        auto end = queue.end();
-
+        int runningLocally = static_cast<int>(m_runningJobs.size());
 
         ConfigOptions config = getConfigOptions();
 
         const int maxlocaljobs = config.getMaxLocalJobs();
 
-        // Make sure we have as many running as we should have
-        while ((runningLocally < maxlocaljobs) && itr != end)
+        // Make sure we have as many running as we should have, in queue order. Jobs that are not
+        // reached stay ready for the next pass.
+        while ((runningLocally < maxlocaljobs) && !m_readyJobs.empty())
         {
-          boost::optional<Job> parent = itr->parent();
+          Job job = m_readyJobs.begin()->second;
+          m_readyJobs.erase(m_readyJobs.begin());
 
-          if (itr->runnable())
+          lock.unlock();
+
+          bool started = false;
+          if (job.runnable())
           {
-            LOG(Info, "Starting job locally: " << toString(itr->uuid()) << " " << itr->description() );
-            itr->start(m_localProcessCreator);
-            ++runningLocally;
+            LOG(Info, "Starting job locally: " << toString(job.uuid()) << " " << job.description() );
+            job.start(m_localProcessCreator);
+            started = true;
           }
 
-          ++itr;
-        }
-
-
-        if ((running != m_lastRunning
-             || runningLocally != m_lastRunningLocally)
-            && m_lastStatistics.addSecs(1) < QDateTime::currentDateTime())
-        {
-          std::map<std::string, double> stats = generateStatistics(queue);
-
+          lock.relock();
 
-          if (stats != oldstats)
+          if (started)
           {
-            statschanged = true;
+            m_runningJobs.insert(std::make_pair(job.uuid(), job));
+            ++runningLocally;
           }
-
-          m_lastRunning = running;
-          m_lastRunningLocally = runningLocally;
-          m_lastStatistics = QDateTime::currentDateTime();
-
-          lock.relock();
-          m_statistics = stats;
-          lock.unlock();
         }
 
-
         m_processingQueue = false;
+      }
 
-      } else {
-        std::deque<openstudio::runmanager::Job> queue(m_queue);
-
-        lock.unlock();
-
-        std::map<std::string, double> stats = generateStatistics(queue);
-
-        if (stats != oldstats)
-        {
-          statschanged = true;
-        }
+      bool statschanged = false;
+      std::map<std::string, double> stats = statisticsMap(m_statisticsTotals, static_cast<int>(m_scheduledJobs.size()));
 
+      // the average time is NaN until a job completes, which must not count as a change
+      auto sameStatistic = [](const std::pair<const std::string, double> &t_lhs, const std::pair<const std::string, double> &t_rhs) {
+        return t_lhs.first == t_rhs.first
+          && (t_lhs.second == t_rhs.second || (t_lhs.second != t_lhs.second && t_rhs.second != t_rhs.second));
+      };
 
-        lock.relock();
+      if (stats.size() != m_statistics.size()
+          || !std::equal(stats.begin(), stats.end(), m_statistics.begin(), sameStatistic))
+      {
+        statschanged = true;
         m_statistics = stats;
-        lock.unlock();
       }
 
+      lock.unlock();
+
       if (statschanged)
       {
         emit statsChanged();
@@ -268,8 +268,62 @@ namespace detail {
 
       static bool jobIndexLessThan(const Job& lhs, const Job &rhs);
 
-      /// Generates and returns the statistics from a deque of jobs
-      static std::map<std::string, double> generateStatistics(const std::deque<runmanager::Job> &t_jobs);
+      /// Contribution of a single job to the statistics reported by statistics()
+      struct JobStatistics
+      {
+        JobStatistics();
+
+        JobStatistics &operator+=(const JobStatistics &t_other);
+        JobStatistics &operator-=(const JobStatistics &t_other);
+
+        int workflows;
+        int runningWorkflows;
+        int runningJobs;
+        int completedJobs;
+        int failedJobs;
+        int successfulJobs;
+        int totalErrors;
+        int totalWarnings;
+        int secondsJobsRunning;
+      };
+
+      /// Scheduling state of a job in the queue
+      struct ScheduledJob
+      {
+        ScheduledJob(const Job &t_job, unsigned long long t_sequence);
+
+        Job job;
+        unsigned long long sequence; //< position in dispatch order, swapped along with m_queue by raise/lowerPriority
+        JobStatistics statistics; //< this job's share of m_statisticsTotals
+      };
+
+      /// Returns the statistics contribution of a single job
+      static JobStatistics jobStatistics(const Job &t_job);
+
+      /// Converts statistics totals to the map returned by statistics()
+      static std::map<std::string, double> statisticsMap(const JobStatistics &t_totals, int t_numJobs);
+
+      /// Returns the scheduling state for the job with the given uuid, or 0 if it is not queued.
+      /// m_mutex must be held.
+      ScheduledJob *findScheduledJob(const openstudio::UUID &t_uuid);
+
+      /// Adds a newly queued job to the scheduler and marks it ready. m_mutex must be held.
+      void scheduleJob(const Job &t_job);
+
+      /// Removes a job from the scheduler. m_mutex must be held.
+      void unscheduleJob(const Job &t_job);
+
+      /// Removes all jobs from the scheduler. m_mutex must be held.
+      void clearScheduledJobs();
+
+      /// Marks a queued job as needing its runnable() state checked on the next pass. m_mutex must be held.
+      void markReady(const Job &t_job);
+
+      /// Recomputes the statistics contribution of a queued job. m_mutex must be held.
+      void updateJobStatistics(ScheduledJob &t_scheduledJob);
+
+      /// Swaps the dispatch order of two queued jobs. m_mutex must be held.
+      void swapScheduledOrder(const Job &t_lhs, const Job &t_rhs);
 
       /// Returns the WorkflowItem pointer for the given job, or 0 if it does not exist
       WorkflowItem *getWorkflowItem(const Job &t_job) const;
@@ -305,9 +359,17 @@ namespace detail {
 
       bool m_temporaryDB;
 
-      int m_lastRunning;
-      int m_lastRunningLocally;
-      QDateTime m_lastStatistics;
+      /// Scheduler state. Jobs are only evaluated by run() when they are in m_readyJobs, which is
+      /// filled in from job state change notifications; jobs that were found not runnable stay
+      /// blocked until something they depend on changes.
+      std::map<openstudio::UUID, ScheduledJob> m_scheduledJobs;
+      std::map<unsigned long long, openstudio::runmanager::Job> m_readyJobs; //< keyed by ScheduledJob::sequence
+      std::map<openstudio::UUID, openstudio::runmanager::Job> m_runningJobs;
+      unsigned long long m_nextSequence;
+      JobStatistics m_statisticsTotals;
+
+      /// Last time all blocked jobs were rechecked, see run()
+      QDateTime m_lastRescan;
 
 
       /// Debugging tool for printing the current queue to standard out
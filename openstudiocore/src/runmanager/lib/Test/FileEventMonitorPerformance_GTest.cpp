@@ -0,0 +1,131 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+#include "../FileEventMonitor.hpp"
+#include "../RunManager_Util.hpp"
+
+#include "../../../utilities/core/Application.hpp"
+#include "../../../utilities/core/Path.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/timer.hpp>
+
+#include <QDir>
+#include <QFile>
+
+using namespace openstudio;
+using namespace openstudio::runmanager;
+
+namespace {
+  void touchFile(const QString &t_path, int t_tick)
+  {
+    QFile f(t_path);
+    if (f.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+      f.write(QByteArray::number(t_tick) + "\n");
+    }
+  }
+}
+
+// Compares the CPU time spent keeping track of the output files of many concurrently running jobs by
+// rescanning their output directories against following file events. Only logs the times, which
+// depend on the machine and its load.
+TEST_F(RunManagerTestFixture, FileEventMonitorPerformanceTest)
+{
+  const int numJobs = 32;
+  const int numFiles = 100;
+  const int numTicks = 20;
+
+  openstudio::path base = openstudio::tempDir() / openstudio::toPath("FileEventMonitorPerformance");
+  boost::filesystem::remove_all(base);
+
+  std::vector<QString> dirs;
+  for (int i = 0; i < numJobs; ++i)
+  {
+    openstudio::path dir = base / openstudio::toPath(QString::number(i));
+    boost::filesystem::create_directories(dir);
+    dirs.push_back(QDir(openstudio::toQString(dir)).absolutePath());
+
+    for (int j = 0; j < numFiles; ++j)
+    {
+      touchFile(dirs.back() + "/output" + QString::number(j) + ".txt", 0);
+    }
+  }
+
+  std::vector<std::shared_ptr<detail::FileEventMonitor> > monitors;
+  int events = 0;
+  for (const auto & dir : dirs)
+  {
+    std::shared_ptr<detail::FileEventMonitor> monitor = std::make_shared<detail::FileEventMonitor>();
+    if (!monitor->watch(dir))
+    {
+      LOG(Info, "File events are not available, not comparing with rescanning");
+      return;
+    }
+    QObject::connect(monitor.get(), &detail::FileEventMonitor::fileChanged, [&events](const QString &t_path) {
+      RunManager_Util::dirFile(QFileInfo(t_path));
+      ++events;
+    });
+    monitors.push_back(monitor);
+  }
+
+  // with file events, only the files that were written are looked at
+  boost::timer t;
+  for (int tick = 0; tick < numTicks; ++tick)
+  {
+    for (const auto & dir : dirs)
+    {
+      touchFile(dir + "/eplusout.err", tick);
+    }
+    openstudio::Application::instance().processEvents(10);
+  }
+  openstudio::Application::instance().processEvents(100);
+  double eventTime = t.elapsed();
+
+  for (auto & monitor : monitors)
+  {
+    monitor->stop();
+  }
+
+  // rescanning lists and stats every file of every job on every tick
+  t.restart();
+  size_t found = 0;
+  for (int tick = 0; tick < numTicks; ++tick)
+  {
+    for (const auto & dir : dirs)
+    {
+      touchFile(dir + "/eplusout.err", tick);
+      QDir d(dir, "", QDir::Name, QDir::Files);
+      for (const auto & fileInfo : d.entryInfoList())
+      {
+        RunManager_Util::dirFile(fileInfo);
+        ++found;
+      }
+    }
+    openstudio::Application::instance().processEvents(10);
+  }
+  double rescanTime = t.elapsed();
+
+  LOG(Info, "Tracking " << numJobs << " jobs of " << numFiles << " files for " << numTicks << " ticks, CPU seconds with file events: "
+      << eventTime << " (" << events << " events) rescanning: " << rescanTime << " (" << found << " files)");
+
+  boost::filesystem::remove_all(base);
+}
@@ -0,0 +1,143 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+#include "../FileEventMonitor.hpp"
+
+#include "../../../utilities/core/Application.hpp"
+#include "../../../utilities/core/Path.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+
+#include <QDir>
+#include <QFile>
+
+using namespace openstudio;
+using namespace openstudio::runmanager;
+
+namespace {
+  bool waitForPath(const std::vector<QString> &t_paths, const QString &t_path)
+  {
+    for (int i = 0; i < 100; ++i)
+    {
+      if (std::find(t_paths.begin(), t_paths.end(), t_path) != t_paths.end())
+      {
+        return true;
+      }
+      openstudio::Application::instance().processEvents(10);
+    }
+    return false;
+  }
+}
+
+TEST_F(RunManagerTestFixture, FileEventMonitor)
+{
+  openstudio::path dir = openstudio::tempDir() / openstudio::toPath("FileEventMonitor");
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+  QString qdir = QDir(openstudio::toQString(dir)).absolutePath();
+
+  detail::FileEventMonitor monitor;
+  if (!monitor.watch(qdir))
+  {
+    LOG(Info, "File events are not available, LocalProcess rescans output directories instead");
+    EXPECT_FALSE(monitor.active());
+    return;
+  }
+
+  EXPECT_TRUE(monitor.active());
+
+  std::vector<QString> changed;
+  std::vector<QString> modified;
+  std::vector<QString> dirs;
+  QObject::connect(&monitor, &detail::FileEventMonitor::fileChanged, [&changed](const QString &t_path) { changed.push_back(t_path); });
+  QObject::connect(&monitor, &detail::FileEventMonitor::fileModified, [&modified](const QString &t_path) { modified.push_back(t_path); });
+  QObject::connect(&monitor, &detail::FileEventMonitor::directoryCreated, [&dirs](const QString &t_path) { dirs.push_back(t_path); });
+
+  QString file = qdir + "/eplusout.err";
+  {
+    QFile f(file);
+    ASSERT_TRUE(f.open(QIODevice::WriteOnly));
+    f.write("Program Version,EnergyPlus\n");
+  }
+
+  EXPECT_TRUE(waitForPath(changed, file));
+  EXPECT_TRUE(waitForPath(modified, file));
+
+  QString subdir = qdir + "/mergedjob-0";
+  ASSERT_TRUE(QDir(qdir).mkdir("mergedjob-0"));
+  EXPECT_TRUE(waitForPath(dirs, subdir));
+
+  changed.clear();
+  ASSERT_TRUE(QFile::remove(file));
+  EXPECT_TRUE(waitForPath(changed, file));
+
+  monitor.stop();
+  EXPECT_FALSE(monitor.active());
+}
+
+TEST_F(RunManagerTestFixture, FileEventMonitor_OnlyWrittenFiles)
+{
+  // LocalProcess only looks at the files it gets events for, instead of rescanning every file in the directory
+  const int numFiles = 50;
+  const int numWrites = 5;
+
+  openstudio::path dir = openstudio::tempDir() / openstudio::toPath("FileEventMonitor_OnlyWrittenFiles");
+  boost::filesystem::remove_all(dir);
+  boost::filesystem::create_directories(dir);
+  QString qdir = QDir(openstudio::toQString(dir)).absolutePath();
+
+  for (int i = 0; i < numFiles; ++i)
+  {
+    QFile f(qdir + "/output" + QString::number(i) + ".txt");
+    ASSERT_TRUE(f.open(QIODevice::WriteOnly));
+    f.write("output\n");
+  }
+
+  detail::FileEventMonitor monitor;
+  if (!monitor.watch(qdir))
+  {
+    LOG(Info, "File events are not available, LocalProcess rescans output directories instead");
+    return;
+  }
+
+  std::vector<QString> changed;
+  QObject::connect(&monitor, &detail::FileEventMonitor::fileChanged, [&changed](const QString &t_path) { changed.push_back(t_path); });
+
+  QString file = qdir + "/eplusout.err";
+  for (int i = 0; i < numWrites; ++i)
+  {
+    QFile f(file);
+    ASSERT_TRUE(f.open(QIODevice::WriteOnly | QIODevice::Append));
+    f.write(QByteArray::number(i) + "\n");
+  }
+
+  EXPECT_TRUE(waitForPath(changed, file));
+  openstudio::Application::instance().processEvents(100);
+
+  // none of the existing files are reported, and writes to the one file do not add up to a rescan
+  EXPECT_EQ(static_cast<size_t>(std::count(changed.begin(), changed.end(), file)), changed.size());
+  EXPECT_LT(changed.size(), static_cast<size_t>(numFiles));
+
+  monitor.stop();
+  boost::filesystem::remove_all(dir);
+}
@@ -0,0 +1,104 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "RunManagerTestFixture.hpp"
+#include <runmanager/Test/ToolBin.hxx>
+#include "../JobFactory.hpp"
+#include "../RunManager.hpp"
+#include "../Workflow.hpp"
+
+#include "../../../utilities/core/Application.hpp"
+#include "../../../utilities/core/System.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+using namespace openstudio;
+using namespace openstudio::runmanager;
+
+namespace {
+  // statistics are published by the queue thread, give it a chance to catch up
+  std::map<std::string, double> waitForStatistic(const RunManager &t_rm, const std::string &t_name, double t_value)
+  {
+    std::map<std::string, double> stats = t_rm.statistics();
+    for (int i = 0; i < 1000 && stats[t_name] != t_value; ++i)
+    {
+      openstudio::Application::instance().processEvents(10);
+      openstudio::System::msleep(10);
+      stats = t_rm.statistics();
+    }
+    return stats;
+  }
+}
+
+TEST_F(RunManagerTestFixture, SchedulerStatistics)
+{
+  RunManager rm;
+  rm.setPaused(true);
+
+  // workflows of 1 to 4 null jobs, 10 jobs in all
+  std::vector<Job> workflows;
+  for (int i = 1; i < 5; ++i)
+  {
+    Workflow wf;
+    for (int j = 0; j < i; ++j)
+    {
+      wf.addJob(JobType::Null);
+    }
+    // keep filepaths short enough for Windows
+    wf.addParam(runmanager::JobParam("flatoutdir"));
+    Job job = wf.create(openstudio::toPath("SchedulerStatistics"));
+    workflows.push_back(job);
+    rm.enqueue(job, true);
+  }
+
+  ASSERT_EQ(10, static_cast<int>(rm.getJobs().size()));
+
+  std::map<std::string, double> stats = waitForStatistic(rm, "Number of Jobs", 10);
+  EXPECT_EQ(10, stats["Number of Jobs"]);
+  EXPECT_EQ(4, stats["Number of Workflows"]);
+  EXPECT_EQ(0, stats["Completed Jobs"]);
+
+  rm.setPaused(false);
+  rm.waitForFinished();
+
+  EXPECT_FALSE(rm.workPending());
+
+  stats = waitForStatistic(rm, "Completed Jobs", 10);
+  EXPECT_EQ(10, stats["Completed Jobs"]);
+  EXPECT_EQ(10, stats["Successful Jobs"]);
+  EXPECT_EQ(0, stats["Failed Jobs"]);
+  EXPECT_EQ(0, stats["Running Jobs"]);
+  EXPECT_EQ(0, stats["Running Workflows"]);
+
+  // every job ran, and none before its parent
+  for (const Job& workflow : workflows)
+  {
+    Job parent = workflow;
+    EXPECT_TRUE(parent.lastRun());
+    while (!parent.children().empty())
+    {
+      ASSERT_EQ(1u, parent.children().size());
+      Job child = parent.children()[0];
+      EXPECT_TRUE(child.lastRun());
+      EXPECT_FALSE(child.ranBefore(parent));
+      parent = child;
+    }
+  }
+}
@@ -2130,4 +2130,9 @@ namespace openstudio{
     return QObject::disconnect(getImpl<detail::OSServer_Impl>().get(), signal, receiver, slot);
   }
 
+  bool OSServer::isSender(const QObject* sender) const
+  {
+    return (getImpl<detail::OSServer_Impl>().get() == sender);
+  }
+
 } // openstudio
@@ -214,6 +214,10 @@ namespace openstudio{
                     const QObject* receiver=nullptr,
                     const char* slot=nullptr) const;
 
+    /** Returns true if sender is the object that emits this OSServer's signals, that is, if a slot
+     *  connected with connect() was called by this OSServer. Use with QObject::sender(). */
+    bool isSender(const QObject* sender) const;
+
     //@}
     /** @name Type Casting */
     //@{
@@ -247,6 +251,7 @@ namespace openstudio{
 
   protected:
 
+    /** For subclasses that provide their own implementation, for instance a test server. */
     OSServer(const std::shared_ptr<detail::OSServer_Impl>& impl);
 
   private:
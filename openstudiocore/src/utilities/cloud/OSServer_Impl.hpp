@@ -39,6 +39,8 @@ namespace openstudio{
 namespace detail{
 
   /// OSServer is a class for accessing the rails server started on machines provided by a CloudProvider.
+  /// The non-blocking requests and the last results are virtual so a test server can stand in for
+  /// a live one.
   class UTILITIES_API OSServer_Impl : public QObject {
 
     Q_OBJECT
@@ -63,119 +65,119 @@ namespace detail{
     //@{
 
     bool available(int msec);
-    bool lastAvailable() const;
+    virtual bool lastAvailable() const;
 
     std::vector<UUID> projectUUIDs(int msec); 
-    std::vector<UUID> lastProjectUUIDs() const; 
+    virtual std::vector<UUID> lastProjectUUIDs() const; 
 
     bool createProject(const UUID& projectUUID, int msec); 
-    bool lastCreateProjectSuccess() const; 
+    virtual bool lastCreateProjectSuccess() const; 
 
     bool deleteProject(const UUID& projectUUID, int msec); 
-    bool lastDeleteProjectSuccess() const; 
+    virtual bool lastDeleteProjectSuccess() const; 
 
     std::vector<UUID> analysisUUIDs(const UUID& projectUUID, int msec); 
-    std::vector<UUID> lastAnalysisUUIDs() const; 
+    virtual std::vector<UUID> lastAnalysisUUIDs() const; 
 
     bool postAnalysisJSON(const UUID& projectUUID, const std::string& analysisJSON, int msec);
-    bool lastPostAnalysisJSONSuccess() const;
+    virtual bool lastPostAnalysisJSONSuccess() const;
 
     bool postDataPointJSON(const UUID& analysisUUID, const std::string& dataPointJSON, int msec);
-    bool lastPostDataPointJSONSuccess() const;
+    virtual bool lastPostDataPointJSONSuccess() const;
 
     bool uploadAnalysisFiles(const UUID& analysisUUID, const openstudio::path& analysisZipFile, int msec);
-    bool lastUploadAnalysisFilesSuccess() const;
+    virtual bool lastUploadAnalysisFilesSuccess() const;
 
     bool start(const UUID& analysisUUID, int msec);
-    bool lastStartSuccess() const;
+    virtual bool lastStartSuccess() const;
     
     bool isAnalysisQueued(const UUID& analysisUUID, int msec);
-    bool lastIsAnalysisQueued() const;
+    virtual bool lastIsAnalysisQueued() const;
 
     bool isAnalysisRunning(const UUID& analysisUUID, int msec);
-    bool lastIsAnalysisRunning() const;
+    virtual bool lastIsAnalysisRunning() const;
 
     bool isAnalysisComplete(const UUID& analysisUUID, int msec);
-    bool lastIsAnalysisComplete() const;
+    virtual bool lastIsAnalysisComplete() const;
 
     bool stop(const UUID& analysisUUID, int msec);
-    bool lastStopSuccess() const;
+    virtual bool lastStopSuccess() const;
 
     std::vector<UUID> dataPointUUIDs(const UUID& analysisUUID, int msec);
-    std::vector<UUID> lastDataPointUUIDs() const;
+    virtual std::vector<UUID> lastDataPointUUIDs() const;
 
     std::vector<UUID> queuedDataPointUUIDs(const UUID& analysisUUID, int msec);
-    std::vector<UUID> lastQueuedDataPointUUIDs() const;
+    virtual std::vector<UUID> lastQueuedDataPointUUIDs() const;
 
     std::vector<UUID> runningDataPointUUIDs(const UUID& analysisUUID, int msec);
-    std::vector<UUID> lastRunningDataPointUUIDs() const;
+    virtual std::vector<UUID> lastRunningDataPointUUIDs() const;
 
     std::vector<UUID> completeDataPointUUIDs(const UUID& analysisUUID, int msec);
-    std::vector<UUID> lastCompleteDataPointUUIDs() const;
+    virtual std::vector<UUID> lastCompleteDataPointUUIDs() const;
 
     std::vector<UUID> downloadReadyDataPointUUIDs(const UUID& analysisUUID, int msec);
-    std::vector<UUID> lastDownloadReadyDataPointUUIDs() const;
+    virtual std::vector<UUID> lastDownloadReadyDataPointUUIDs() const;
 
     std::string dataPointJSON(const UUID& analysisUUID, const UUID& dataPointUUID, int msec);
-    std::string lastDataPointJSON() const;
+    virtual std::string lastDataPointJSON() const;
 
     bool downloadDataPoint(const UUID& analysisUUID, const UUID& dataPointUUID, const openstudio::path& downloadPath, int msec);
-    bool lastDownloadDataPointSuccess() const;
+    virtual bool lastDownloadDataPointSuccess() const;
 
     bool deleteDataPoint(const UUID& analysisUUID, const UUID& dataPointUUID, int msec=30000);
-    bool lastDeleteDataPointSuccess() const;
+    virtual bool lastDeleteDataPointSuccess() const;
 
     bool waitForFinished(int msec);
 
-    std::vector<std::string> errors() const;
+    virtual std::vector<std::string> errors() const;
     
-    std::vector<std::string> warnings() const;
+    virtual std::vector<std::string> warnings() const;
 
     //@}
     /** @name Non-blocking class members */
     //@{
 
-    bool requestAvailable();
+    virtual bool requestAvailable();
 
-    bool requestProjectUUIDs(); 
+    virtual bool requestProjectUUIDs(); 
 
-    bool requestCreateProject(const UUID& projectUUID); 
+    virtual bool requestCreateProject(const UUID& projectUUID); 
 
-    bool requestDeleteProject(const UUID& projectUUID); 
+    virtual bool requestDeleteProject(const UUID& projectUUID); 
 
-    bool requestAnalysisUUIDs(const UUID& projectUUID); 
+    virtual bool requestAnalysisUUIDs(const UUID& projectUUID); 
 
-    bool startPostAnalysisJSON(const UUID& projectUUID, const std::string& analysisJSON);
+    virtual bool startPostAnalysisJSON(const UUID& projectUUID, const std::string& analysisJSON);
 
-    bool startPostDataPointJSON(const UUID& analysisUUID, const std::string& dataPointJSON);
+    virtual bool startPostDataPointJSON(const UUID& analysisUUID, const std::string& dataPointJSON);
 
-    bool startUploadAnalysisFiles(const UUID& analysisUUID, const openstudio::path& analysisZipFile);
+    virtual bool startUploadAnalysisFiles(const UUID& analysisUUID, const openstudio::path& analysisZipFile);
 
-    bool requestStart(const UUID& analysisUUID);
+    virtual bool requestStart(const UUID& analysisUUID);
 
-    bool requestIsAnalysisQueued(const UUID& analysisUUID);
+    virtual bool requestIsAnalysisQueued(const UUID& analysisUUID);
 
-    bool requestIsAnalysisRunning(const UUID& analysisUUID);
+    virtual bool requestIsAnalysisRunning(const UUID& analysisUUID);
 
-    bool requestIsAnalysisComplete(const UUID& analysisUUID);
+    virtual bool requestIsAnalysisComplete(const UUID& analysisUUID);
 
-    bool requestStop(const UUID& analysisUUID);
+    virtual bool requestStop(const UUID& analysisUUID);
 
-    bool requestDataPointUUIDs(const UUID& analysisUUID);
+    virtual bool requestDataPointUUIDs(const UUID& analysisUUID);
 
-    bool requestRunningDataPointUUIDs(const UUID& analysisUUID);
+    virtual bool requestRunningDataPointUUIDs(const UUID& analysisUUID);
 
-    bool requestQueuedDataPointUUIDs(const UUID& analysisUUID);
+    virtual bool requestQueuedDataPointUUIDs(const UUID& analysisUUID);
 
-    bool requestCompleteDataPointUUIDs(const UUID& analysisUUID);
+    virtual bool requestCompleteDataPointUUIDs(const UUID& analysisUUID);
 
-    bool requestDownloadReadyDataPointUUIDs(const UUID& analysisUUID);
+    virtual bool requestDownloadReadyDataPointUUIDs(const UUID& analysisUUID);
 
-    bool requestDataPointJSON(const UUID& analysisUUID, const UUID& dataPointUUID);
+    virtual bool requestDataPointJSON(const UUID& analysisUUID, const UUID& dataPointUUID);
 
-    bool startDownloadDataPoint(const UUID& analysisUUID, const UUID& dataPointUUID, const openstudio::path& downloadPath);
+    virtual bool startDownloadDataPoint(const UUID& analysisUUID, const UUID& dataPointUUID, const openstudio::path& downloadPath);
 
-    bool requestDeleteDataPoint(const UUID& analysisUUID, const UUID& dataPointUUID);
+    virtual bool requestDeleteDataPoint(const UUID& analysisUUID, const UUID& dataPointUUID);
 
     //@}
 
@@ -0,0 +1,380 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+
+#include "JsonStream.hpp"
+
+#include "Assert.hpp"
+#include "String.hpp"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonValue>
+
+namespace openstudio {
+
+namespace {
+
+  QByteArray toJsonText(const QVariant& variant) {
+    QJsonValue value = QJsonValue::fromVariant(variant);
+    if (value.isObject()) {
+      return QJsonDocument(value.toObject()).toJson(QJsonDocument::Compact);
+    }
+    if (value.isArray()) {
+      return QJsonDocument(value.toArray()).toJson(QJsonDocument::Compact);
+    }
+    // QJsonDocument only writes objects and arrays, so write scalars as the only array element
+    QJsonArray array;
+    array.append(value);
+    QByteArray result = QJsonDocument(array).toJson(QJsonDocument::Compact);
+    return result.mid(1,result.size() - 2);
+  }
+
+  bool isJsonWhitespace(char c) {
+    return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+  }
+
+}
+
+JsonStreamWriter::JsonStreamWriter(std::ostream& os)
+  : m_os(os),
+    m_afterKey(false)
+{}
+
+void JsonStreamWriter::writeStartObject() {
+  startValue();
+  m_os << '{';
+  Frame frame = {true, false};
+  m_stack.push_back(frame);
+}
+
+void JsonStreamWriter::writeEndObject() {
+  OS_ASSERT(!m_stack.empty() && m_stack.back().isObject && !m_afterKey);
+  m_stack.pop_back();
+  m_os << '}';
+}
+
+void JsonStreamWriter::writeStartArray() {
+  startValue();
+  m_os << '[';
+  Frame frame = {false, false};
+  m_stack.push_back(frame);
+}
+
+void JsonStreamWriter::writeEndArray() {
+  OS_ASSERT(!m_stack.empty() && !m_stack.back().isObject);
+  if (m_stack.back().hasEntries) {
+    m_os << '\n';
+  }
+  m_stack.pop_back();
+  m_os << ']';
+}
+
+void JsonStreamWriter::resumeObject(bool hasEntries) {
+  OS_ASSERT(!m_afterKey);
+  Frame frame = {true, hasEntries};
+  m_stack.push_back(frame);
+}
+
+void JsonStreamWriter::resumeArray(bool hasEntries) {
+  OS_ASSERT(!m_afterKey);
+  Frame frame = {false, hasEntries};
+  m_stack.push_back(frame);
+}
+
+void JsonStreamWriter::writeKey(const QString& key) {
+  OS_ASSERT(!m_stack.empty() && m_stack.back().isObject && !m_afterKey);
+  if (m_stack.back().hasEntries) {
+    m_os << ',';
+  }
+  m_stack.back().hasEntries = true;
+  QByteArray text = toJsonText(QVariant(key));
+  m_os.write(text.constData(),text.size());
+  m_os << ':';
+  m_afterKey = true;
+}
+
+void JsonStreamWriter::writeValue(const QVariant& value) {
+  startValue();
+  QByteArray text = toJsonText(value);
+  m_os.write(text.constData(),text.size());
+}
+
+void JsonStreamWriter::writeMembers(const QVariantMap& members) {
+  for (QVariantMap::const_iterator it = members.begin(), itEnd = members.end(); it != itEnd; ++it) {
+    writeKey(it.key());
+    writeValue(it.value());
+  }
+}
+
+void JsonStreamWriter::startValue() {
+  if (m_afterKey) {
+    m_afterKey = false;
+    return;
+  }
+  if (m_stack.empty()) {
+    return;
+  }
+  OS_ASSERT(!m_stack.back().isObject);
+  if (m_stack.back().hasEntries) {
+    m_os << ',';
+  }
+  m_os << '\n';
+  m_stack.back().hasEntries = true;
+}
+
+JsonStreamReader::JsonStreamReader(std::istream& is)
+  : m_is(is),
+    m_buffer(65536),
+    m_position(0),
+    m_size(0),
+    m_started(false),
+    m_afterKey(false),
+    m_tokenType(NoToken)
+{}
+
+JsonStreamReader::TokenType JsonStreamReader::readNext() {
+  if (m_tokenType == EndDocument) {
+    return m_tokenType;
+  }
+
+  skipWhitespace();
+
+  if (m_stack.empty()) {
+    if (m_started) {
+      if (!atEnd()) {
+        LOG_AND_THROW("Unexpected content after the end of the json document.");
+      }
+      return m_tokenType = EndDocument;
+    }
+    m_started = true;
+    return startValue();
+  }
+
+  Frame& top = m_stack.back();
+  if (top.isObject && !m_afterKey) {
+    if (peek() == '}') {
+      get();
+      m_stack.pop_back();
+      return m_tokenType = EndObject;
+    }
+    if (top.hasEntries) {
+      expect(',');
+      skipWhitespace();
+    }
+    top.hasEntries = true;
+    if (peek() != '"') {
+      LOG_AND_THROW("Expected a member name in json object, but found '" << peek() << "'.");
+    }
+    m_key = parseScalar(readString()).toString();
+    skipWhitespace();
+    expect(':');
+    m_afterKey = true;
+    return m_tokenType = Key;
+  }
+
+  if (!top.isObject) {
+    if (peek() == ']') {
+      get();
+      m_stack.pop_back();
+      return m_tokenType = EndArray;
+    }
+    if (top.hasEntries) {
+      expect(',');
+      skipWhitespace();
+    }
+    top.hasEntries = true;
+  }
+
+  m_afterKey = false;
+  return startValue();
+}
+
+JsonStreamReader::TokenType JsonStreamReader::tokenType() const {
+  return m_tokenType;
+}
+
+QString JsonStreamReader::key() const {
+  return m_key;
+}
+
+QVariant JsonStreamReader::value() const {
+  return m_value;
+}
+
+QVariant JsonStreamReader::readValue() {
+  if (m_tokenType == Key) {
+    readNext();
+  }
+
+  if (m_tokenType == Value) {
+    return m_value;
+  }
+
+  if ((m_tokenType != StartObject) && (m_tokenType != StartArray)) {
+    LOG_AND_THROW("There is no json value to read.");
+  }
+
+  std::string raw(1,(m_tokenType == StartObject) ? '{' : '[');
+  readContainer(&raw);
+
+  QJsonParseError err;
+  QJsonDocument doc = QJsonDocument::fromJson(QByteArray(raw.data(),int(raw.size())),&err);
+  if (err.error) {
+    LOG_AND_THROW("Error parsing json: " << toString(err.errorString()));
+  }
+  return doc.toVariant();
+}
+
+void JsonStreamReader::skipValue() {
+  if (m_tokenType == Key) {
+    readNext();
+  }
+
+  if ((m_tokenType == StartObject) || (m_tokenType == StartArray)) {
+    readContainer(nullptr);
+  }
+  else if (m_tokenType != Value) {
+    LOG_AND_THROW("There is no json value to skip.");
+  }
+}
+
+JsonStreamReader::TokenType JsonStreamReader::startValue() {
+  skipWhitespace();
+  char c = peek();
+  if ((c == '{') || (c == '[')) {
+    get();
+    Frame frame = {(c == '{'), false};
+    m_stack.push_back(frame);
+    return m_tokenType = ((c == '{') ? StartObject : StartArray);
+  }
+  m_value = parseScalar((c == '"') ? readString() : readLiteral());
+  return m_tokenType = Value;
+}
+
+void JsonStreamReader::readContainer(std::string* raw) {
+  OS_ASSERT(!m_stack.empty());
+  unsigned depth = 1;
+  while (depth > 0) {
+    char c = peek();
+    if (c == '"') {
+      std::string str = readString();
+      if (raw) {
+        raw->append(str);
+      }
+      continue;
+    }
+    get();
+    if (raw) {
+      raw->push_back(c);
+    }
+    if ((c == '{') || (c == '[')) {
+      ++depth;
+    }
+    else if ((c == '}') || (c == ']')) {
+      --depth;
+    }
+  }
+  m_tokenType = m_stack.back().isObject ? EndObject : EndArray;
+  m_stack.pop_back();
+}
+
+std::string JsonStreamReader::readString() {
+  std::string result(1,get());
+  OS_ASSERT(result[0] == '"');
+  while (true) {
+    char c = get();
+    result.push_back(c);
+    if (c == '\\') {
+      result.push_back(get());
+    }
+    else if (c == '"') {
+      break;
+    }
+  }
+  return result;
+}
+
+std::string JsonStreamReader::readLiteral() {
+  std::string result;
+  while (!atEnd()) {
+    char c = m_buffer[m_position];
+    if (isJsonWhitespace(c) || (c == ',') || (c == ':') || (c == ']') || (c == '}')) {
+      break;
+    }
+    result.push_back(c);
+    ++m_position;
+  }
+  if (result.empty()) {
+    LOG_AND_THROW("Expected a json value, but found '" << peek() << "'.");
+  }
+  return result;
+}
+
+QVariant JsonStreamReader::parseScalar(const std::string& raw) const {
+  // QJsonDocument only reads objects and arrays, so read scalars as the only array element
+  QByteArray text("[");
+  text.append(raw.data(),int(raw.size()));
+  text.append(']');
+  QJsonParseError err;
+  QJsonDocument doc = QJsonDocument::fromJson(text,&err);
+  if (err.error || (doc.array().size() != 1)) {
+    LOG_AND_THROW("Invalid json value " << raw << ".");
+  }
+  return doc.array().at(0).toVariant();
+}
+
+bool JsonStreamReader::atEnd() {
+  if (m_position < m_size) {
+    return false;
+  }
+  m_is.read(&m_buffer[0],m_buffer.size());
+  m_size = static_cast<std::size_t>(m_is.gcount());
+  m_position = 0;
+  return (m_size == 0);
+}
+
+char JsonStreamReader::peek() {
+  if (atEnd()) {
+    LOG_AND_THROW("Unexpected end of json document.");
+  }
+  return m_buffer[m_position];
+}
+
+char JsonStreamReader::get() {
+  char result = peek();
+  ++m_position;
+  return result;
+}
+
+void JsonStreamReader::skipWhitespace() {
+  while (!atEnd() && isJsonWhitespace(m_buffer[m_position])) {
+    ++m_position;
+  }
+}
+
+void JsonStreamReader::expect(char c) {
+  char found = get();
+  if (found != c) {
+    LOG_AND_THROW("Expected '" << c << "' in json document, but found '" << found << "'.");
+  }
+}
+
+} // openstudio
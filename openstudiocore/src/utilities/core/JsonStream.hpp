@@ -0,0 +1,151 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+
+#ifndef UTILITIES_CORE_JSONSTREAM_HPP
+#define UTILITIES_CORE_JSONSTREAM_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "Logger.hpp"
+
+#include <QString>
+#include <QVariant>
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+/** JsonStreamWriter writes a json document to a std::ostream one token at a time, so large
+ *  documents do not have to be assembled as a QVariant first. Complete values, such as one
+ *  element of a long array, can still be written from a QVariant with writeValue. Separators
+ *  are inserted as needed; each array element starts on a new line. */
+class UTILITIES_API JsonStreamWriter {
+ public:
+  explicit JsonStreamWriter(std::ostream& os);
+
+  void writeStartObject();
+
+  void writeEndObject();
+
+  void writeStartArray();
+
+  void writeEndArray();
+
+  /** Continues an object that is already open in the output, for instance to append to a
+   *  document that was truncated before its closing brackets. */
+  void resumeObject(bool hasEntries);
+
+  /** Continues an array that is already open in the output. */
+  void resumeArray(bool hasEntries);
+
+  /** Writes the name of the next member of the current object. */
+  void writeKey(const QString& key);
+
+  /** Writes value as the next array element, member value, or document. value may be a
+   *  complete QVariantMap or QVariantList. */
+  void writeValue(const QVariant& value);
+
+  /** Writes each entry of members as a member of the current object. */
+  void writeMembers(const QVariantMap& members);
+
+ private:
+  REGISTER_LOGGER("openstudio.utilities.JsonStreamWriter");
+
+  struct Frame {
+    bool isObject;
+    bool hasEntries;
+  };
+
+  void startValue();
+
+  std::ostream& m_os;
+  std::vector<Frame> m_stack;
+  bool m_afterKey;
+};
+
+/** JsonStreamReader is a pull parser that reads a json document from a std::istream one token
+ *  at a time, similar to QXmlStreamReader. Only the value being read is held in memory; any
+ *  value can be materialized as a QVariant with readValue or passed over with skipValue.
+ *  Malformed json causes an openstudio::Exception to be thrown. */
+class UTILITIES_API JsonStreamReader {
+ public:
+  enum TokenType { NoToken, StartObject, EndObject, StartArray, EndArray, Key, Value, EndDocument };
+
+  explicit JsonStreamReader(std::istream& is);
+
+  /** Reads and returns the next token. */
+  TokenType readNext();
+
+  TokenType tokenType() const;
+
+  /** Member name, if tokenType() == Key. */
+  QString key() const;
+
+  /** Scalar value (string, number, bool or null), if tokenType() == Value. */
+  QVariant value() const;
+
+  /** Returns the complete value whose first token was just read (StartObject, StartArray or
+   *  Value). If tokenType() == Key, reads and returns the value of that member. Afterwards the
+   *  reader is positioned after the value. */
+  QVariant readValue();
+
+  /** As readValue, but does not construct the value. */
+  void skipValue();
+
+ private:
+  REGISTER_LOGGER("openstudio.utilities.JsonStreamReader");
+
+  struct Frame {
+    bool isObject;
+    bool hasEntries;
+  };
+
+  TokenType startValue();
+  // appends the rest of the innermost open container to raw, if raw is given, and closes it
+  void readContainer(std::string* raw);
+  std::string readString();
+  std::string readLiteral();
+  QVariant parseScalar(const std::string& raw) const;
+
+  bool atEnd();
+  char peek();
+  char get();
+  void skipWhitespace();
+  void expect(char c);
+
+  std::istream& m_is;
+  std::vector<char> m_buffer;
+  std::size_t m_position;
+  std::size_t m_size;
+
+  std::vector<Frame> m_stack;
+  bool m_started;
+  bool m_afterKey;
+  TokenType m_tokenType;
+  QString m_key;
+  QVariant m_value;
+};
+
+} // openstudio
+
+#endif // UTILITIES_CORE_JSONSTREAM_HPP
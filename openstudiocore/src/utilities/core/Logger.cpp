@@ -77,6 +77,9 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   void logFree(LogLevel level, const std::string& channel, const std::string& message)
   {
+    if (openstudio::Logger::instance().captureMessage(level, channel, message)){
+      return;
+    }
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
@@ -149,6 +152,44 @@ namespace openstudio{
     return it->second;
   }
 
+  void LoggerSingleton::beginCapture()
+  {
+    QWriteLocker l(m_mutex);
+
+    // keeps messages already captured if called twice
+    m_capturedMessages.insert(std::make_pair(QThread::currentThread(), std::vector<LogMessage>()));
+  }
+
+  std::vector<LogMessage> LoggerSingleton::endCapture()
+  {
+    QWriteLocker l(m_mutex);
+
+    std::vector<LogMessage> result;
+    auto it = m_capturedMessages.find(QThread::currentThread());
+    if (it != m_capturedMessages.end()){
+      result.swap(it->second);
+      m_capturedMessages.erase(it);
+    }
+    return result;
+  }
+
+  bool LoggerSingleton::captureMessage(LogLevel level, const std::string& channel, const std::string& message)
+  {
+    QReadLocker l(m_mutex);
+
+    if (m_capturedMessages.empty()){
+      return false;
+    }
+
+    // each thread only appends to its own vector, the map itself is only changed under the write lock
+    auto it = m_capturedMessages.find(QThread::currentThread());
+    if (it == m_capturedMessages.end()){
+      return false;
+    }
+    it->second.push_back(LogMessage(level, channel, message));
+    return true;
+  }
+
   bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink)
   {
     QWriteLocker l(m_mutex);
@@ -32,9 +32,11 @@
 #include <sstream>
 #include <set>
 #include <map>
+#include <vector>
 
 class QReadWriteLock;
 class QWriteLocker;
+class QThread;
 
 /// defines method logChannel() to get a logger for a class
 #define REGISTER_LOGGER(__logChannel__) \
@@ -92,6 +94,17 @@ namespace openstudio{
     /// exist a new logger will be set up at the default level
     LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+    /// messages logged on the calling thread are held back from all sinks until endCapture
+    /// is called on the same thread, e.g. for work on worker threads that may be discarded
+    void beginCapture();
+
+    /// stop holding back messages logged on the calling thread, returns the messages logged since beginCapture
+    /// so the caller can pass them on with logFree
+    std::vector<LogMessage> endCapture();
+
+    /// called by logFree, if messages on the calling thread are being captured stores the message and returns true
+    bool captureMessage(LogLevel level, const std::string& channel, const std::string& message);
+
    protected:
 
     friend class detail::LogSink_Impl;
@@ -125,6 +138,10 @@ namespace openstudio{
     /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
     typedef std::set<boost::shared_ptr<LogSinkBackend> > SinkSetType;
     SinkSetType m_sinks;
+
+    /// messages held back for threads between beginCapture and endCapture
+    typedef std::map<QThread*, std::vector<LogMessage> > CapturedMessagesType;
+    CapturedMessagesType m_capturedMessages;
   };
 
 #if _WIN32 || _MSC_VER
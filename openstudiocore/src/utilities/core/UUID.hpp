@@ -57,6 +57,22 @@ namespace openstudio {
 
   UTILITIES_API std::ostream& operator<<(std::ostream& os,const UUID& uuid);
 
+  /// hash function object for using UUID as the key of unordered containers
+  struct UUIDHash {
+    std::size_t operator()(const UUID& uuid) const {
+      // created UUIDs are random, so folding the 128 bits together is enough to spread them out
+      unsigned long long high = (static_cast<unsigned long long>(uuid.data1) << 32) |
+                                (static_cast<unsigned long long>(uuid.data2) << 16) |
+                                static_cast<unsigned long long>(uuid.data3);
+      unsigned long long low = 0;
+      for (unsigned char c : uuid.data4) {
+        low = (low << 8) | c;
+      }
+      unsigned long long result = high ^ (low * 0x9E3779B97F4A7C15ULL);
+      return static_cast<std::size_t>(result ^ (result >> 32));
+    }
+  };
+
 } // openstudio
 
 Q_DECLARE_METATYPE(openstudio::UUID);
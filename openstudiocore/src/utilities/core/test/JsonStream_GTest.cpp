@@ -0,0 +1,117 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "../JsonStream.hpp"
+#include "../Exception.hpp"
+
+#include <sstream>
+
+#include <QVariant>
+
+using openstudio::JsonStreamReader;
+using openstudio::JsonStreamWriter;
+
+TEST(JsonStream, WriteRead)
+{
+  QVariantMap member;
+  member["name"] = QString("Point \"1\"");
+  member["values"] = QVariantList() << 1 << 2.5 << QVariant();
+
+  std::stringstream ss;
+  JsonStreamWriter writer(ss);
+  writer.writeStartObject();
+  writer.writeKey("version");
+  writer.writeValue(QString("1.0"));
+  writer.writeKey("items");
+  writer.writeStartArray();
+  for (int i = 0; i < 3; ++i) {
+    member["index"] = i;
+    writer.writeValue(member);
+  }
+  writer.writeEndArray();
+  writer.writeKey("empty");
+  writer.writeStartArray();
+  writer.writeEndArray();
+  writer.writeKey("valid");
+  writer.writeValue(true);
+  writer.writeEndObject();
+
+  JsonStreamReader reader(ss);
+  ASSERT_EQ(JsonStreamReader::StartObject, reader.readNext());
+  ASSERT_EQ(JsonStreamReader::Key, reader.readNext());
+  EXPECT_EQ("version", reader.key().toStdString());
+  ASSERT_EQ(JsonStreamReader::Value, reader.readNext());
+  EXPECT_EQ("1.0", reader.value().toString().toStdString());
+
+  ASSERT_EQ(JsonStreamReader::Key, reader.readNext());
+  EXPECT_EQ("items", reader.key().toStdString());
+  ASSERT_EQ(JsonStreamReader::StartArray, reader.readNext());
+  int i = 0;
+  while (reader.readNext() != JsonStreamReader::EndArray) {
+    ASSERT_EQ(JsonStreamReader::StartObject, reader.tokenType());
+    QVariantMap item = reader.readValue().toMap();
+    EXPECT_EQ(i, item["index"].toInt());
+    EXPECT_EQ("Point \"1\"", item["name"].toString().toStdString());
+    ASSERT_EQ(3, item["values"].toList().size());
+    EXPECT_DOUBLE_EQ(2.5, item["values"].toList()[1].toDouble());
+    EXPECT_TRUE(item["values"].toList()[2].isNull());
+    ++i;
+  }
+  EXPECT_EQ(3, i);
+
+  ASSERT_EQ(JsonStreamReader::Key, reader.readNext());
+  EXPECT_EQ("empty", reader.key().toStdString());
+  reader.skipValue();
+  EXPECT_EQ(JsonStreamReader::EndArray, reader.tokenType());
+
+  ASSERT_EQ(JsonStreamReader::Key, reader.readNext());
+  EXPECT_TRUE(reader.readValue().toBool());
+  EXPECT_EQ(JsonStreamReader::EndObject, reader.readNext());
+  EXPECT_EQ(JsonStreamReader::EndDocument, reader.readNext());
+}
+
+TEST(JsonStream, SkipNested)
+{
+  std::stringstream ss("{ \"a\" : { \"b\" : [1, {\"c\" : \"]}\"}], \"d\" : null }, \"e\" : [ ] }");
+  JsonStreamReader reader(ss);
+  ASSERT_EQ(JsonStreamReader::StartObject, reader.readNext());
+  ASSERT_EQ(JsonStreamReader::Key, reader.readNext());
+  reader.skipValue();
+  ASSERT_EQ(JsonStreamReader::Key, reader.readNext());
+  EXPECT_EQ("e", reader.key().toStdString());
+  EXPECT_TRUE(reader.readValue().toList().empty());
+  EXPECT_EQ(JsonStreamReader::EndObject, reader.readNext());
+  EXPECT_EQ(JsonStreamReader::EndDocument, reader.readNext());
+}
+
+TEST(JsonStream, Malformed)
+{
+  std::stringstream missingColon("{\"a\" 1}");
+  JsonStreamReader reader1(missingColon);
+  reader1.readNext();
+  EXPECT_THROW(reader1.readNext(), openstudio::Exception);
+
+  std::stringstream truncated("[1, 2");
+  JsonStreamReader reader2(truncated);
+  reader2.readNext();
+  EXPECT_THROW(reader2.readValue(), openstudio::Exception);
+}
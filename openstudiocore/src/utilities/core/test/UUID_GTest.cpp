@@ -24,6 +24,7 @@
 
 #include <iostream>
 #include <set>
+#include <unordered_set>
 
 #include <QVariant>
 
@@ -94,3 +95,35 @@ TEST(UUID, UUID_UID) {
   EXPECT_EQ(uuid,toUUID(uuidStr));
   EXPECT_EQ(uuid,toUUID(uidStr)); // no extra conversion process
 }
+
+TEST(UUID, UUIDHash)
+{
+  openstudio::UUIDHash hash;
+
+  // equal UUIDs have equal hashes
+  UUID uuid = createUUID();
+  UUID uuid2 = toUUID(toString(uuid));
+  EXPECT_EQ(hash(uuid), hash(uuid2));
+  EXPECT_EQ(hash(UUID()), hash(UUID()));
+
+  // hashed containers behave like the ordered ones
+  unsigned numUUIDS = 100000;
+  std::set<UUID> uuids;
+  std::unordered_set<UUID, openstudio::UUIDHash> hashedUUIDs;
+  for(unsigned i=0; i < numUUIDS; ++i){
+    UUID candidate = createUUID();
+    uuids.insert(candidate);
+    hashedUUIDs.insert(candidate);
+  }
+  EXPECT_EQ(uuids.size(), hashedUUIDs.size());
+  for (const UUID& candidate : uuids) {
+    EXPECT_EQ(1u, hashedUUIDs.count(candidate));
+  }
+
+  // created UUIDs should rarely share a hash
+  std::set<std::size_t> hashes;
+  for (const UUID& candidate : uuids) {
+    hashes.insert(hash(candidate));
+  }
+  EXPECT_GT(hashes.size(), numUUIDS - 10);
+}
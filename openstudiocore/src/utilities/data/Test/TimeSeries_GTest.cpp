@@ -550,3 +550,161 @@ TEST_F(DataFixture,TimeSeries_AddSubtractSameTimePeriod)
   // 2:30
   EXPECT_DOUBLE_EQ(6.75, ans.value(Time(0,1,30,0)));
 }
+
+TEST_F(DataFixture,TimeSeries_AlignedArithmetic)
+{
+  std::string units = "W";
+
+  Date startDate(Date(MonthOfYear(MonthOfYear::Jan),1));
+  DateTime startDateTime(startDate, Time(0,1,0,0));
+  Time interval = Time(0,1,0,0);
+
+  Vector values1 = linspace(1, 8760, 8760);
+  Vector values2 = linspace(8760, 1, 8760);
+  TimeSeries intervalTimeSeries1(startDateTime, interval, values1, units);
+  TimeSeries intervalTimeSeries2(startDateTime, interval, values2, units);
+
+  // same report times given as seconds, no interval length
+  std::vector<long> seconds;
+  for (unsigned i = 0; i < 8760; ++i){
+    seconds.push_back(3600*i);
+  }
+  TimeSeries detailedTimeSeries(startDateTime, seconds, values2, units);
+
+  // report times shifted by half an hour over the first days, not aligned
+  TimeSeries shiftedTimeSeries(startDateTime + Time(0,0,30,0), interval, linspace(1, 100, 100), units);
+
+  TimeSeries intervalSum = intervalTimeSeries1 + intervalTimeSeries2;
+  TimeSeries detailedSum = intervalTimeSeries1 + detailedTimeSeries;
+  TimeSeries detailedDiff = detailedTimeSeries - intervalTimeSeries1;
+  ASSERT_EQ(8760u, intervalSum.values().size());
+  ASSERT_EQ(8760u, detailedSum.values().size());
+  ASSERT_EQ(8760u, detailedDiff.values().size());
+  ASSERT_TRUE(intervalSum.intervalLength());
+  EXPECT_EQ(interval, *intervalSum.intervalLength());
+  EXPECT_EQ(startDateTime, intervalSum.firstReportDateTime());
+  for (unsigned i = 0; i < 8760; ++i){
+    EXPECT_DOUBLE_EQ(8761.0, intervalSum.values()[i]);
+    EXPECT_DOUBLE_EQ(8761.0, detailedSum.values()[i]);
+    EXPECT_DOUBLE_EQ(values2[i] - values1[i], detailedDiff.values()[i]);
+  }
+
+  // union of report times, every value matches the value of the inputs at that time
+  TimeSeries shiftedSum = intervalTimeSeries1 + shiftedTimeSeries;
+  ASSERT_EQ(8760u + 100u, shiftedSum.values().size());
+  EXPECT_EQ(startDateTime, shiftedSum.firstReportDateTime());
+  for (const DateTime& dateTime : shiftedSum.dateTimes()){
+    EXPECT_DOUBLE_EQ(intervalTimeSeries1.value(dateTime) + shiftedTimeSeries.value(dateTime), shiftedSum.value(dateTime));
+  }
+
+  // sum of aligned series matches pairwise addition
+  std::vector<TimeSeries> timeSeriesVector;
+  timeSeriesVector.push_back(intervalTimeSeries1);
+  timeSeriesVector.push_back(intervalTimeSeries2);
+  timeSeriesVector.push_back(detailedTimeSeries);
+  TimeSeries total = sum(timeSeriesVector);
+  TimeSeries pairwiseTotal = intervalTimeSeries1 + intervalTimeSeries2 + detailedTimeSeries;
+  ASSERT_EQ(8760u, total.values().size());
+  for (unsigned i = 0; i < 8760; ++i){
+    EXPECT_DOUBLE_EQ(pairwiseTotal.values()[i], total.values()[i]);
+  }
+
+  // inputs are unchanged
+  EXPECT_DOUBLE_EQ(1.0, intervalTimeSeries1.values()[0]);
+  EXPECT_DOUBLE_EQ(8760.0, intervalTimeSeries2.values()[0]);
+
+  // not aligned, falls back to pairwise addition
+  timeSeriesVector.push_back(shiftedTimeSeries);
+  total = sum(timeSeriesVector);
+  EXPECT_EQ(8760u + 100u, total.values().size());
+}
+
+TEST_F(DataFixture,TimeSeries_Aggregation)
+{
+  // hourly values for 2009, Jan 1 2009 is a Thursday
+  Date startDate(MonthOfYear(MonthOfYear::Jan), 1, 2009);
+  Vector values = linspace(1, 8760, 8760);
+  TimeSeries timeSeries(startDate, Time(0,1,0,0), values, "W");
+  TimeSeries ones(startDate, Time(0,1,0,0), Vector(8760, 1.0), "W");
+
+  // daily
+  TimeSeries dailyMax = timeSeries.resample(Time(1), TimeSeriesAggregation::Maximum);
+  ASSERT_EQ(365u, dailyMax.values().size());
+  ASSERT_TRUE(dailyMax.intervalLength());
+  EXPECT_EQ(Time(1), *dailyMax.intervalLength());
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 2, 2009)), dailyMax.firstReportDateTime());
+  EXPECT_EQ("W", dailyMax.units());
+  for (unsigned i = 0; i < 365; ++i){
+    EXPECT_DOUBLE_EQ(24.0*(i+1), dailyMax.values()[i]);
+  }
+
+  // value reported at 24:00 belongs to the day ending then
+  TimeSeries dailySum = ones.resample(Time(1), TimeSeriesAggregation::Sum);
+  ASSERT_EQ(365u, dailySum.values().size());
+  EXPECT_DOUBLE_EQ(24.0, dailySum.values()[0]);
+  EXPECT_DOUBLE_EQ(24.0, dailySum.values()[364]);
+
+  // 6 hour bins are reported at their end
+  TimeSeries sixHourSum = ones.resample(Time(0,6,0,0), TimeSeriesAggregation::Sum);
+  ASSERT_EQ(4u*365u, sixHourSum.values().size());
+  EXPECT_EQ(DateTime(startDate, Time(0,6,0,0)), sixHourSum.firstReportDateTime());
+  EXPECT_EQ(DateTime(startDate, Time(0,12,0,0)), sixHourSum.dateTimes()[1]);
+  EXPECT_DOUBLE_EQ(6.0, sixHourSum.values()[0]);
+  EXPECT_DOUBLE_EQ(6.0, sixHourSum.value(DateTime(startDate, Time(0,6,0,0))));
+
+  TimeSeries dailyMin = timeSeries.resample(Time(1), TimeSeriesAggregation::Minimum);
+  TimeSeries dailyMean = timeSeries.resample(Time(1), TimeSeriesAggregation::Mean);
+  TimeSeries dailyMedian = timeSeries.resample(Time(1), TimeSeriesAggregation::Percentile);
+  TimeSeries dailyTop = timeSeries.resample(Time(1), TimeSeriesAggregation::Percentile, 100.0);
+  EXPECT_DOUBLE_EQ(1.0, dailyMin.values()[0]);
+  EXPECT_DOUBLE_EQ(12.5, dailyMean.values()[0]);
+  EXPECT_DOUBLE_EQ(12.5, dailyMedian.values()[0]);
+  EXPECT_DOUBLE_EQ(24.0, dailyTop.values()[0]);
+  EXPECT_DOUBLE_EQ(dailyMax.values()[100], dailyTop.values()[100]);
+
+  EXPECT_THROW(timeSeries.resample(Time(0), TimeSeriesAggregation::Sum), std::exception);
+  EXPECT_THROW(timeSeries.resample(Time(1), TimeSeriesAggregation::Percentile, 101.0), std::exception);
+
+  // month of year
+  Vector monthlySum = ones.aggregateByMonth(TimeSeriesAggregation::Sum);
+  ASSERT_EQ(12u, monthlySum.size());
+  EXPECT_DOUBLE_EQ(31*24.0, monthlySum[0]);
+  EXPECT_DOUBLE_EQ(28*24.0, monthlySum[1]);
+  EXPECT_DOUBLE_EQ(30*24.0, monthlySum[10]);
+  EXPECT_DOUBLE_EQ(31*24.0, monthlySum[11]);
+
+  Vector monthlyMax = timeSeries.aggregateByMonth(TimeSeriesAggregation::Maximum);
+  EXPECT_DOUBLE_EQ(31*24.0, monthlyMax[0]);
+  EXPECT_DOUBLE_EQ(8760.0, monthlyMax[11]);
+
+  // day of week
+  Vector dayOfWeekSum = ones.aggregateByDayOfWeek(TimeSeriesAggregation::Sum);
+  ASSERT_EQ(7u, dayOfWeekSum.size());
+  for (unsigned i = 0; i < 7; ++i){
+    if (i == DayOfWeek::Thursday){
+      EXPECT_DOUBLE_EQ(53*24.0, dayOfWeekSum[i]);
+    }else{
+      EXPECT_DOUBLE_EQ(52*24.0, dayOfWeekSum[i]);
+    }
+  }
+
+  // hour of day, hour ending at 1:00 is index 0
+  Vector hourOfDayMean = timeSeries.aggregateByHourOfDay(TimeSeriesAggregation::Mean);
+  ASSERT_EQ(24u, hourOfDayMean.size());
+  for (unsigned i = 0; i < 24; ++i){
+    EXPECT_DOUBLE_EQ(24*182 + i + 1.0, hourOfDayMean[i]);
+  }
+
+  // load duration curve
+  Vector loadDuration = timeSeries.loadDurationCurve();
+  ASSERT_EQ(8760u, loadDuration.size());
+  EXPECT_DOUBLE_EQ(8760.0, loadDuration[0]);
+  EXPECT_DOUBLE_EQ(1.0, loadDuration[8759]);
+
+  // empty bins are set to the out of range value
+  TimeSeries sparse(DateTimeVector(1, DateTime(startDate, Time(0,1,0,0))), Vector(1, 5.0), "W");
+  sparse.setOutOfRangeValue(-1.0);
+  Vector sparseMonthly = sparse.aggregateByMonth(TimeSeriesAggregation::Sum);
+  EXPECT_DOUBLE_EQ(5.0, sparseMonthly[0]);
+  EXPECT_DOUBLE_EQ(-1.0, sparseMonthly[1]);
+}
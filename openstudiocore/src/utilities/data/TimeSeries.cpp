@@ -20,7 +20,9 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
 #include <exception>
+#include <functional>
 #include <set>
 
 using namespace std;
@@ -28,6 +30,102 @@ using namespace boost;
 
 namespace openstudio{
 
+  namespace {
+
+    const long secondsPerDay = 86400;
+    const long secondsPerHour = 3600;
+
+    // accumulates the values assigned to each bin in a single pass, percentiles keep the values of each bin
+    class BinAggregator
+    {
+    public:
+
+      BinAggregator(unsigned numBins, const TimeSeriesAggregation& aggregation, double percentile)
+        : m_aggregation(aggregation), m_percentile(percentile), m_results(numBins, 0.0), m_counts(numBins, 0)
+      {
+        if ((percentile < 0.0) || (percentile > 100.0)){
+          LOG_FREE_AND_THROW("utilities.TimeSeries_Impl", "Percentile " << percentile << " is not in the range [0, 100]");
+        }
+        if (m_aggregation == TimeSeriesAggregation::Percentile){
+          m_binValues.resize(numBins);
+        }
+      }
+
+      void add(unsigned bin, double value)
+      {
+        double& result = m_results[bin];
+        unsigned& count = m_counts[bin];
+
+        switch (m_aggregation.value()){
+          case TimeSeriesAggregation::Sum:
+          case TimeSeriesAggregation::Mean:
+            result += value;
+            break;
+          case TimeSeriesAggregation::Minimum:
+            if ((count == 0) || (value < result)){
+              result = value;
+            }
+            break;
+          case TimeSeriesAggregation::Maximum:
+            if ((count == 0) || (value > result)){
+              result = value;
+            }
+            break;
+          case TimeSeriesAggregation::Percentile:
+            m_binValues[bin].push_back(value);
+            break;
+          default:
+            OS_ASSERT(false);
+        }
+
+        ++count;
+      }
+
+      // bins without values are set to emptyValue
+      Vector results(double emptyValue)
+      {
+        Vector result(m_results.size());
+        for (unsigned i = 0; i < m_results.size(); ++i){
+          if (m_counts[i] == 0){
+            result[i] = emptyValue;
+          }else if (m_aggregation == TimeSeriesAggregation::Mean){
+            result[i] = m_results[i] / m_counts[i];
+          }else if (m_aggregation == TimeSeriesAggregation::Percentile){
+            result[i] = percentileOf(m_binValues[i]);
+          }else{
+            result[i] = m_results[i];
+          }
+        }
+        return result;
+      }
+
+    private:
+
+      // linear interpolation between the closest ranks, reorders values
+      double percentileOf(std::vector<double>& values) const
+      {
+        double rank = m_percentile / 100.0 * (values.size() - 1);
+        unsigned lower = static_cast<unsigned>(rank);
+
+        std::nth_element(values.begin(), values.begin() + lower, values.end());
+        double result = values[lower];
+        if (lower + 1 < values.size()){
+          double upper = *std::min_element(values.begin() + lower + 1, values.end());
+          result += (rank - lower) * (upper - result);
+        }
+
+        return result;
+      }
+
+      TimeSeriesAggregation m_aggregation;
+      double m_percentile;
+      std::vector<double> m_results;
+      std::vector<unsigned> m_counts;
+      std::vector<std::vector<double> > m_binValues;
+    };
+
+  }
+
   namespace detail{
 
     /// default constructor
@@ -551,31 +649,7 @@ namespace openstudio{
 
       // if same units
       if (m_units == other.units()){
-
-        // make unique, ordered set of all date times
-        std::set<DateTime> dateTimesSet;
-        DateTimeVector dateTimes1 = dateTimes();
-        DateTimeVector dateTimes2 = other.dateTimes();
-        dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-        dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-        // create vector out of set
-        DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
-
-        // compute value at each date time
-        Vector values(dateTimesSet.size());
-        unsigned valueIndex = 0;
-        for (const DateTime& dt : dateTimes){
-          values[valueIndex] = value(dt) + other.value(dt);
-
-          LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
-
-          ++valueIndex;
-        }
-
-        // make new result
-        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
-
+        result = combine(other, 1.0);
       }
       else{
         LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
@@ -591,39 +665,234 @@ namespace openstudio{
 
       // if same units
       if (m_units == other.units()){
+        result = combine(other, -1.0);
+      }
+      else{
+        LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+      }
+
+      return result;
+    }
+
+    bool TimeSeries_Impl::alignedWith(const TimeSeries_Impl& other) const
+    {
+      if (m_secondsFromFirstReport.empty() || (m_secondsFromFirstReport.size() != other.m_secondsFromFirstReport.size())){
+        return false;
+      }
+
+      if (m_firstReportDateTime != other.m_firstReportDateTime){
+        return false;
+      }
 
-        // make unique, ordered set of all date times
-        std::set<DateTime> dateTimesSet;
-        DateTimeVector dateTimes1 = dateTimes();
-        DateTimeVector dateTimes2 = other.dateTimes();
-        dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-        dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+      if (m_intervalLength && other.m_intervalLength){
+        // report times follow from the interval
+        return (*m_intervalLength == *other.m_intervalLength) && (m_intervalLength->totalSeconds() > 0);
+      }
 
-        // create vector out of set
-        DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+      if (m_secondsFromFirstReport != other.m_secondsFromFirstReport){
+        return false;
+      }
 
-        // compute value at each date time
-        Vector values(dateTimesSet.size());
-        unsigned valueIndex = 0;
-        for (const DateTime& dt : dateTimes){
-          values[valueIndex] = value(dt) - other.value(dt);
+      // repeated report times do not have a single value
+      return std::adjacent_find(m_secondsFromFirstReport.begin(), m_secondsFromFirstReport.end()) == m_secondsFromFirstReport.end();
+    }
+
+    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::sumAligned(const std::vector<std::shared_ptr<TimeSeries_Impl> >& series)
+    {
+      OS_ASSERT(!series.empty());
 
-          LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
+      std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl(*series.front()));
+      result->m_outOfRangeValue = 0.0;
 
-          ++valueIndex;
+      for (unsigned i = 1; i < series.size(); ++i){
+        OS_ASSERT(series.front()->alignedWith(*series[i]));
+        noalias(result->m_values) += series[i]->m_values;
+      }
+
+      return result;
+    }
+
+    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combine(const TimeSeries_Impl& other, double otherFactor) const
+    {
+      // same report times, combine the values directly
+      if (alignedWith(other)){
+        std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl(*this));
+        result->m_outOfRangeValue = 0.0;
+        noalias(result->m_values) += otherFactor*other.m_values;
+        return result;
+      }
+
+      // report times can be compared as seconds from the first report of this unless either
+      // series wraps around the end of the year, merge them without going through DateTime
+      if (!m_secondsFromFirstReport.empty() && !other.m_secondsFromFirstReport.empty() &&
+          !m_wrapAround && !other.m_wrapAround &&
+          (m_firstReportDateTime.date().baseYear().is_initialized() == other.m_firstReportDateTime.date().baseYear().is_initialized()))
+      {
+        long offset = (other.m_firstReportDateTime - m_firstReportDateTime).totalSeconds();
+
+        const std::vector<long>& seconds1 = m_secondsFromFirstReport;
+        const std::vector<long>& seconds2 = other.m_secondsFromFirstReport;
+
+        // make unique, ordered union of all report times
+        std::vector<long> seconds;
+        seconds.reserve(seconds1.size() + seconds2.size());
+        unsigned i = 0;
+        unsigned j = 0;
+        while ((i < seconds1.size()) || (j < seconds2.size())){
+          long next;
+          if ((j == seconds2.size()) || ((i < seconds1.size()) && (seconds1[i] < seconds2[j] + offset))){
+            next = seconds1[i++];
+          }else if ((i == seconds1.size()) || (seconds2[j] + offset < seconds1[i])){
+            next = seconds2[j++] + offset;
+          }else{
+            next = seconds1[i++];
+            ++j;
+          }
+
+          if (seconds.empty() || (seconds.back() != next)){
+            seconds.push_back(next);
+          }
         }
 
-        // make new result
-        result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+        // compute value at each report time
+        Vector values(seconds.size());
+        for (unsigned k = 0; k < seconds.size(); ++k){
+          values[k] = valueAtSecondsFromFirstReport(seconds[k]) + otherFactor*other.valueAtSecondsFromFirstReport(seconds[k] - offset);
+        }
+
+        // result starts at the earliest report time
+        long first = seconds.front();
+        for (long& second : seconds){
+          second -= first;
+        }
 
+        return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime + Time(0,0,0,first), seconds, values, m_units));
       }
-      else{
-        LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+
+      // make unique, ordered set of all date times
+      std::set<DateTime> dateTimesSet;
+      DateTimeVector dateTimes1 = dateTimes();
+      DateTimeVector dateTimes2 = other.dateTimes();
+      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
+      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
+
+      // create vector out of set
+      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+
+      // compute value at each date time
+      Vector values(dateTimesSet.size());
+      unsigned valueIndex = 0;
+      for (const DateTime& dt : dateTimes){
+        values[valueIndex] = value(dt) + otherFactor*other.value(dt);
+        ++valueIndex;
+      }
+
+      // make new result
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    }
+
+    std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::resample(const Time& interval, const TimeSeriesAggregation& aggregation, double percentile) const
+    {
+      long secondsPerInterval = interval.totalSeconds();
+      if (secondsPerInterval <= 0){
+        LOG_AND_THROW("Cannot resample timeseries to interval length " << interval);
+      }
+
+      if (m_secondsFromFirstReport.empty()){
+        LOG(Warn, "Resampling empty timeseries returns an empty timeseries");
+        return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+      }
+
+      // bins start at midnight of the first reporting interval
+      Date firstDay = firstReportDay();
+      long offset = (m_firstReportDateTime - DateTime(firstDay)).totalSeconds() - 1;
+      unsigned numBins = (offset + m_secondsFromFirstReport.back()) / secondsPerInterval + 1;
+
+      BinAggregator aggregator(numBins, aggregation, percentile);
+      for (unsigned i = 0; i < m_secondsFromFirstReport.size(); ++i){
+        aggregator.add((offset + m_secondsFromFirstReport[i]) / secondsPerInterval, m_values[i]);
       }
 
+      // each bin is reported at its end, the first one interval after midnight
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(firstDay, interval, aggregator.results(m_outOfRangeValue), m_units));
+    }
+
+    Vector TimeSeries_Impl::aggregateByMonth(const TimeSeriesAggregation& aggregation, double percentile) const
+    {
+      BinAggregator aggregator(12, aggregation, percentile);
+
+      if (!m_secondsFromFirstReport.empty()){
+        Date firstDay = firstReportDay();
+        long offset = (m_firstReportDateTime - DateTime(firstDay)).totalSeconds() - 1;
+
+        // walk forward through the calendar, first day after the current month is in days from firstDay
+        int year = firstDay.year();
+        unsigned month = firstDay.monthOfYear().value();
+        long monthEnd = gregorian::gregorian_calendar::end_of_month_day(year, month) - firstDay.dayOfMonth() + 1;
+
+        for (unsigned i = 0; i < m_secondsFromFirstReport.size(); ++i){
+          long day = (offset + m_secondsFromFirstReport[i]) / secondsPerDay;
+          while (day >= monthEnd){
+            if (month == 12){
+              month = 1;
+              ++year;
+            }else{
+              ++month;
+            }
+            monthEnd += gregorian::gregorian_calendar::end_of_month_day(year, month);
+          }
+          aggregator.add(month - 1, m_values[i]);
+        }
+      }
+
+      return aggregator.results(m_outOfRangeValue);
+    }
+
+    Vector TimeSeries_Impl::aggregateByDayOfWeek(const TimeSeriesAggregation& aggregation, double percentile) const
+    {
+      BinAggregator aggregator(7, aggregation, percentile);
+
+      if (!m_secondsFromFirstReport.empty()){
+        Date firstDay = firstReportDay();
+        long offset = (m_firstReportDateTime - DateTime(firstDay)).totalSeconds() - 1;
+        long firstDayOfWeek = firstDay.dayOfWeek().value();
+
+        for (unsigned i = 0; i < m_secondsFromFirstReport.size(); ++i){
+          long day = (offset + m_secondsFromFirstReport[i]) / secondsPerDay;
+          aggregator.add((firstDayOfWeek + day) % 7, m_values[i]);
+        }
+      }
+
+      return aggregator.results(m_outOfRangeValue);
+    }
+
+    Vector TimeSeries_Impl::aggregateByHourOfDay(const TimeSeriesAggregation& aggregation, double percentile) const
+    {
+      BinAggregator aggregator(24, aggregation, percentile);
+
+      if (!m_secondsFromFirstReport.empty()){
+        long offset = (m_firstReportDateTime - DateTime(firstReportDay())).totalSeconds() - 1;
+
+        for (unsigned i = 0; i < m_secondsFromFirstReport.size(); ++i){
+          aggregator.add(((offset + m_secondsFromFirstReport[i]) % secondsPerDay) / secondsPerHour, m_values[i]);
+        }
+      }
+
+      return aggregator.results(m_outOfRangeValue);
+    }
+
+    Vector TimeSeries_Impl::loadDurationCurve() const
+    {
+      Vector result(m_values);
+      std::sort(result.begin(), result.end(), std::greater<double>());
       return result;
     }
 
+    Date TimeSeries_Impl::firstReportDay() const
+    {
+      return (m_firstReportDateTime - Time(0,0,0,1)).date();
+    }
+
     std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
 
       return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, 
@@ -790,6 +1059,26 @@ namespace openstudio{
     return TimeSeries(impl);
   }
 
+  TimeSeries TimeSeries::resample(const Time& interval, const TimeSeriesAggregation& aggregation, double percentile) const {
+    return TimeSeries(m_impl->resample(interval, aggregation, percentile));
+  }
+
+  Vector TimeSeries::aggregateByMonth(const TimeSeriesAggregation& aggregation, double percentile) const {
+    return m_impl->aggregateByMonth(aggregation, percentile);
+  }
+
+  Vector TimeSeries::aggregateByDayOfWeek(const TimeSeriesAggregation& aggregation, double percentile) const {
+    return m_impl->aggregateByDayOfWeek(aggregation, percentile);
+  }
+
+  Vector TimeSeries::aggregateByHourOfDay(const TimeSeriesAggregation& aggregation, double percentile) const {
+    return m_impl->aggregateByHourOfDay(aggregation, percentile);
+  }
+
+  Vector TimeSeries::loadDurationCurve() const {
+    return m_impl->loadDurationCurve();
+  }
+
   // constructor from impl
   TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl)
     : m_impl(impl)
@@ -800,6 +1089,22 @@ namespace openstudio{
   }
 
   TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
+    // series that all report at the same times are added up in one pass
+    if (!timeSeriesVector.empty()) {
+      std::vector<std::shared_ptr<detail::TimeSeries_Impl> > impls;
+      const TimeSeries& firstSeries = timeSeriesVector.front();
+      for (const TimeSeries& ts : timeSeriesVector) {
+        if ((ts.units() != firstSeries.units()) || !firstSeries.m_impl->alignedWith(*ts.m_impl)) {
+          impls.clear();
+          break;
+        }
+        impls.push_back(ts.m_impl);
+      }
+      if (!impls.empty()) {
+        return TimeSeries(detail::TimeSeries_Impl::sumAligned(impls));
+      }
+    }
+
     TimeSeries result;
     bool first = true;
     for (const TimeSeries& ts : timeSeriesVector) {
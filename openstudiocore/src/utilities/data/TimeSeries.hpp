@@ -23,6 +23,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "Vector.hpp"
+#include "../core/Enum.hpp"
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
 #include "../time/DateTime.hpp"
@@ -34,6 +35,27 @@
 
 namespace openstudio{
 
+  /** \class TimeSeriesAggregation
+   *  \brief How the values falling into one bin are combined when aggregating a TimeSeries.
+   *  \details See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual
+   *  macro call is:
+   *  \code
+  OPENSTUDIO_ENUM(TimeSeriesAggregation,
+    ((Sum))
+    ((Mean))
+    ((Minimum))
+    ((Maximum))
+    ((Percentile))
+  );
+   *  \endcode */
+  OPENSTUDIO_ENUM(TimeSeriesAggregation,
+    ((Sum))
+    ((Mean))
+    ((Minimum))
+    ((Maximum))
+    ((Percentile))
+  );
+
   namespace detail{
 
     class UTILITIES_API TimeSeries_Impl
@@ -134,8 +156,36 @@ namespace openstudio{
         /** TimeSeries * double */
         std::shared_ptr<TimeSeries_Impl> operator*(double d) const;
 
+        /// true if other reports at exactly the same times as this, so that values can be combined element by element
+        bool alignedWith(const TimeSeries_Impl& other) const;
+
+        /// sum of series that are all alignedWith the first one, computed in a single pass
+        static std::shared_ptr<TimeSeries_Impl> sumAligned(const std::vector<std::shared_ptr<TimeSeries_Impl> >& series);
+
+        /// values aggregated into bins of length interval, the first bin starts at midnight of the first reporting interval
+        std::shared_ptr<TimeSeries_Impl> resample(const Time& interval, const TimeSeriesAggregation& aggregation, double percentile) const;
+
+        /// values aggregated by month of year, index 0 is January
+        Vector aggregateByMonth(const TimeSeriesAggregation& aggregation, double percentile) const;
+
+        /// values aggregated by day of week, index 0 is Sunday
+        Vector aggregateByDayOfWeek(const TimeSeriesAggregation& aggregation, double percentile) const;
+
+        /// values aggregated by hour of day, index 0 is the hour ending at 1:00
+        Vector aggregateByHourOfDay(const TimeSeriesAggregation& aggregation, double percentile) const;
+
+        /// values sorted from largest to smallest
+        Vector loadDurationCurve() const;
+
       private:
 
+        /// this + otherFactor*other at the union of the report times of both, units are not checked
+        std::shared_ptr<TimeSeries_Impl> combine(const TimeSeries_Impl& other, double otherFactor) const;
+
+        /// day containing the last second of the first reporting interval, values are assigned to calendar
+        /// bins by the last second of their reporting interval so the value reported at 24:00 belongs to that day
+        Date firstReportDay() const;
+
         REGISTER_LOGGER("utilities.TimeSeries_Impl");
         // fully qualified first report date
         DateTime m_firstReportDateTime;
@@ -273,9 +323,34 @@ namespace openstudio{
       /** TimeSeries / double */
       TimeSeries operator/(double d) const;
 
+      //@}
+      /** @name Aggregation
+       *  Each value is assigned to the bin containing the last second of its reporting interval, so the
+       *  value reported at 24:00 belongs to the day ending at that time. Bins without values are set to
+       *  outOfRangeValue. percentile is only used with TimeSeriesAggregation::Percentile and is given
+       *  in the range [0, 100]. */
+      //@{
+
+      /// values aggregated into bins of length interval, the first bin starts at midnight of the first reporting interval
+      TimeSeries resample(const Time& interval, const TimeSeriesAggregation& aggregation, double percentile = 50.0) const;
+
+      /// values aggregated by month of year, index 0 is January
+      Vector aggregateByMonth(const TimeSeriesAggregation& aggregation, double percentile = 50.0) const;
+
+      /// values aggregated by day of week, index 0 is Sunday as in DayOfWeek
+      Vector aggregateByDayOfWeek(const TimeSeriesAggregation& aggregation, double percentile = 50.0) const;
+
+      /// values aggregated by hour of day, index 0 is the hour ending at 1:00
+      Vector aggregateByHourOfDay(const TimeSeriesAggregation& aggregation, double percentile = 50.0) const;
+
+      /// values sorted from largest to smallest, for a series with an interval length each value lasts one interval
+      Vector loadDurationCurve() const;
+
       //@}
     private:
 
+      friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+
       REGISTER_LOGGER("utilities.TimeSeries");
       // constructor from impl
       TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
@@ -34,10 +34,323 @@
 #include <QFile>
 #include <QTextStream>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 namespace openstudio{
 
+// Column parsing support. The helpers below reproduce, without QString, the conversions and range
+// checks that the EpwDataPoint string setters apply, so that the columns report exactly the values
+// that EpwDataPoint::field reports.
+
+struct EpwToken
+{
+  const char* begin;
+  const char* end;
+};
+
+enum EpwColumnKind
+{
+  EpwNoColumn,      // date, time, and data source fields
+  EpwCheckedColumn, // invalid text or out of range values are stored as the missing code
+  EpwPlainColumn,   // invalid text is stored as the missing code, no range check
+  EpwSkyCoverColumn,// integer, invalid or out of range values are stored as 99, never missing
+  EpwCodeColumn     // integer, invalid text is stored as 0, never missing
+};
+
+struct EpwColumnSpec
+{
+  EpwColumnKind kind;
+  double missing;
+  double minimum;        // values below the minimum are invalid
+  bool minimumExclusive; // values equal to the minimum are invalid as well
+  double maximum;        // values above the maximum are invalid
+};
+
+static const double epwNoLimit = std::numeric_limits<double>::infinity();
+
+// indexed by EpwDataField
+static const EpwColumnSpec epwColumnSpecs[] = {
+  {EpwNoColumn, 0.0, 0.0, false, 0.0}, // Year
+  {EpwNoColumn, 0.0, 0.0, false, 0.0}, // Month
+  {EpwNoColumn, 0.0, 0.0, false, 0.0}, // Day
+  {EpwNoColumn, 0.0, 0.0, false, 0.0}, // Hour
+  {EpwNoColumn, 0.0, 0.0, false, 0.0}, // Minute
+  {EpwNoColumn, 0.0, 0.0, false, 0.0}, // DataSourceandUncertaintyFlags
+  {EpwCheckedColumn, 99.9, -70.0, true, epwNoLimit}, // DryBulbTemperature
+  {EpwCheckedColumn, 99.9, -70.0, true, epwNoLimit}, // DewPointTemperature
+  {EpwCheckedColumn, 999.0, 0.0, false, 110.0}, // RelativeHumidity
+  {EpwCheckedColumn, 999999.0, 31000.0, true, epwNoLimit}, // AtmosphericStationPressure
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // ExtraterrestrialHorizontalRadiation
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // ExtraterrestrialDirectNormalRadiation
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // HorizontalInfraredRadiationIntensity
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // GlobalHorizontalRadiation
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // DirectNormalRadiation
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // DiffuseHorizontalRadiation
+  {EpwCheckedColumn, 999999.0, 0.0, false, epwNoLimit}, // GlobalHorizontalIlluminance
+  {EpwCheckedColumn, 999999.0, 0.0, false, epwNoLimit}, // DirectNormalIlluminance
+  {EpwCheckedColumn, 999999.0, 0.0, false, epwNoLimit}, // DiffuseHorizontalIlluminance
+  {EpwCheckedColumn, 9999.0, 0.0, false, epwNoLimit}, // ZenithLuminance
+  {EpwCheckedColumn, 999.0, 0.0, false, 360.0}, // WindDirection
+  {EpwCheckedColumn, 999.0, 0.0, false, 40.0}, // WindSpeed
+  {EpwSkyCoverColumn, 99.0, 0.0, false, 10.0}, // TotalSkyCover
+  {EpwSkyCoverColumn, 99.0, 0.0, false, 10.0}, // OpaqueSkyCover
+  {EpwPlainColumn, 9999.0, 0.0, false, 0.0}, // Visibility
+  {EpwPlainColumn, 99999.0, 0.0, false, 0.0}, // CeilingHeight
+  {EpwCodeColumn, 0.0, 0.0, false, 0.0}, // PresentWeatherObservation
+  {EpwCodeColumn, 0.0, 0.0, false, 0.0}, // PresentWeatherCodes
+  {EpwPlainColumn, 999.0, 0.0, false, 0.0}, // PrecipitableWater
+  {EpwPlainColumn, .999, 0.0, false, 0.0}, // AerosolOpticalDepth
+  {EpwPlainColumn, 999.0, 0.0, false, 0.0}, // SnowDepth
+  {EpwPlainColumn, 99.0, 0.0, false, 0.0}, // DaysSinceLastSnowfall
+  {EpwPlainColumn, 999.0, 0.0, false, 0.0}, // Albedo
+  {EpwPlainColumn, 999.0, 0.0, false, 0.0}, // LiquidPrecipitationDepth
+  {EpwPlainColumn, 99.0, 0.0, false, 0.0}, // LiquidPrecipitationQuantity
+};
+
+static const unsigned epwNumFields = sizeof(epwColumnSpecs)/sizeof(epwColumnSpecs[0]);
+
+static bool isEpwSpace(char c)
+{
+  return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+}
+
+static void trimEpwToken(EpwToken& token)
+{
+  while ((token.begin != token.end) && isEpwSpace(*token.begin)) {
+    ++token.begin;
+  }
+  while ((token.end != token.begin) && isEpwSpace(*(token.end - 1))) {
+    --token.end;
+  }
+}
+
+// Splits line at commas into tokens, returns the number of fields found, which may exceed maxTokens
+static unsigned splitEpwLine(const std::string& line, EpwToken* tokens, unsigned maxTokens)
+{
+  const char* it = line.data();
+  const char* end = it + line.size();
+  unsigned n = 0;
+  while (true) {
+    const char* fieldEnd = it;
+    while ((fieldEnd != end) && (*fieldEnd != ',')) {
+      ++fieldEnd;
+    }
+    if (n < maxTokens) {
+      tokens[n].begin = it;
+      tokens[n].end = fieldEnd;
+    }
+    ++n;
+    if (fieldEnd == end) {
+      break;
+    }
+    it = fieldEnd + 1;
+  }
+  return n;
+}
+
+// Same result as QString::toInt, an optional sign followed by decimal digits
+static bool parseEpwInt(EpwToken token, int& value)
+{
+  trimEpwToken(token);
+  const char* it = token.begin;
+  bool negative = false;
+  if ((it != token.end) && ((*it == '-') || (*it == '+'))) {
+    negative = (*it == '-');
+    ++it;
+  }
+  if (it == token.end) {
+    return false;
+  }
+  long long result = 0;
+  for (; it != token.end; ++it) {
+    if ((*it < '0') || (*it > '9')) {
+      return false;
+    }
+    result = 10*result + (*it - '0');
+    if (result > 2147483648LL) {
+      return false;
+    }
+  }
+  if (negative) {
+    result = -result;
+  }
+  if (result > std::numeric_limits<int>::max()) {
+    return false;
+  }
+  value = static_cast<int>(result);
+  return true;
+}
+
+// Same result as QString::toDouble for the decimal numbers found in EPW files. Numbers with at most
+// 15 significant digits and a small exponent are converted exactly with one correctly rounded
+// multiplication or division, anything else goes through a stream in the classic locale.
+static bool parseEpwDouble(EpwToken token, double& value)
+{
+  static const double powersOfTen[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                       1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  trimEpwToken(token);
+  const char* it = token.begin;
+  bool negative = false;
+  if ((it != token.end) && ((*it == '-') || (*it == '+'))) {
+    negative = (*it == '-');
+    ++it;
+  }
+
+  unsigned long long mantissa = 0;
+  int significantDigits = 0;
+  int exponent = 0;
+  bool hasDigits = false;
+  for (; (it != token.end) && (*it >= '0') && (*it <= '9'); ++it) {
+    hasDigits = true;
+    if (significantDigits < 16) {
+      mantissa = 10*mantissa + (*it - '0');
+    }else{
+      ++exponent;
+    }
+    if (mantissa != 0) {
+      ++significantDigits;
+    }
+  }
+  if ((it != token.end) && (*it == '.')) {
+    for (++it; (it != token.end) && (*it >= '0') && (*it <= '9'); ++it) {
+      hasDigits = true;
+      if (significantDigits < 16) {
+        mantissa = 10*mantissa + (*it - '0');
+        --exponent;
+      }
+      if (mantissa != 0) {
+        ++significantDigits;
+      }
+    }
+  }
+  if (!hasDigits) {
+    return false;
+  }
+  if ((it != token.end) && ((*it == 'e') || (*it == 'E'))) {
+    ++it;
+    bool negativeExponent = false;
+    if ((it != token.end) && ((*it == '-') || (*it == '+'))) {
+      negativeExponent = (*it == '-');
+      ++it;
+    }
+    if ((it == token.end) || (*it < '0') || (*it > '9')) {
+      return false;
+    }
+    int explicitExponent = 0;
+    for (; (it != token.end) && (*it >= '0') && (*it <= '9'); ++it) {
+      if (explicitExponent < 100000) {
+        explicitExponent = 10*explicitExponent + (*it - '0');
+      }
+    }
+    exponent += negativeExponent ? -explicitExponent : explicitExponent;
+  }
+  if (it != token.end) {
+    return false;
+  }
+
+  if (mantissa == 0) {
+    value = negative ? -0.0 : 0.0;
+    return true;
+  }
+  if ((significantDigits <= 15) && (exponent >= -22) && (exponent <= 22)) {
+    double result = static_cast<double>(mantissa);
+    if (exponent < 0) {
+      result /= powersOfTen[-exponent];
+    }else{
+      result *= powersOfTen[exponent];
+    }
+    value = negative ? -result : result;
+    return true;
+  }
+
+  std::istringstream ss(std::string(token.begin, token.end));
+  ss.imbue(std::locale::classic());
+  double result;
+  ss >> result;
+  if (ss.fail() || std::isinf(result)) {
+    return false;
+  }
+  value = result;
+  return true;
+}
+
+// Converts one field the way its EpwDataPoint string setter and getter would, returns true if missing
+static bool parseEpwColumnValue(const EpwColumnSpec& spec, const EpwToken& token, double& value)
+{
+  int ivalue;
+  switch (spec.kind) {
+  case EpwCheckedColumn:
+    if (!parseEpwDouble(token, value) ||
+        (value < spec.minimum) ||
+        (spec.minimumExclusive && (value == spec.minimum)) ||
+        (value > spec.maximum)) {
+      value = spec.missing;
+      return true;
+    }
+    return value == spec.missing;
+  case EpwPlainColumn:
+    if (!parseEpwDouble(token, value)) {
+      value = spec.missing;
+      return true;
+    }
+    return value == spec.missing;
+  case EpwSkyCoverColumn:
+    if (!parseEpwInt(token, ivalue) || (ivalue < spec.minimum) || (ivalue > spec.maximum)) {
+      ivalue = static_cast<int>(spec.missing);
+    }
+    value = ivalue;
+    return false;
+  case EpwCodeColumn:
+    if (!parseEpwInt(token, ivalue)) {
+      ivalue = 0;
+    }
+    value = ivalue;
+    return false;
+  default:
+    value = 0.0;
+    return true;
+  }
+}
+
+// Appends one record to the columns, fails where EpwDataPoint::fromEpwString would
+static bool appendEpwColumns(const EpwToken* tokens, unsigned numTokens, int minute,
+                             std::vector<DateTime>& dateTimes,
+                             std::vector<std::vector<double> >& columns,
+                             std::vector<std::vector<unsigned char> >& missing)
+{
+  if(numTokens != epwNumFields) {
+    LOG_FREE(Error,"openstudio.EpwFile","Expected 35 fields in EPW data, got " << numTokens);
+    return false;
+  }
+  int year, month, day, hour;
+  if(!parseEpwInt(tokens[EpwDataField::Year], year) ||
+     !parseEpwInt(tokens[EpwDataField::Month], month) || (1 > month) || (12 < month) ||
+     !parseEpwInt(tokens[EpwDataField::Day], day) || (1 > day) || (31 < day) ||
+     !parseEpwInt(tokens[EpwDataField::Hour], hour) || (1 > hour) || (24 < hour)) {
+    LOG_FREE(Error,"openstudio.EpwFile","Invalid date or time in EPW data");
+    return false;
+  }
+  try {
+    // same date and time as EpwDataPoint::dateTime, without the year
+    dateTimes.push_back(DateTime(Date(MonthOfYear(month),day),Time(0,hour,minute)));
+  } catch(const std::exception&) {
+    LOG_FREE(Error,"openstudio.EpwFile","Invalid date or time in EPW data");
+    return false;
+  }
+  for(unsigned i = EpwDataField::DryBulbTemperature; i < epwNumFields; ++i) {
+    double value;
+    bool isMissing = parseEpwColumnValue(epwColumnSpecs[i], tokens[i], value);
+    columns[i].push_back(value);
+    missing[i].push_back(isMissing ? 1 : 0);
+  }
+  return true;
+}
+
 EpwDataPoint::EpwDataPoint()
 {
   m_year=1;
@@ -1719,11 +2032,8 @@ std::vector<EpwDataPoint> EpwFile::data()
 
 boost::optional<TimeSeries> EpwFile::getTimeSeries(std::string name)
 {
-  if(m_data.size()==0){
-    if (!parse(true)){
-      LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::optional<TimeSeries>();
-    }
+  if(!parseColumns()){
+    return boost::optional<TimeSeries>();
   }
   EpwDataField id;
   try
@@ -1735,30 +2045,68 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(std::string name)
     // Could do a warning message here
     return boost::optional<TimeSeries>();
   }
-  if(m_data.size())
+  const std::vector<double>& column = m_columns[id.value()];
+  const std::vector<unsigned char>& missing = m_missing[id.value()];
+  unsigned n = std::count(missing.begin(), missing.end(), 0);
+  if(n)
   {
     std::string units = EpwDataPoint::units(id);
     DateTimeVector dates;
-    std::vector<double> values;
-    for(unsigned int i=0;i<m_data.size();i++)
+    dates.reserve(n);
+    Vector values(n);
+    unsigned j = 0;
+    for(unsigned i=0;i<column.size();i++)
     {
-      Date date=m_data[i].date();
-      Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].field(id);
-      if(value)
+      if(!missing[i])
       {
-        dates.push_back(DateTime(date,time));
-        values.push_back(value.get());
+        dates.push_back(m_dateTimes[i]);
+        values[j++] = column[i];
       }
     }
-    if(dates.size())
-    {
-      return boost::optional<TimeSeries>(TimeSeries(dates,openstudio::createVector(values),units));
-    }
+    return boost::optional<TimeSeries>(TimeSeries(dates,values,units));
   }
   return boost::optional<TimeSeries>();
 }
 
+const std::vector<DateTime>& EpwFile::dateTimes()
+{
+  parseColumns();
+  return m_dateTimes;
+}
+
+const std::vector<double>& EpwFile::getColumn(EpwDataField field)
+{
+  static const std::vector<double> empty;
+  if(!parseColumns()){
+    return empty;
+  }
+  return m_columns[field.value()];
+}
+
+const std::vector<unsigned char>& EpwFile::getMissingMask(EpwDataField field)
+{
+  static const std::vector<unsigned char> empty;
+  if(!parseColumns()){
+    return empty;
+  }
+  return m_missing[field.value()];
+}
+
+bool EpwFile::parseColumns()
+{
+  if(!m_columns.empty()){
+    return true;
+  }
+  if(parse(false, true)){
+    return true;
+  }
+  LOG(Error,"EpwFile '" << toString(m_path) << "' cannot be processed");
+  m_dateTimes.clear();
+  m_columns.clear();
+  m_missing.clear();
+  return false;
+}
+
 bool EpwFile::translateToWth(openstudio::path path, std::string description)
 {
   if(m_data.size()==0)
@@ -1838,7 +2186,7 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description)
   return true;
 }
 
-bool EpwFile::parse(bool storeData)
+bool EpwFile::parse(bool storeData, bool storeColumns)
 {
   if (!boost::filesystem::exists(m_path) || !boost::filesystem::is_regular_file(m_path)){
     LOG(Error, "Path '" << m_path << "' is not an EPW file");
@@ -1899,14 +2247,21 @@ bool EpwFile::parse(bool storeData)
   OS_ASSERT((60 % m_recordsPerHour) == 0);
   int minutesPerRecord = 60/m_recordsPerHour;
   int currentMinute = 0;
+  if(storeColumns)
+  {
+    m_dateTimes.clear();
+    m_columns.assign(epwNumFields, std::vector<double>());
+    m_missing.assign(epwNumFields, std::vector<unsigned char>());
+  }
+  EpwToken tokens[epwNumFields];
   while(std::getline(ifs, line)){
     lineNumber++;
-    boost::regex dateRegex("^(.*?),(.*?),(.*?),.*");
-    boost::smatch matches;
-    if (boost::regex_search(line, matches, dateRegex)){
-      std::string year = std::string(matches[1].first, matches[1].second); boost::trim(year);
-      std::string month = std::string(matches[2].first, matches[2].second); boost::trim(month);
-      std::string day = std::string(matches[3].first, matches[3].second); boost::trim(day);
+    // the year, month, and day are the first three of at least four fields
+    unsigned numTokens = splitEpwLine(line, tokens, epwNumFields);
+    if (numTokens >= 4){
+      std::string year(tokens[0].begin, tokens[0].end); boost::trim(year);
+      std::string month(tokens[1].begin, tokens[1].end); boost::trim(month);
+      std::string day(tokens[2].begin, tokens[2].end); boost::trim(day);
 
       try{
         Date date(boost::lexical_cast<int>(month), boost::lexical_cast<int>(day), boost::lexical_cast<int>(year));
@@ -1932,18 +2287,22 @@ bool EpwFile::parse(bool storeData)
         ifs.close();
         return false;
       }
+      int minute = 0;
+      if(m_recordsPerHour!=1)
+      {
+        currentMinute += minutesPerRecord;
+        if(currentMinute >= 60) { // This could really be ==, but >= is used for safety
+          currentMinute = 0;
+        }
+        minute = currentMinute;
+      }
       if(storeData)
       {
         boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwString(line);
-        if(m_recordsPerHour!=1)
-        {
-          currentMinute += minutesPerRecord;
-          if(currentMinute >= 60) { // This could really be ==, but >= is used for safety
-            currentMinute = 0;
-          }
-          pt->setMinute(currentMinute);
-        }
         if(pt) {
+          if(m_recordsPerHour!=1) {
+            pt->setMinute(minute);
+          }
           m_data.push_back(pt.get());
         } else {
           LOG(Error,"Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
@@ -1951,6 +2310,14 @@ bool EpwFile::parse(bool storeData)
           return false;
         }
       }
+      if(storeColumns)
+      {
+        if(!appendEpwColumns(tokens, numTokens, minute, m_dateTimes, m_columns, m_missing)) {
+          LOG(Error,"Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
+          ifs.close();
+          return false;
+        }
+      }
     }else{
       LOG(Error, "Could not read line " << lineNumber << " of EPW file '" << m_path << "'");
       ifs.close();
@@ -322,12 +322,23 @@ public:
   // This will probably need to include the period at some point, but for now just dump everything into a time series
   boost::optional<TimeSeries> getTimeSeries(std::string field);
 
+  /// get the date and time of each weather record, the numeric fields are read into columns on first use
+  const std::vector<DateTime>& dateTimes();
+
+  /// get the values of a numeric field, one per record in file order. Missing or invalid values hold
+  /// the field's missing value code. The column is empty for the date, time, and data source fields.
+  const std::vector<double>& getColumn(EpwDataField field);
+
+  /// get the missing value mask of getColumn, nonzero for each record where the value is missing
+  const std::vector<unsigned char>& getMissingMask(EpwDataField field);
+
   /// export to CONTAM WTH file
   bool translateToWth(openstudio::path path,std::string description=std::string());
 
 private:
 
-  bool parse(bool storeData=false);
+  bool parse(bool storeData=false, bool storeColumns=false);
+  bool parseColumns();
   bool parseLocation(const std::string& line);
   bool parseDataPeriod(const std::string& line);
 
@@ -352,6 +363,10 @@ private:
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
   std::vector<EpwDataPoint> m_data;
+  // columnar store, one column and mask per EpwDataField, all fields of a record at the same index
+  std::vector<DateTime> m_dateTimes;
+  std::vector<std::vector<double> > m_columns;
+  std::vector<std::vector<unsigned char> > m_missing;
 };
 
 UTILITIES_API IdfObject toIdfObject(const EpwFile& epwFile);
@@ -17,6 +17,9 @@
 %template(EpwFileVector) std::vector<openstudio::EpwFile>;
 %template(OptionalEpwFile) boost::optional<openstudio::EpwFile>;
 
+// no std::vector<unsigned char> template, the same information is in getTimeSeries
+%ignore openstudio::EpwFile::getMissingMask;
+
 %include <utilities/filetypes/EpwFile.hpp>
 
 #endif //UTILITIES_FILETYPES_I 
@@ -292,3 +292,51 @@ TEST(Filetypes, EpwFile_Wrap_AMY)
     ASSERT_TRUE(false);
   }
 }
+
+TEST(Filetypes, EpwFile_Columns)
+{
+  path p = resourcesPath() / toPath("runmanager/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760u, data.size());
+
+  const std::vector<DateTime>& dateTimes = epwFile.dateTimes();
+  ASSERT_EQ(8760u, dateTimes.size());
+  for (unsigned i = 0; i < data.size(); ++i) {
+    EXPECT_EQ(data[i].dateTime(), dateTimes[i]);
+  }
+
+  // the date, time, and data source fields have no column
+  EXPECT_TRUE(epwFile.getColumn(EpwDataField::Year).empty());
+  EXPECT_TRUE(epwFile.getMissingMask(EpwDataField::DataSourceandUncertaintyFlags).empty());
+
+  // every numeric column agrees with the data points
+  for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+    EpwDataField id(field);
+    const std::vector<double>& column = epwFile.getColumn(id);
+    const std::vector<unsigned char>& missing = epwFile.getMissingMask(id);
+    ASSERT_EQ(8760u, column.size()) << id.valueName();
+    ASSERT_EQ(8760u, missing.size()) << id.valueName();
+    for (unsigned i = 0; i < data.size(); ++i) {
+      boost::optional<double> value = data[i].field(id);
+      ASSERT_EQ(!value, missing[i] != 0) << id.valueName() << " record " << i;
+      if (value) {
+        EXPECT_DOUBLE_EQ(value.get(), column[i]) << id.valueName() << " record " << i;
+      }
+    }
+  }
+
+  // the last record has a dry bulb temperature of 4C and no liquid precipitation depth
+  EXPECT_EQ(4.0, epwFile.getColumn(EpwDataField::DryBulbTemperature)[8759]);
+  EXPECT_TRUE(epwFile.getMissingMask(EpwDataField::LiquidPrecipitationDepth)[8759] != 0);
+
+  boost::optional<TimeSeries> series = epwFile.getTimeSeries("Dry Bulb Temperature");
+  ASSERT_TRUE(series);
+  ASSERT_EQ(8760u, series->values().size());
+  EXPECT_EQ(dateTimes, series->dateTimes());
+  EXPECT_EQ(4.0, series->values()[8759]);
+  EXPECT_EQ("C", series->units());
+
+  EXPECT_FALSE(epwFile.getTimeSeries("Liquid Precipitation Depth"));
+  EXPECT_FALSE(epwFile.getTimeSeries("Not A Field"));
+}
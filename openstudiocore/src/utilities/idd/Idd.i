@@ -58,6 +58,11 @@
 // ignore ostream related functions
 %ignore print(std::ostream&, bool) const;
 
+// ignore construction from pre-parsed IddFactory data
+%ignore openstudio::IddKey::fromTable;
+%ignore openstudio::IddField::fromTable;
+%ignore openstudio::IddObject::fromTable;
+
 // include the headers into the swig interface directly
 %include <utilities/idd/IddEnums.hpp>
 
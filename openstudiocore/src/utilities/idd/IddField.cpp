@@ -20,8 +20,6 @@
 #include "IddField.hpp"
 #include "IddField_Impl.hpp"
 
-#include "IddRegex.hpp"
-#include "CommentRegex.hpp"
 #include <utilities/idd/IddFactory.hxx>
 
 #include "../units/Unit.hpp"
@@ -39,11 +37,10 @@
 #include <boost/filesystem/fstream.hpp>
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/regex.hpp>
 
 #include <algorithm>
 
-using boost::algorithm::trim;
-
 namespace openstudio {
 
 namespace detail {
@@ -241,13 +238,61 @@ namespace detail {
                                                        const std::string& text,
                                                        const std::string& objectName) {
 
-    std::shared_ptr<IddField_Impl> result;
-    IddField_Impl iddFieldImpl(name,objectName);
+    iddParser::IddFieldData data;
+    data.name = name;
+
+    try {
+      iddParser::parseField(data,text,objectName,[](bool error, const std::string& message) {
+        if (error) { LOG(Error,message); }
+        else { LOG(Info,message); }
+      });
+    }
+    catch (std::exception& e) {
+      LOG(Error,e.what());
+      return std::shared_ptr<IddField_Impl>();
+    }
+
+    IddFieldTableView view(data);
+    return fromTable(view.table(),objectName);
+  }
 
-    try { iddFieldImpl.parse(text); }
-    catch (...) { return result; }
+  std::shared_ptr<IddField_Impl> IddField_Impl::fromTable(const IddFieldTable& table,
+                                                          const std::string& objectName) {
+    std::shared_ptr<IddField_Impl> result(new IddField_Impl(table.name,objectName));
+    result->m_fieldId = table.fieldId;
+
+    IddFieldProperties& properties = result->m_properties;
+    properties.type = IddFieldType(table.type);
+    properties.note = table.note;
+    properties.required = table.required;
+    properties.autosizable = table.autosizable;
+    properties.autocalculatable = table.autocalculatable;
+    properties.retaincase = table.retaincase;
+    properties.deprecated = table.deprecated;
+    properties.beginExtensible = table.beginExtensible;
+    if (table.units) { properties.units = std::string(table.units); }
+    if (table.ipUnits) { properties.ipUnits = std::string(table.ipUnits); }
+    properties.minBoundType = IddFieldProperties::BoundTypes(table.minBoundType);
+    if (table.minBoundText) {
+      properties.minBoundValue = table.minBoundValue;
+      properties.minBoundText = std::string(table.minBoundText);
+    }
+    properties.maxBoundType = IddFieldProperties::BoundTypes(table.maxBoundType);
+    if (table.maxBoundText) {
+      properties.maxBoundValue = table.maxBoundValue;
+      properties.maxBoundText = std::string(table.maxBoundText);
+    }
+    if (table.stringDefault) { properties.stringDefault = std::string(table.stringDefault); }
+    if (table.hasNumericDefault) { properties.numericDefault = table.numericDefault; }
+    properties.objectLists.assign(table.objectLists, table.objectLists + table.numObjectLists);
+    properties.references.assign(table.references, table.references + table.numReferences);
+    properties.externalLists.assign(table.externalLists, table.externalLists + table.numExternalLists);
+
+    result->m_keys.reserve(table.numKeys);
+    for (unsigned i = 0; i < table.numKeys; ++i) {
+      result->m_keys.push_back(IddKey::fromTable(table.keys[i]));
+    }
 
-    result = std::shared_ptr<IddField_Impl>(new IddField_Impl(iddFieldImpl));
     return result;
   }
 
@@ -272,360 +317,72 @@ namespace detail {
     return os;
   }
 
-  void IddField_Impl::parse(const std::string& text)
-  {
-    boost::smatch matches;
-    if (boost::regex_search(text, matches, iddRegex::field())){
-      // find and parse the field text
-      std::string fieldTypeChar(matches[1].first, matches[1].second);
-      std::string fieldTypeNumber(matches[2].first, matches[2].second);
-      std::string fieldProperties(matches[3].first, matches[3].second);
-
-      // keep track of field id
-      m_fieldId = fieldTypeChar + fieldTypeNumber;
-
-      // check for base content type
-      if (boost::iequals(fieldTypeChar, "A")){
-        m_properties.type = IddFieldType(IddFieldType::AlphaType);
-      }else if (boost::iequals(fieldTypeChar, "N")){
-        // default numerics to real, can be overwritten later
-        m_properties.type = IddFieldType(IddFieldType::RealType);
-      }else{
-        LOG_AND_THROW("Unknown field type identifier found: '" << fieldTypeChar << "'");
-      }
-
-      // parse all the properties
-      while (boost::regex_search(fieldProperties, matches, iddRegex::metaDataComment())){
-        std::string thisProperty(matches[1].first, matches[1].second); boost::trim(thisProperty);
-        parseProperty(thisProperty);
+  namespace {
 
-        fieldProperties = std::string(matches[2].first, matches[2].second); boost::trim(fieldProperties);
+    int boundType(const std::string& valueName) {
+      if (valueName == "InclusiveBound") {
+        return IddFieldProperties::InclusiveBound;
       }
-
-      if ( !( (boost::regex_match(fieldProperties, commentRegex::whitespaceOnlyBlock())) ||
-        (boost::regex_match(fieldProperties, iddRegex::commentOnlyLine())) ) ){
-            LOG_AND_THROW("Unable to parse remaining fields: '" << fieldProperties << "'");
+      if (valueName == "ExclusiveBound") {
+        return IddFieldProperties::ExclusiveBound;
       }
-    }else{
-      LOG_AND_THROW("Field text does not match expected pattern: '" << text << "'");
+      return IddFieldProperties::Unbounded;
     }
 
-    if (m_properties.type == IddFieldType::ChoiceType){
-      // if this is a choice, assert we have some keys
-      if (m_keys.empty()){
-        LOG(Error,  "Field is of type choice but keys are empty: '" << m_name << "'");
-      }
-    }else{
-      // else assert we have no keys
-      if (!m_keys.empty()){
-        LOG(Error,  "Field is not of type choice but has non-empty keys: '" << m_name << "'");
-      }
+    const char* optionalString(const boost::optional<std::string>& value) {
+      return value ? value->c_str() : nullptr;
     }
 
-    if (m_properties.type == IddFieldType::UnknownType){
-
-      LOG_AND_THROW("Field is of unknown type after parsing: '" << m_name << "'");
+    const char* const* stringArray(const std::vector<const char*>& strings) {
+      return strings.empty() ? nullptr : &strings[0];
     }
 
-    // If the field has a default then it is not required. This overrides the idd text.
-    if (m_properties.stringDefault){
-      if (m_properties.required){
-        LOG(Info,  "Field '" << m_name << "' of object '" << m_objectName <<
-            "' is both required and has default value, setting required = false.");
-        m_properties.required = false;
-      }
-    }
   }
 
-  void IddField_Impl::parseProperty(const std::string& text)
-  {
-    // this function is called very often and has been identified as a bottleneck
-    // that is why some of the optimizations below have been applied
-
-    if(text.size() < 1)
-    {
-      return;
+  IddFieldTableView::IddFieldTableView(const iddParser::IddFieldData& data) {
+    for (const std::string& objectList : data.objectLists) {
+      m_objectLists.push_back(objectList.c_str());
     }
-
-
-    bool notHandled=true;
-    boost::smatch matches;
-    std::string lowerText = boost::algorithm::to_lower_copy(text);
-    char index = lowerText[0];
-
-    //sort inside the case statements based on the probability of that value being in the string.(so we don't run 5 unlikely
-    //regex tofind the likely one) Keep the case statements in aphabitical order for ease of maintance, since it doesn't
-    //effect the speed
-    switch( index )
-    {
-
-    case 'a':
-      {
-        if (boost::algorithm::starts_with(lowerText, "autosizable"))
-        {
-          m_properties.autosizable = true;
-          notHandled=false;
-        }
-        else if (boost::algorithm::starts_with(lowerText, "autocalculatable"))
-        {
-          m_properties.autocalculatable = true;
-          notHandled=false;
-        }
-        break;
-      }
-    case 'b':
-      {
-        if (boost::algorithm::starts_with(lowerText, "begin-extensible"))
-        {
-          m_properties.beginExtensible = true;
-          notHandled=false;
-        }
-        break;
-      }
-
-    case 'd':
-      {
-        if (boost::algorithm::starts_with(lowerText, "default"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::defaultProperty()));
-          std::string stringDefault(matches[1].first, matches[1].second);
-          boost::trim(stringDefault);
-          m_properties.stringDefault = stringDefault;
-          notHandled=false;
-          // if we are numeric type and not set to autosize, set the numeric property
-          if ((m_properties.type == IddFieldType::RealType) ||
-              (m_properties.type == IddFieldType::IntegerType))
-          {
-            if (!boost::regex_match(text, iddRegex::automaticDefault()))
-            {
-              m_properties.numericDefault = boost::lexical_cast<double>(stringDefault);
-            }
-            else
-            {
-              // otherwise this is -9999
-              m_properties.numericDefault = -9999;
-            }
-          }
-        }
-        else if (boost::algorithm::starts_with(lowerText, "deprecated"))
-        {
-          m_properties.deprecated = true;
-          notHandled=false;
-        }
-        break;
-      }
-    case 'e':
-      {
-        if (boost::algorithm::starts_with(lowerText, "external-list"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::externalListProperty()));
-          std::string externalList(matches[1].first, matches[1].second);
-          boost::trim(externalList);
-          m_properties.externalLists.push_back(externalList);
-          notHandled=false;
-        }
-
-        break;
-      }
-    case 'f':
-      {
-        if (boost::algorithm::starts_with(lowerText, "field"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::nameProperty()));
-          std::string fieldName(matches[1].first, matches[1].second);
-          boost::trim(fieldName);
-          notHandled=false;
-          if (!boost::equals(m_name, fieldName))
-          {
-            LOG_AND_THROW("Field name '" << fieldName << "' does not match expected '" << m_name
-                          << "' in object '" << m_objectName << "'");
-          }
-        }
-        break;
-      }
-    case 'i':
-      {
-        if (boost::algorithm::starts_with(lowerText, "ip-units"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::ipUnitsProperty()));
-          std::string ipUnits(matches[1].first, matches[1].second);
-          boost::trim(ipUnits);
-          m_properties.ipUnits = ipUnits;
-          notHandled=false;
-        }
-        break;
-      }
-
-    case 'k':
-      {
-        if (boost::algorithm::starts_with(lowerText, "key"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::keyProperty()));
-          std::string keyText(matches[1].first, matches[1].second);
-          notHandled=false;
-          boost::smatch keyMatches;
-          if (boost::regex_search(keyText, keyMatches, iddRegex::contentAndCommentLine()))
-          {
-            std::string keyName(keyMatches[1].first, keyMatches[1].second);
-            boost::trim(keyName);
-
-            // construct the key
-            OptionalIddKey key = IddKey::load(keyName, keyText);
-
-            // add the key to the keys
-            if (key) { m_keys.push_back(*key); }
-            else
-            {
-              LOG_AND_THROW("Key could not be loaded from text '" << keyText << "'.");
-            }
-
-          }
-          else
-          {
-            LOG_AND_THROW("Key name could not be determined from text '" << keyText << "'.");
-          }
-        }
-        break;
-      }
-    case 'm':
-      {
-        if (boost::algorithm::starts_with(lowerText, "minimum"))
-        {
-          if (boost::regex_search(text, matches, iddRegex::minExclusiveProperty()))
-          {
-            m_properties.minBoundType = IddFieldProperties::ExclusiveBound;
-            std::string minExclusive(matches[1].first, matches[1].second);
-            boost::trim(minExclusive);
-            m_properties.minBoundValue = boost::lexical_cast<double>(minExclusive);
-            m_properties.minBoundText = minExclusive;
-            notHandled=false;
-          }
-          else if (boost::regex_search(text, matches, iddRegex::minInclusiveProperty()))
-          {
-            m_properties.minBoundType = IddFieldProperties::InclusiveBound;
-            std::string minInclusive(matches[1].first, matches[1].second);
-            boost::trim(minInclusive);
-            m_properties.minBoundValue = boost::lexical_cast<double>(minInclusive);
-            m_properties.minBoundText = minInclusive;
-            notHandled=false;
-          }
-        }
-        else if (boost::algorithm::starts_with(lowerText, "maximum"))
-        {
-          if (boost::regex_search(text, matches, iddRegex::maxExclusiveProperty()))
-          {
-            m_properties.maxBoundType = IddFieldProperties::ExclusiveBound;
-            std::string maxExclusive(matches[1].first, matches[1].second);
-            boost::trim(maxExclusive);
-            m_properties.maxBoundValue = boost::lexical_cast<double>(maxExclusive);
-            m_properties.maxBoundText = maxExclusive;
-            notHandled=false;
-          }
-          else if (boost::regex_search(text, matches, iddRegex::maxInclusiveProperty()))
-          {
-            m_properties.maxBoundType = IddFieldProperties::InclusiveBound;
-            std::string maxInclusive(matches[1].first, matches[1].second);
-            boost::trim(maxInclusive);
-            m_properties.maxBoundValue = boost::lexical_cast<double>(maxInclusive);
-            m_properties.maxBoundText = maxInclusive;
-            notHandled=false;
-          }
-        }
-        else if (boost::algorithm::starts_with(lowerText, "memo"))
-        {
-          notHandled=false;
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::memoProperty()));
-          std::string memo(matches[1].first, matches[1].second);
-          trim(memo);
-          if (m_properties.note.empty()) { m_properties.note = memo; }
-          else {m_properties.note += "\n" + memo; }
-        }
-        break;
-      }
-    case 'n':
-      {
-        if (boost::algorithm::starts_with(lowerText, "note"))
-        {
-          notHandled=false;
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::noteProperty()));
-          std::string note(matches[1].first, matches[1].second);
-          trim(note);
-          if (m_properties.note.empty()) { m_properties.note = note; }
-          else { m_properties.note += "\n" + note; }
-        }
-        break;
-      }
-    case 'o':
-      {
-        if (boost::algorithm::starts_with(lowerText, "object-list"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::objectListProperty()));
-          std::string objectList(matches[1].first, matches[1].second);
-          boost::trim(objectList);
-          m_properties.objectLists.push_back(objectList);
-          notHandled=false;
-        }
-        break;
-      }
-    case 'r':
-      {
-        if (boost::algorithm::starts_with(lowerText, "required-field"))
-        {
-          m_properties.required = true;
-          notHandled=false;
-        }
-        else if (boost::algorithm::starts_with(lowerText, "reference"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::referenceProperty()));
-          std::string reference(matches[1].first, matches[1].second);
-          boost::trim(reference);
-          m_properties.references.push_back(reference);
-          notHandled=false;
-        }
-        else if (boost::algorithm::starts_with(lowerText, "retaincase"))
-        {
-          m_properties.retaincase = true;
-          notHandled=false;
-        }
-        break;
-      }
-
-    case 't':
-      {
-        if (boost::algorithm::starts_with(lowerText, "type"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::typeProperty()));
-          std::string fieldType(matches[1].first, matches[1].second);
-          boost::trim(fieldType);
-          m_properties.type = IddFieldType(fieldType);
-          notHandled=false;
-        }
-        break;
-      }
-    case 'u':
-      {
-        if (boost::algorithm::starts_with(lowerText, "unitsBasedOnField"))
-        {
-          // unhandled
-          //I like how we spend time comparing to this, but then don't handle it!
-          notHandled=false;
-        }
-        else if (boost::algorithm::starts_with(lowerText, "units"))
-        {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::unitsProperty()));
-          std::string units(matches[1].first, matches[1].second);
-          boost::trim(units);
-          m_properties.units = units;
-          notHandled=false;
-        }
-        break;
-      }
+    for (const std::string& reference : data.references) {
+      m_references.push_back(reference.c_str());
     }
-
-    if(notHandled)
-    {
-      LOG_AND_THROW("Unknown field property text '" << text << "' detected in field '" << m_name << "'");
+    for (const std::string& externalList : data.externalLists) {
+      m_externalLists.push_back(externalList.c_str());
+    }
+    for (const iddParser::IddKeyData& key : data.keys) {
+      IddKeyTable keyTable = { key.name.c_str(), key.note.c_str() };
+      m_keys.push_back(keyTable);
     }
+
+    m_table.name = data.name.c_str();
+    m_table.fieldId = data.fieldId.c_str();
+    m_table.type = IddFieldType(data.type).value();
+    m_table.note = data.note.c_str();
+    m_table.required = data.required;
+    m_table.autosizable = data.autosizable;
+    m_table.autocalculatable = data.autocalculatable;
+    m_table.retaincase = data.retaincase;
+    m_table.deprecated = data.deprecated;
+    m_table.beginExtensible = data.beginExtensible;
+    m_table.units = optionalString(data.units);
+    m_table.ipUnits = optionalString(data.ipUnits);
+    m_table.minBoundType = boundType(data.minBoundType);
+    m_table.minBoundValue = data.minBoundValue ? *data.minBoundValue : 0.0;
+    m_table.minBoundText = optionalString(data.minBoundText);
+    m_table.maxBoundType = boundType(data.maxBoundType);
+    m_table.maxBoundValue = data.maxBoundValue ? *data.maxBoundValue : 0.0;
+    m_table.maxBoundText = optionalString(data.maxBoundText);
+    m_table.stringDefault = optionalString(data.stringDefault);
+    m_table.hasNumericDefault = bool(data.numericDefault);
+    m_table.numericDefault = data.numericDefault ? *data.numericDefault : 0.0;
+    m_table.objectLists = stringArray(m_objectLists);
+    m_table.numObjectLists = m_objectLists.size();
+    m_table.references = stringArray(m_references);
+    m_table.numReferences = m_references.size();
+    m_table.externalLists = stringArray(m_externalLists);
+    m_table.numExternalLists = m_externalLists.size();
+    m_table.keys = m_keys.empty() ? nullptr : &m_keys[0];
+    m_table.numKeys = m_keys.size();
   }
 
 } // detail
@@ -716,6 +473,10 @@ OptionalIddField IddField::load(const std::string& name,
   else { return boost::none; }
 }
 
+IddField IddField::fromTable(const IddFieldTable& table, const std::string& objectName) {
+  return IddField(detail::IddField_Impl::fromTable(table,objectName));
+}
+
 std::ostream& IddField::print(std::ostream& os, bool lastField) const
 {
   return m_impl->print(os, lastField);
@@ -35,6 +35,7 @@ namespace openstudio {
 
 class Unit;
 class IddKey;
+struct IddFieldTable;
 
 // forward declarations
 namespace detail {
@@ -128,6 +129,10 @@ class UTILITIES_API IddField {
                                         const std::string& text, 
                                         const std::string& objectName);
 
+  /** Construct from data pre-parsed by GenerateIddFactory. objectName is the IddObject.name() to
+   *  which this field belongs. Not for general use. */
+  static IddField fromTable(const IddFieldTable& table, const std::string& objectName);
+
   /** Print the IddField to an output stream. Field slash codes are indented to produce pretty 
    *  output. If lastField, then the field id will be followed by a semi-colon; otherwise, a 
    *  comma will be used (consistent with IDD formatting). */
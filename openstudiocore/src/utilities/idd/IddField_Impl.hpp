@@ -24,6 +24,8 @@
 
 #include "IddKey.hpp"
 #include "IddFieldProperties.hpp"
+#include "IddObjectTable.hpp"
+#include "IddParser.hpp"
 
 #include "../core/Logger.hpp"
 
@@ -121,6 +123,10 @@ namespace detail {
                                                  const std::string& text, 
                                                  const std::string& objectName);
 
+    /** Construct from data pre-parsed by GenerateIddFactory. No text is parsed. */
+    static std::shared_ptr<IddField_Impl> fromTable(const IddFieldTable& table,
+                                                    const std::string& objectName);
+
     /** Print the IddField to an output stream. Field slash codes are indented to produce pretty 
      *  output. If lastField, then the field id will be followed by a semi-colon; otherwise, a 
      *  comma will be used (consistent with IDD formatting). */
@@ -134,20 +140,32 @@ namespace detail {
     IddFieldProperties m_properties; // IDD markup information
     std::vector<IddKey> m_keys;      // vector of all keys
 
-    // partial constructor used by load
+    // partial constructor used by fromTable
     IddField_Impl(const std::string& name, const std::string& objectName);
 
-    // parses the text
-    void parse(const std::string& text);
+    // configure logging
+    REGISTER_LOGGER("utilities.idd.IddField");
+  };
 
-    // parse single field
-    void parseField(const std::string& text);
+  /** An IddFieldTable that refers to the strings of field data parsed at run time, so that such 
+   *  fields are constructed by fromTable just as the IddFactory's are. data must outlive the 
+   *  view. */
+  class UTILITIES_API IddFieldTableView {
+   public:
+    explicit IddFieldTableView(const iddParser::IddFieldData& data);
 
-    // parse property of field
-    void parseProperty(const std::string& text);
+    // m_table points into the vectors
+    IddFieldTableView(const IddFieldTableView& other) = delete;
+    IddFieldTableView& operator=(const IddFieldTableView& other) = delete;
 
-    // configure logging
-    REGISTER_LOGGER("utilities.idd.IddField");
+    const IddFieldTable& table() const { return m_table; }
+
+   private:
+    std::vector<const char*> m_objectLists;
+    std::vector<const char*> m_references;
+    std::vector<const char*> m_externalLists;
+    std::vector<IddKeyTable> m_keys;
+    IddFieldTable m_table;
   };
 
 } // detail
@@ -21,9 +21,7 @@
 #include "IddKey_Impl.hpp"
 
 #include "IddKeyProperties.hpp"
-#include "IddRegex.hpp"
-
-#include <boost/algorithm/string.hpp>
+#include "IddParser.hpp"
 
 namespace openstudio {
 
@@ -53,13 +51,22 @@ namespace detail {
   std::shared_ptr<IddKey_Impl> IddKey_Impl::load(const std::string& name,
                                                    const std::string& text) {
 
-    std::shared_ptr<IddKey_Impl> result;
-    IddKey_Impl iddKeyImpl(name);
+    iddParser::IddKeyData data;
+    data.name = name;
 
-    try { iddKeyImpl.parse(text); }
-    catch (...) { return result; }
+    try { iddParser::parseKey(data,text); }
+    catch (std::exception& e) {
+      LOG(Error,e.what());
+      return std::shared_ptr<IddKey_Impl>();
+    }
 
-    result = std::shared_ptr<IddKey_Impl>(new IddKey_Impl(iddKeyImpl));
+    IddKeyTable table = { data.name.c_str(), data.note.c_str() };
+    return fromTable(table);
+  }
+
+  std::shared_ptr<IddKey_Impl> IddKey_Impl::fromTable(const IddKeyTable& table) {
+    std::shared_ptr<IddKey_Impl> result(new IddKey_Impl(table.name));
+    result->m_properties.note = table.note;
     return result;
   }
 
@@ -73,22 +80,6 @@ namespace detail {
 
   IddKey_Impl::IddKey_Impl(const std::string& name) : m_name(name) {}
 
-  void IddKey_Impl::parse(const std::string& text)
-  {
-    boost::smatch matches;
-    if (boost::regex_search(text, matches, iddRegex::contentAndCommentLine())){
-      std::string keyName(matches[1].first, matches[1].second); boost::trim(keyName);
-      if (!boost::equals(name(), keyName)) {
-        LOG_AND_THROW("Key name '" << keyName << "' does not match expected '" << name() << "'");
-      };
-
-      std::string note(matches[2].first, matches[2].second);
-      m_properties.note = note;
-    }else{
-      LOG_AND_THROW("Key name could not be determined from text '" << text << "'");
-    }
-  }
-
 
 } // detail
 
@@ -125,6 +116,10 @@ OptionalIddKey IddKey::load(const std::string& name, const std::string& text) {
   else { return boost::none; }
 }
 
+IddKey IddKey::fromTable(const IddKeyTable& table) {
+  return IddKey(detail::IddKey_Impl::fromTable(table));
+}
+
 std::ostream& IddKey::print(std::ostream& os) const
 {
   return m_impl->print(os);
@@ -33,6 +33,7 @@
 namespace openstudio{
 
 struct IddKeyProperties;
+struct IddKeyTable;
 
 namespace detail{
   class IddKey_Impl;
@@ -77,6 +78,9 @@ class UTILITIES_API IddKey {
   /** Load from text. */
   static boost::optional<IddKey> load(const std::string& name, const std::string& text);
 
+  /** Construct from data pre-parsed by GenerateIddFactory. Not for general use. */
+  static IddKey fromTable(const IddKeyTable& table);
+
   /** Print to os in standard IDD format */
   std::ostream& print(std::ostream& os) const;
 
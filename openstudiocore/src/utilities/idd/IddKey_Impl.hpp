@@ -23,6 +23,7 @@
 #include "../UtilitiesAPI.hpp"
 
 #include "IddKeyProperties.hpp"
+#include "IddObjectTable.hpp"
 
 #include "../core/Logger.hpp"
 
@@ -53,17 +54,17 @@ namespace detail {
     /// load by parsing text
     static std::shared_ptr<IddKey_Impl> load(const std::string& name, const std::string& text);
 
+    /// construct from pre-parsed data
+    static std::shared_ptr<IddKey_Impl> fromTable(const IddKeyTable& table);
+
     /// print idd 
     std::ostream& print(std::ostream& os) const;
 
    private:
 
-    /// partial constructor used by load
+    /// partial constructor used by fromTable
     IddKey_Impl(const std::string& name);
 
-    // parse 
-    void parse(const std::string& text);
-
     // name
     std::string m_name;
 
@@ -25,22 +25,18 @@
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include "IddKey.hpp"
-#include "CommentRegex.hpp"
+#include "IddField_Impl.hpp"
+#include "IddParser.hpp"
 
 #include "../core/Assert.hpp"
 
 #include <boost/filesystem/fstream.hpp>
-#include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <deque>
+
 using std::string;
 using std::vector;
-using boost::regex;
-using boost::smatch;
-using boost::regex_replace;
-using boost::replace_all;
-using boost::trim;
 
 namespace openstudio {
 
@@ -399,13 +395,87 @@ namespace detail {
                                                          const std::string& text, 
                                                          IddObjectType type) 
   {
-    std::shared_ptr<IddObject_Impl> result;
-    result = std::shared_ptr<IddObject_Impl>(new IddObject_Impl(name,group,type));
+    iddParser::IddObjectData data;
+    data.name = name;
+    data.group = group;
 
     try {
-      result->parse(text);
+      iddParser::parseObject(data,text,[](bool error, const std::string& message) {
+        if (error) { LOG(Error,message); }
+        else { LOG(Info,message); }
+      });
+    }
+    catch (std::exception& e) {
+      LOG(Error,e.what());
+      return std::shared_ptr<IddObject_Impl>();
+    }
+
+    // construct as the IddFactory does, from tables that refer to the parsed data
+    std::deque<IddFieldTableView> views;
+    std::vector<IddFieldTable> fields, extensibleFields;
+    for (const iddParser::IddFieldData& field : data.fields) {
+      views.emplace_back(field);
+      fields.push_back(views.back().table());
+    }
+    for (const iddParser::IddFieldData& field : data.extensibleFields) {
+      views.emplace_back(field);
+      extensibleFields.push_back(views.back().table());
+    }
+
+    IddObjectTable table;
+    table.name = data.name.c_str();
+    table.group = data.group.c_str();
+    table.memo = data.memo.c_str();
+    table.unique = data.unique;
+    table.required = data.required;
+    table.obsolete = data.obsolete;
+    table.hasURL = data.hasURL;
+    table.extensible = data.extensible;
+    table.numExtensible = data.numExtensible;
+    table.numExtensibleGroupsRequired = data.numExtensibleGroupsRequired;
+    table.format = data.format.c_str();
+    table.minFields = data.minFields;
+    table.hasMaxFields = bool(data.maxFields);
+    table.maxFields = data.maxFields ? *data.maxFields : 0u;
+    table.fields = fields.empty() ? nullptr : &fields[0];
+    table.numFields = fields.size();
+    table.extensibleFields = extensibleFields.empty() ? nullptr : &extensibleFields[0];
+    table.numExtensibleFields = extensibleFields.size();
+
+    return fromTable(table,type);
+  }
+
+  std::shared_ptr<IddObject_Impl> IddObject_Impl::fromTable(const IddObjectTable& table,
+                                                            IddObjectType type)
+  {
+    std::shared_ptr<IddObject_Impl> result(new IddObject_Impl(table.name,table.group,type));
+
+    IddObjectProperties& properties = result->m_properties;
+    properties.memo = table.memo;
+    properties.unique = table.unique;
+    properties.required = table.required;
+    properties.obsolete = table.obsolete;
+    properties.hasURL = table.hasURL;
+    properties.extensible = table.extensible;
+    properties.numExtensible = table.numExtensible;
+    properties.numExtensibleGroupsRequired = table.numExtensibleGroupsRequired;
+    properties.format = table.format;
+    properties.minFields = table.minFields;
+    if (table.hasMaxFields) {
+      properties.maxFields = table.maxFields;
+    }
+
+    result->m_fields.reserve(table.numFields);
+    for (unsigned i = 0; i < table.numFields; ++i) {
+      result->m_fields.push_back(IddField::fromTable(table.fields[i],result->m_name));
     }
-    catch (...) { return std::shared_ptr<IddObject_Impl>(); }
+    result->m_extensibleFields.reserve(table.numExtensibleFields);
+    for (unsigned i = 0; i < table.numExtensibleFields; ++i) {
+      result->m_extensibleFields.push_back(IddField::fromTable(table.extensibleFields[i],result->m_name));
+    }
+
+    // fill the name field cache now, so objects shared between threads are only read
+    result->hasNameField();
 
     return result;
   }
@@ -450,215 +520,6 @@ namespace detail {
   IddObject_Impl::IddObject_Impl(const string& name, const string& group, IddObjectType type)
     : m_name(name), m_group(group), m_type(type) {}
 
-  void IddObject_Impl::parse(const std::string& text)
-  {
-    smatch matches;
-    if (boost::regex_search(text, matches, iddRegex::objectAndFields())){
-      // find and parse the object text
-      string objectText(matches[1].first, matches[1].second);
-      parseObject(objectText);
-
-      // find and parse the fields text
-      string fieldsText(matches[2].first, matches[2].second);
-      parseFields(fieldsText);
-
-    }else if (boost::regex_match(text, iddRegex::objectNoFields())){
-      // there are no fields in this object, it is all object text
-      parseObject(text);
-
-    }else{
-      // error
-      LOG_AND_THROW("Unexpected pattern '" << text << "' found in object '" << m_name << "'");
-    }
-
-    // remove existing extensible fields and add them the the extensible list
-    if (m_properties.extensible) {
-      makeExtensible();
-    }
-
-  }
-
-  void IddObject_Impl::makeExtensible()
-  {
-    // number of fields in extensible group
-    unsigned numExtensible = m_properties.numExtensible;
-
-    // check that numExtensible > 0
-    if (numExtensible == 0){
-      LOG(Error, "Extensible length 0 in object '" <<  m_name << "'");
-      return;
-    }
-
-    // find the begin extensible field, there should be only one
-    auto extensibleBegin = m_fields.end();
-    for (auto it = m_fields.begin(), itend = m_fields.end(); it != itend; ++it){
-      if (it->properties().beginExtensible){
-        extensibleBegin = it;
-        break;
-      }
-    }
-
-    // no extensible begin found
-    if (extensibleBegin == m_fields.end()){
-      LOG(Error, "No begin-extensible field detected in object '" <<  m_name << "'");
-      return;
-    }
-
-    // extensible begin is too close to the end of the field list
-    if ( (extensibleBegin + numExtensible) > m_fields.end()){
-      LOG(Error, "Extensible fields begin too close to end of fields in object '" <<  m_name << "'");
-      return;
-    }
-
-    // copy extensible fields
-    m_extensibleFields = IddFieldVector(extensibleBegin, extensibleBegin + numExtensible);
-
-    // remove all the extensible fields from the field list
-    m_fields.resize(extensibleBegin-m_fields.begin());
-
-    // regexs that match extensible fields 
-    boost::regex find("\\s?[0-9]+");
-    string replace("");
-
-    // replace names of extensible fields so they do not contain numbers
-    // e.g. "Vertex 1 X-coordinate" -> "Vertex X-coordinate"
-    for (IddField& extensibleField : m_extensibleFields){
-      std::string extensibleFieldName = extensibleField.name();
-      extensibleFieldName = regex_replace(extensibleFieldName, find, replace); 
-      trim(extensibleFieldName);
-      extensibleField.setName(extensibleFieldName);
-    }
-
-    // figure out numExtensibleGroupsRequired 
-    if (m_properties.minFields > 0){
-      unsigned minFields = m_properties.minFields;
-      if (minFields > m_fields.size()) {
-        double numerator(minFields-m_fields.size());
-        double denominator(numExtensible);
-        m_properties.numExtensibleGroupsRequired = unsigned(std::ceil(numerator/denominator));
-      }
-    }
-  }
-
-  void IddObject_Impl::parseObject(const std::string& text)
-  {
-    // find the object name and the property text
-    smatch matches;
-    string objectName;
-    string propertiesText;
-    if (boost::regex_search(text, matches, iddRegex::line())){
-      objectName = string(matches[1].first, matches[1].second); trim(objectName);
-      if (!boost::equals(m_name,objectName)){
-        LOG_AND_THROW("Object name '" << objectName << "' does not match expected '" << m_name << "'");
-      }
-
-      propertiesText = string(matches[2].first, matches[2].second); trim(propertiesText);
-    }else{
-      LOG_AND_THROW("Could not determine object name from text '" << text << "'");
-    }
-
-    while (boost::regex_search(propertiesText, matches, iddRegex::metaDataComment())){
-      string thisProperty(matches[1].first, matches[1].second); trim(thisProperty);
-      parseProperty(thisProperty);
-
-      propertiesText = string(matches[2].first, matches[2].second); trim(propertiesText);
-    }
-    if ( !( (boost::regex_match(propertiesText, commentRegex::whitespaceOnlyBlock())) ||
-            (boost::regex_match(propertiesText, iddRegex::commentOnlyLine())) ) ){
-      LOG_AND_THROW("Could not process properties text '" << propertiesText << "' in object '" 
-                    << m_name << "'");
-    }
-  }
-
-  void IddObject_Impl::parseProperty(const std::string& text)
-  {
-    smatch matches;
-    if (boost::regex_search(text, matches, iddRegex::memoProperty())){
-      string memo(matches[1].first, matches[1].second); trim(memo);
-      if (m_properties.memo.empty()) { m_properties.memo = memo; } 
-      else { m_properties.memo += "\n" + memo; }
-
-    }else if (boost::regex_match(text, iddRegex::uniqueProperty())){
-      m_properties.unique = true;
-
-    }else if (boost::regex_match(text, iddRegex::requiredObjectProperty())){
-      m_properties.required = true;
-
-    }else if (boost::regex_match(text, iddRegex::obsoleteProperty())){
-      m_properties.obsolete = true;
-
-    }else if (boost::regex_match(text, iddRegex::hasurlProperty())){
-      m_properties.hasURL = true;
-
-    }else if (boost::regex_search(text, matches, iddRegex::extensibleProperty())){
-      m_properties.extensible = true;
-
-      string numExtensible(matches[1].first, matches[1].second);
-      m_properties.numExtensible = boost::lexical_cast<unsigned>(numExtensible);
-
-    }else if (boost::regex_search(text, matches, iddRegex::formatProperty())){
-      string format(matches[1].first, matches[1].second); trim(format);
-      m_properties.format = format;
-
-    }else if (boost::regex_search(text, matches, iddRegex::minFieldsProperty())){
-      string minFields(matches[1].first, matches[1].second);
-      m_properties.minFields = boost::lexical_cast<unsigned>(minFields);
-
-    }else if (boost::regex_search(text, matches, iddRegex::maxFieldsProperty())) {
-      string maxFields(matches[1].first, matches[1].second);
-      m_properties.maxFields = boost::lexical_cast<unsigned>(maxFields);
-    }else {
-      // error, unknown property
-      LOG_AND_THROW("Unknown property text '" << text << "' in object '" << m_name << "'");
-    }
-  }
-
-  void IddObject_Impl::parseFields(const std::string& text)
-  {
-    string copyText(text);
-
-    smatch matches;
-    while (boost::regex_search(copyText, matches, iddRegex::lastField())){
-      // take the text of the last field
-      string fieldText(matches[2].first, matches[2].second);
-      string fieldName;
-
-      // peak ahead to find the field name for indexing in map
-      smatch nameMatches;
-      if (boost::regex_search(fieldText, nameMatches, iddRegex::name())){
-        fieldName = string(nameMatches[1].first, nameMatches[1].second); trim(fieldName);
-      }else if(boost::regex_search(fieldText, nameMatches, iddRegex::field())){
-        // if no explicit field name, use the type and number
-        string fieldTypeChar(nameMatches[1].first, nameMatches[1].second); trim(fieldTypeChar);
-        string fieldTypeNumber(nameMatches[2].first, nameMatches[2].second); trim(fieldTypeNumber);
-        fieldName = fieldTypeChar + fieldTypeNumber;
-      }else{
-        // cannot find the field name
-        LOG_AND_THROW("Cannot determine field name from text '" << fieldText << "'");
-      }
-
-      // construct the field
-      OptionalIddField oField = IddField::load(fieldName, fieldText, m_name);
-      if (!oField) {
-        LOG_AND_THROW("Cannot parse IddField text '" << fieldText << "'.");
-      }
-
-      // construct a new object and put it in the object list and object map
-      m_fields.push_back(*oField);
-
-      // copy the rest of the text and continue
-      copyText = string(matches[1].first, matches[1].second);
-    }
-
-    if (!copyText.empty()){
-      LOG_AND_THROW("Could not process remaining field text '" << copyText << "' in object '" 
-                    << m_name << "'");
-    }
-
-    // reverse the field list because they were inserted in reverse order
-    reverse(m_fields.begin(), m_fields.end());
-  }
-
 } // detail
 
 // CONSTRUCTORS
@@ -814,6 +675,10 @@ boost::optional<IddObject> IddObject::load(const std::string& name,
   return load(name,group,text,IddObjectType(IddObjectType::UserCustom));
 }
 
+IddObject IddObject::fromTable(const IddObjectTable& table, IddObjectType type) {
+  return IddObject(detail::IddObject_Impl::fromTable(table,type));
+}
+
 std::ostream& IddObject::print(std::ostream& os) const
 {
   return m_impl->print(os);
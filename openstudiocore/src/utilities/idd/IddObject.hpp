@@ -36,6 +36,7 @@ namespace openstudio {
 // forward declarations
 class ExtensibleIndex;
 struct IddObjectType;
+struct IddObjectTable;
 
 namespace detail {
   class IddObject_Impl;
@@ -195,6 +196,11 @@ class UTILITIES_API IddObject {
                                          const std::string& group,
                                          const std::string& text);
 
+  /** Construct from data pre-parsed by GenerateIddFactory. Used by the IddFactory in place of
+   *  load, so that the built-in IDD text does not have to be parsed at run time. Not for general
+   *  use. */
+  static IddObject fromTable(const IddObjectTable& table, IddObjectType type);
+
   /** Print this object to os, in standard IDD format. */
   std::ostream& print(std::ostream& os) const;
 
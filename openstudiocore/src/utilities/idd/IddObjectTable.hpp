@@ -0,0 +1,93 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_IDD_IDDOBJECTTABLE_HPP
+#define UTILITIES_IDD_IDDOBJECTTABLE_HPP
+
+namespace openstudio {
+
+/** Pre-parsed data for one IddKey. Written by GenerateIddFactory. */
+struct IddKeyTable {
+  const char* name;
+  const char* note;
+};
+
+/** Pre-parsed data for one IddField, written by GenerateIddFactory so that the IddFactory can
+ *  construct its fields without parsing IDD text. Members mirror IddFieldProperties; a null
+ *  pointer stands in for an unset optional string. */
+struct IddFieldTable {
+  const char* name;
+  const char* fieldId;
+  int type;                        // IddFieldType value
+  const char* note;
+  bool required;
+  bool autosizable;
+  bool autocalculatable;
+  bool retaincase;
+  bool deprecated;
+  bool beginExtensible;
+  const char* units;
+  const char* ipUnits;
+  int minBoundType;                // IddFieldProperties::BoundTypes value
+  double minBoundValue;            // only used if minBoundText is not null
+  const char* minBoundText;
+  int maxBoundType;                // IddFieldProperties::BoundTypes value
+  double maxBoundValue;            // only used if maxBoundText is not null
+  const char* maxBoundText;
+  const char* stringDefault;
+  bool hasNumericDefault;
+  double numericDefault;
+  const char* const* objectLists;
+  unsigned numObjectLists;
+  const char* const* references;
+  unsigned numReferences;
+  const char* const* externalLists;
+  unsigned numExternalLists;
+  const IddKeyTable* keys;
+  unsigned numKeys;
+};
+
+/** Pre-parsed data for one IddObject, written by GenerateIddFactory. The tables are plain
+ *  aggregates of literals, so they are constant-initialized and cost nothing until
+ *  IddObject::fromTable wraps them. Extensible field names have already had their numbers
+ *  removed, and numExtensibleGroupsRequired has already been derived from minFields. */
+struct IddObjectTable {
+  const char* name;
+  const char* group;
+  const char* memo;
+  bool unique;
+  bool required;
+  bool obsolete;
+  bool hasURL;
+  bool extensible;
+  unsigned numExtensible;
+  unsigned numExtensibleGroupsRequired;
+  const char* format;
+  unsigned minFields;
+  bool hasMaxFields;
+  unsigned maxFields;
+  const IddFieldTable* fields;
+  unsigned numFields;
+  const IddFieldTable* extensibleFields;
+  unsigned numExtensibleFields;
+};
+
+} // openstudio
+
+#endif // UTILITIES_IDD_IDDOBJECTTABLE_HPP
@@ -24,6 +24,7 @@
 #include "IddObjectProperties.hpp"
 #include "IddFieldProperties.hpp"
 #include "IddField.hpp"
+#include "IddObjectTable.hpp"
 
 #include "../core/Logger.hpp"
 #include "../core/Containers.hpp"
@@ -169,6 +170,10 @@ namespace detail {
                                                   const std::string& text, 
                                                   IddObjectType type);
 
+    /** Construct from data pre-parsed by GenerateIddFactory. No text is parsed. */
+    static std::shared_ptr<IddObject_Impl> fromTable(const IddObjectTable& table,
+                                                     IddObjectType type);
+
     // print
     std::ostream& print(std::ostream& os) const;
 
@@ -187,17 +192,9 @@ namespace detail {
     // .first = hasNameField(); .second = nameFieldIndex
     mutable boost::optional< std::pair<bool,unsigned> > m_nameFieldCache;
 
-    // partial constructor used by load
+    // partial constructor used by fromTable
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
 
-    // parse
-    void parse(const std::string& text);
-
-    void parseObject(const std::string& text);
-    void parseProperty(const std::string& text);
-    void parseFields(const std::string& text);
-    void makeExtensible();
-
     // configure logging
     REGISTER_LOGGER("utilities.idd.IddObject");
   };
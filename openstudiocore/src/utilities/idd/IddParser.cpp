@@ -0,0 +1,516 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+
+#include "IddParser.hpp"
+
+#include "IddRegex.hpp"
+#include "CommentRegex.hpp"
+
+#include <boost/regex.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+
+namespace openstudio {
+namespace iddParser {
+
+namespace {
+
+  std::string matchString(const boost::ssub_match& match) {
+    return std::string(match.first,match.second);
+  }
+
+  void require(bool ok, const std::string& message) {
+    if (!ok) {
+      throw std::runtime_error(message.c_str());
+    }
+  }
+
+  // IddFieldType value name for text, as IddFieldType(text) would find it
+  std::string fieldTypeValueName(const std::string& text) {
+    static const std::map<std::string,std::string> lookup = []() {
+      const char* pairs[][2] = {
+        {"UnknownType","unknown"},
+        {"IntegerType","integer"},
+        {"RealType","real"},
+        {"AlphaType","alpha"},
+        {"ChoiceType","choice"},
+        {"NodeType","node"},
+        {"ObjectListType","object-list"},
+        {"ExternalListType","external-list"},
+        {"URLType","url"},
+        {"HandleType","handle"}
+      };
+      std::map<std::string,std::string> result;
+      for (const auto& pair : pairs) {
+        result[boost::algorithm::to_upper_copy(std::string(pair[0]))] = pair[0];
+        result[boost::algorithm::to_upper_copy(std::string(pair[1]))] = pair[0];
+      }
+      return result;
+    }();
+    auto it = lookup.find(boost::algorithm::to_upper_copy(text));
+    require(it != lookup.end(),"Unknown IddFieldType '" + text + "'.");
+    return it->second;
+  }
+
+  std::string parseBoundText(const boost::smatch& matches, boost::optional<double>& value) {
+    std::string text = matchString(matches[1]);
+    boost::trim(text);
+    value = boost::lexical_cast<double>(text);
+    return text;
+  }
+
+  void appendNote(std::string& note, const std::string& text) {
+    if (note.empty()) { note = text; }
+    else { note += "\n" + text; }
+  }
+
+  void parseFieldProperty(IddFieldData& field, const std::string& text, const std::string& objectName) {
+    // this function is called very often, so properties are told apart by their first letter 
+    // before any regular expression is run
+    if (text.empty()) {
+      return;
+    }
+
+    bool notHandled = true;
+    boost::smatch matches;
+    std::string lowerText = boost::algorithm::to_lower_copy(text);
+    std::string value;
+
+    switch (lowerText[0]) {
+    case 'a':
+      if (boost::algorithm::starts_with(lowerText,"autosizable")) {
+        field.autosizable = true;
+        notHandled = false;
+      }
+      else if (boost::algorithm::starts_with(lowerText,"autocalculatable")) {
+        field.autocalculatable = true;
+        notHandled = false;
+      }
+      break;
+    case 'b':
+      if (boost::algorithm::starts_with(lowerText,"begin-extensible")) {
+        field.beginExtensible = true;
+        notHandled = false;
+      }
+      break;
+    case 'd':
+      if (boost::algorithm::starts_with(lowerText,"default")) {
+        require(boost::regex_search(text,matches,iddRegex::defaultProperty()),
+                "Cannot parse default '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.stringDefault = value;
+        notHandled = false;
+        // if numeric and not autosized, also keep the numeric value, -9999 otherwise
+        if ((field.type == "RealType") || (field.type == "IntegerType")) {
+          if (!boost::regex_match(text,iddRegex::automaticDefault())) {
+            field.numericDefault = boost::lexical_cast<double>(value);
+          }
+          else {
+            field.numericDefault = -9999;
+          }
+        }
+      }
+      else if (boost::algorithm::starts_with(lowerText,"deprecated")) {
+        field.deprecated = true;
+        notHandled = false;
+      }
+      break;
+    case 'e':
+      if (boost::algorithm::starts_with(lowerText,"external-list")) {
+        require(boost::regex_search(text,matches,iddRegex::externalListProperty()),
+                "Cannot parse external-list '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.externalLists.push_back(value);
+        notHandled = false;
+      }
+      break;
+    case 'f':
+      if (boost::algorithm::starts_with(lowerText,"field")) {
+        require(boost::regex_search(text,matches,iddRegex::nameProperty()),
+                "Cannot parse field name '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        notHandled = false;
+        require(value == field.name,
+                "Field name '" + value + "' does not match expected '" + field.name +
+                "' in object '" + objectName + "'");
+      }
+      break;
+    case 'i':
+      if (boost::algorithm::starts_with(lowerText,"ip-units")) {
+        require(boost::regex_search(text,matches,iddRegex::ipUnitsProperty()),
+                "Cannot parse ip-units '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.ipUnits = value;
+        notHandled = false;
+      }
+      break;
+    case 'k':
+      if (boost::algorithm::starts_with(lowerText,"key")) {
+        require(boost::regex_search(text,matches,iddRegex::keyProperty()),
+                "Cannot parse key '" + text + "'");
+        std::string keyText = matchString(matches[1]);
+        notHandled = false;
+        boost::smatch keyMatches;
+        require(boost::regex_search(keyText,keyMatches,iddRegex::contentAndCommentLine()),
+                "Key name could not be determined from text '" + keyText + "'.");
+        IddKeyData key;
+        key.name = matchString(keyMatches[1]); boost::trim(key.name);
+        parseKey(key,keyText);
+        field.keys.push_back(key);
+      }
+      break;
+    case 'm':
+      if (boost::algorithm::starts_with(lowerText,"minimum")) {
+        if (boost::regex_search(text,matches,iddRegex::minExclusiveProperty())) {
+          field.minBoundType = "ExclusiveBound";
+          field.minBoundText = parseBoundText(matches,field.minBoundValue);
+          notHandled = false;
+        }
+        else if (boost::regex_search(text,matches,iddRegex::minInclusiveProperty())) {
+          field.minBoundType = "InclusiveBound";
+          field.minBoundText = parseBoundText(matches,field.minBoundValue);
+          notHandled = false;
+        }
+      }
+      else if (boost::algorithm::starts_with(lowerText,"maximum")) {
+        if (boost::regex_search(text,matches,iddRegex::maxExclusiveProperty())) {
+          field.maxBoundType = "ExclusiveBound";
+          field.maxBoundText = parseBoundText(matches,field.maxBoundValue);
+          notHandled = false;
+        }
+        else if (boost::regex_search(text,matches,iddRegex::maxInclusiveProperty())) {
+          field.maxBoundType = "InclusiveBound";
+          field.maxBoundText = parseBoundText(matches,field.maxBoundValue);
+          notHandled = false;
+        }
+      }
+      else if (boost::algorithm::starts_with(lowerText,"memo")) {
+        notHandled = false;
+        require(boost::regex_search(text,matches,iddRegex::memoProperty()),
+                "Cannot parse memo '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        appendNote(field.note,value);
+      }
+      break;
+    case 'n':
+      if (boost::algorithm::starts_with(lowerText,"note")) {
+        notHandled = false;
+        require(boost::regex_search(text,matches,iddRegex::noteProperty()),
+                "Cannot parse note '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        appendNote(field.note,value);
+      }
+      break;
+    case 'o':
+      if (boost::algorithm::starts_with(lowerText,"object-list")) {
+        require(boost::regex_search(text,matches,iddRegex::objectListProperty()),
+                "Cannot parse object-list '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.objectLists.push_back(value);
+        notHandled = false;
+      }
+      break;
+    case 'r':
+      if (boost::algorithm::starts_with(lowerText,"required-field")) {
+        field.required = true;
+        notHandled = false;
+      }
+      else if (boost::algorithm::starts_with(lowerText,"reference")) {
+        require(boost::regex_search(text,matches,iddRegex::referenceProperty()),
+                "Cannot parse reference '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.references.push_back(value);
+        notHandled = false;
+      }
+      else if (boost::algorithm::starts_with(lowerText,"retaincase")) {
+        field.retaincase = true;
+        notHandled = false;
+      }
+      break;
+    case 't':
+      if (boost::algorithm::starts_with(lowerText,"type")) {
+        require(boost::regex_search(text,matches,iddRegex::typeProperty()),
+                "Cannot parse type '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.type = fieldTypeValueName(value);
+        notHandled = false;
+      }
+      break;
+    case 'u':
+      // \unitsBasedOnField is not handled, it is parsed as units
+      if (boost::algorithm::starts_with(lowerText,"units")) {
+        require(boost::regex_search(text,matches,iddRegex::unitsProperty()),
+                "Cannot parse units '" + text + "'");
+        value = matchString(matches[1]); boost::trim(value);
+        field.units = value;
+        notHandled = false;
+      }
+      break;
+    }
+
+    require(!notHandled,"Unknown field property text '" + text + "' detected in field '" +
+            field.name + "'");
+  }
+
+  void parseObjectProperty(IddObjectData& object, const std::string& text) {
+    boost::smatch matches;
+    if (boost::regex_search(text,matches,iddRegex::memoProperty())) {
+      std::string memo = matchString(matches[1]); boost::trim(memo);
+      appendNote(object.memo,memo);
+    }
+    else if (boost::regex_match(text,iddRegex::uniqueProperty())) {
+      object.unique = true;
+    }
+    else if (boost::regex_match(text,iddRegex::requiredObjectProperty())) {
+      object.required = true;
+    }
+    else if (boost::regex_match(text,iddRegex::obsoleteProperty())) {
+      object.obsolete = true;
+    }
+    else if (boost::regex_match(text,iddRegex::hasurlProperty())) {
+      object.hasURL = true;
+    }
+    else if (boost::regex_search(text,matches,iddRegex::extensibleProperty())) {
+      object.extensible = true;
+      object.numExtensible = boost::lexical_cast<unsigned>(matchString(matches[1]));
+    }
+    else if (boost::regex_search(text,matches,iddRegex::formatProperty())) {
+      std::string format = matchString(matches[1]); boost::trim(format);
+      object.format = format;
+    }
+    else if (boost::regex_search(text,matches,iddRegex::minFieldsProperty())) {
+      object.minFields = boost::lexical_cast<unsigned>(matchString(matches[1]));
+    }
+    else if (boost::regex_search(text,matches,iddRegex::maxFieldsProperty())) {
+      object.maxFields = boost::lexical_cast<unsigned>(matchString(matches[1]));
+    }
+    else {
+      require(false,"Unknown property text '" + text + "' in object '" + object.name + "'");
+    }
+  }
+
+  void parseObjectText(IddObjectData& object, const std::string& text) {
+    boost::smatch matches;
+    require(boost::regex_search(text,matches,iddRegex::line()),
+            "Could not determine object name from text '" + text + "'");
+    std::string objectName = matchString(matches[1]); boost::trim(objectName);
+    require(objectName == object.name,
+            "Object name '" + objectName + "' does not match expected '" + object.name + "'");
+    std::string propertiesText = matchString(matches[2]); boost::trim(propertiesText);
+
+    while (boost::regex_search(propertiesText,matches,iddRegex::metaDataComment())) {
+      std::string thisProperty = matchString(matches[1]); boost::trim(thisProperty);
+      parseObjectProperty(object,thisProperty);
+      propertiesText = matchString(matches[2]); boost::trim(propertiesText);
+    }
+
+    require(boost::regex_match(propertiesText,commentRegex::whitespaceOnlyBlock()) ||
+            boost::regex_match(propertiesText,iddRegex::commentOnlyLine()),
+            "Could not process properties text '" + propertiesText + "' in object '" +
+            object.name + "'");
+  }
+
+  void parseFields(IddObjectData& object, 
+                   const std::string& text, 
+                   const MessageHandler& messageHandler) 
+  {
+    std::string copyText(text);
+
+    boost::smatch matches;
+    while (boost::regex_search(copyText,matches,iddRegex::lastField())) {
+      std::string fieldText = matchString(matches[2]);
+
+      // the field name is the \field slash code or, if there is none, the field id
+      IddFieldData field;
+      boost::smatch nameMatches;
+      if (boost::regex_search(fieldText,nameMatches,iddRegex::name())) {
+        field.name = matchString(nameMatches[1]); boost::trim(field.name);
+      }
+      else if (boost::regex_search(fieldText,nameMatches,iddRegex::field())) {
+        std::string fieldTypeChar = matchString(nameMatches[1]); boost::trim(fieldTypeChar);
+        std::string fieldTypeNumber = matchString(nameMatches[2]); boost::trim(fieldTypeNumber);
+        field.name = fieldTypeChar + fieldTypeNumber;
+      }
+      else {
+        require(false,"Cannot determine field name from text '" + fieldText + "'");
+      }
+
+      parseField(field,fieldText,object.name,messageHandler);
+      object.fields.push_back(field);
+
+      copyText = matchString(matches[1]);
+    }
+
+    require(copyText.empty(),"Could not process remaining field text '" + copyText +
+            "' in object '" + object.name + "'");
+
+    // the fields were found last to first
+    std::reverse(object.fields.begin(),object.fields.end());
+  }
+
+  void makeExtensible(IddObjectData& object, const MessageHandler& messageHandler) {
+    unsigned numExtensible = object.numExtensible;
+    if (numExtensible == 0) {
+      messageHandler(true,"Extensible length 0 in object '" + object.name + "'");
+      return;
+    }
+
+    // find the begin extensible field, there should be only one
+    auto extensibleBegin = object.fields.end();
+    for (auto it = object.fields.begin(), itEnd = object.fields.end(); it != itEnd; ++it) {
+      if (it->beginExtensible) {
+        extensibleBegin = it;
+        break;
+      }
+    }
+    if (extensibleBegin == object.fields.end()) {
+      messageHandler(true,"No begin-extensible field detected in object '" + object.name + "'");
+      return;
+    }
+    if (unsigned(object.fields.end() - extensibleBegin) < numExtensible) {
+      messageHandler(true,"Extensible fields begin too close to end of fields in object '" +
+                     object.name + "'");
+      return;
+    }
+
+    // keep one extensible group, named without numbers
+    // e.g. "Vertex 1 X-coordinate" -> "Vertex X-coordinate"
+    object.extensibleFields.assign(extensibleBegin,extensibleBegin + numExtensible);
+    object.fields.resize(extensibleBegin - object.fields.begin());
+
+    boost::regex find("\\s?[0-9]+");
+    for (IddFieldData& field : object.extensibleFields) {
+      field.name = boost::regex_replace(field.name,find,std::string(""));
+      boost::trim(field.name);
+    }
+
+    if (object.minFields > object.fields.size()) {
+      double numerator(object.minFields - object.fields.size());
+      double denominator(numExtensible);
+      object.numExtensibleGroupsRequired = unsigned(std::ceil(numerator/denominator));
+    }
+  }
+
+} // anonymous namespace
+
+IddFieldData::IddFieldData()
+  : type("UnknownType"), required(false), autosizable(false), autocalculatable(false),
+    retaincase(false), deprecated(false), beginExtensible(false),
+    minBoundType("Unbounded"), maxBoundType("Unbounded")
+{}
+
+IddObjectData::IddObjectData()
+  : unique(false), required(false), obsolete(false), hasURL(false), extensible(false),
+    numExtensible(0), numExtensibleGroupsRequired(0), minFields(0)
+{}
+
+void parseKey(IddKeyData& key, const std::string& text) {
+  boost::smatch matches;
+  require(boost::regex_search(text,matches,iddRegex::contentAndCommentLine()),
+          "Key name could not be determined from text '" + text + "'");
+  std::string keyName = matchString(matches[1]); boost::trim(keyName);
+  require(keyName == key.name,
+          "Key name '" + keyName + "' does not match expected '" + key.name + "'");
+  key.note = matchString(matches[2]);
+}
+
+void parseField(IddFieldData& field, 
+                const std::string& text, 
+                const std::string& objectName,
+                const MessageHandler& messageHandler)
+{
+  boost::smatch matches;
+  require(boost::regex_search(text,matches,iddRegex::field()),
+          "Field text does not match expected pattern: '" + text + "'");
+
+  std::string fieldTypeChar = matchString(matches[1]);
+  std::string fieldTypeNumber = matchString(matches[2]);
+  std::string fieldProperties = matchString(matches[3]);
+
+  field.fieldId = fieldTypeChar + fieldTypeNumber;
+  if (boost::iequals(fieldTypeChar,"A")) {
+    field.type = "AlphaType";
+  }
+  else if (boost::iequals(fieldTypeChar,"N")) {
+    // numerics default to real, \type may say otherwise
+    field.type = "RealType";
+  }
+  else {
+    require(false,"Unknown field type identifier found: '" + fieldTypeChar + "'");
+  }
+
+  while (boost::regex_search(fieldProperties,matches,iddRegex::metaDataComment())) {
+    std::string thisProperty = matchString(matches[1]); boost::trim(thisProperty);
+    parseFieldProperty(field,thisProperty,objectName);
+    fieldProperties = matchString(matches[2]); boost::trim(fieldProperties);
+  }
+
+  require(boost::regex_match(fieldProperties,commentRegex::whitespaceOnlyBlock()) ||
+          boost::regex_match(fieldProperties,iddRegex::commentOnlyLine()),
+          "Unable to parse remaining fields: '" + fieldProperties + "'");
+
+  if (field.type == "ChoiceType") {
+    if (field.keys.empty()) {
+      messageHandler(true,"Field is of type choice but keys are empty: '" + field.name + "'");
+    }
+  }
+  else if (!field.keys.empty()) {
+    messageHandler(true,"Field is not of type choice but has non-empty keys: '" + field.name + "'");
+  }
+
+  require(field.type != "UnknownType",
+          "Field is of unknown type after parsing: '" + field.name + "'");
+
+  // a field with a default is not required, whatever the idd text says
+  if (field.stringDefault && field.required) {
+    messageHandler(false,"Field '" + field.name + "' of object '" + objectName + 
+                   "' is both required and has default value, setting required = false.");
+    field.required = false;
+  }
+}
+
+void parseObject(IddObjectData& object, 
+                 const std::string& text,
+                 const MessageHandler& messageHandler)
+{
+  boost::smatch matches;
+  if (boost::regex_search(text,matches,iddRegex::objectAndFields())) {
+    parseObjectText(object,matchString(matches[1]));
+    parseFields(object,matchString(matches[2]),messageHandler);
+  }
+  else if (boost::regex_match(text,iddRegex::objectNoFields())) {
+    parseObjectText(object,text);
+  }
+  else {
+    require(false,"Unexpected pattern '" + text + "' found in object '" + object.name + "'");
+  }
+
+  if (object.extensible) {
+    makeExtensible(object,messageHandler);
+  }
+}
+
+} // iddParser
+} // openstudio
@@ -0,0 +1,120 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+
+#ifndef UTILITIES_IDD_IDDPARSER_HPP
+#define UTILITIES_IDD_IDDPARSER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace openstudio{
+
+/** Parsing of IDD object text into plain data. IddObject::load and GenerateIddFactory both use
+ *  these functions, so the tables the generator writes out hold exactly what parsing the text at
+ *  run time produces. Only iddRegex, commentRegex and boost are used, because the generator
+ *  compiles this file itself rather than linking utilities. */
+namespace iddParser{
+
+  /// parsed IddKey
+  struct IddKeyData {
+    std::string name;
+    std::string note;
+  };
+
+  /// parsed IddField, mirroring IddFieldProperties
+  struct IddFieldData {
+    IddFieldData();
+
+    std::string name;
+    std::string fieldId;
+    std::string type; // IddFieldType value name
+    std::string note;
+    bool required;
+    bool autosizable;
+    bool autocalculatable;
+    bool retaincase;
+    bool deprecated;
+    bool beginExtensible;
+    boost::optional<std::string> units;
+    boost::optional<std::string> ipUnits;
+    std::string minBoundType; // IddFieldProperties::BoundTypes value name
+    boost::optional<double> minBoundValue;
+    boost::optional<std::string> minBoundText;
+    std::string maxBoundType;
+    boost::optional<double> maxBoundValue;
+    boost::optional<std::string> maxBoundText;
+    boost::optional<std::string> stringDefault;
+    boost::optional<double> numericDefault;
+    std::vector<std::string> objectLists;
+    std::vector<std::string> references;
+    std::vector<std::string> externalLists;
+    std::vector<IddKeyData> keys;
+  };
+
+  /// parsed IddObject, mirroring IddObjectProperties
+  struct IddObjectData {
+    IddObjectData();
+
+    std::string name;
+    std::string group;
+    std::string memo;
+    bool unique;
+    bool required;
+    bool obsolete;
+    bool hasURL;
+    bool extensible;
+    unsigned numExtensible;
+    unsigned numExtensibleGroupsRequired;
+    std::string format;
+    unsigned minFields;
+    boost::optional<unsigned> maxFields;
+    std::vector<IddFieldData> fields;
+    std::vector<IddFieldData> extensibleFields;
+  };
+
+  /// receives messages about text that could be parsed but looks wrong (error == true), or 
+  /// that was reinterpreted (error == false)
+  typedef std::function<void (bool error, const std::string& message)> MessageHandler;
+
+  /// parse the text of key.name, throws std::runtime_error if text cannot be parsed
+  UTILITIES_API void parseKey(IddKeyData& key, const std::string& text);
+
+  /// parse the text of field.name in object objectName, throws std::runtime_error if text 
+  /// cannot be parsed
+  UTILITIES_API void parseField(IddFieldData& field, 
+                                const std::string& text, 
+                                const std::string& objectName,
+                                const MessageHandler& messageHandler);
+
+  /// parse the full text of object.name, moving its extensible group into extensibleFields,
+  /// throws std::runtime_error if text cannot be parsed
+  UTILITIES_API void parseObject(IddObjectData& object, 
+                                 const std::string& text,
+                                 const MessageHandler& messageHandler);
+
+} // iddParser
+} // openstudio
+
+#endif // UTILITIES_IDD_IDDPARSER_HPP
@@ -30,8 +30,12 @@
 
 #include "../../core/Containers.hpp"
 #include "../../core/Compare.hpp"
+#include "../../core/Path.hpp"
 
 #include <OpenStudio.hxx>
+#include <resources.hxx>
+
+#include <boost/filesystem/fstream.hpp>
 
 using namespace openstudio;
 
@@ -162,6 +166,34 @@ TEST_F(IddFixture,IddFactory_IddObjects)
   EXPECT_EQ(static_cast<unsigned>(3),field->keys().size());
 }
 
+TEST_F(IddFixture,IddFactory_TablesMatchParsedText)
+{
+  // the factory builds its objects from tables pre-parsed by GenerateIddFactory. they should be
+  // identical to what parsing the IDD text at run time produces.
+  std::vector<path> iddPaths;
+  iddPaths.push_back(resourcesPath()/toPath("energyplus/ProposedEnergy+.idd"));
+  iddPaths.push_back(resourcesPath()/toPath("model/OpenStudio.idd"));
+  for (const path& iddPath : iddPaths) {
+    SCOPED_TRACE(toString(iddPath));
+    boost::filesystem::ifstream inFile(iddPath); ASSERT_TRUE(inFile?true:false);
+    OptionalIddFile loadedIddFile = IddFile::load(inFile);
+    ASSERT_TRUE(loadedIddFile); inFile.close();
+
+    for (const IddObject& loadedObject : loadedIddFile->objects()) {
+      if (loadedObject.type() == IddObjectType::CommentOnly) {
+        continue;
+      }
+      OptionalIddObject factoryObject = IddFactory::instance().getObject(loadedObject.name());
+      ASSERT_TRUE(factoryObject);
+      SCOPED_TRACE(loadedObject.name());
+      EXPECT_EQ(loadedObject.group(),factoryObject->group());
+      EXPECT_TRUE(loadedObject.properties() == factoryObject->properties());
+      EXPECT_TRUE(loadedObject.nonextensibleFields() == factoryObject->nonextensibleFields());
+      EXPECT_TRUE(loadedObject.extensibleGroup() == factoryObject->extensibleGroup());
+    }
+  }
+}
+
 // ETH@20100521 Using this test to locate objects with characteristics I am looking for. Would
 // rather use Ruby, but not quite sure about getting/using the installer.
 TEST_F(IddFixture,IddFactory_ObjectFinder) {
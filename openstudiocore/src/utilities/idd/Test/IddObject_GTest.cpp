@@ -138,4 +138,4 @@ TEST_F(IddFixture,IddObject_InsertHandleField) {
   EXPECT_EQ("A1",object.getField(0).get().fieldId());
   EXPECT_EQ("A2",object.getField(1).get().fieldId());
   EXPECT_EQ("N1",object.getField(2).get().fieldId());
-}
+}
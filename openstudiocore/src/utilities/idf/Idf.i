@@ -108,6 +108,12 @@
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
 %ignore openstudio::IdfFile::load(std::istream&, const IddFile&);
 
+// QFuture is not wrapped
+%ignore openstudio::Workspace::saveAsync;
+
+// scope based, not useful from the bindings
+%ignore openstudio::Workspace::BatchEdit;
+
 #if defined(SWIGRUBY)
   // add mixins
   %mixin openstudio::IdfObject "Comparable, Marshal";
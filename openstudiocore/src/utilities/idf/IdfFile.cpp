@@ -20,6 +20,7 @@
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp> // needed for serialization
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include <utilities/idd/IddObject_Impl.hpp> // needed for serialization
@@ -42,8 +43,6 @@
 #include <boost/regex.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/fstream.hpp>
-#include <boost/iostreams/filter/newline.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
 
 #include <sstream>
 
@@ -449,9 +448,9 @@ boost::optional<VersionString> IdfFile::loadVersionOnly(const path& p) {
 
 std::ostream& IdfFile::print(std::ostream& os) const {
   if (!m_header.empty()) {
-    os << m_header << std::endl;
+    os << m_header << '\n';
   }
-  os << std::endl;
+  os << '\n';
   for (const IdfObject& object : m_objects){
     object.print(os);
   }
@@ -459,11 +458,21 @@ std::ostream& IdfFile::print(std::ostream& os) const {
 }
 
 bool IdfFile::save(const openstudio::path& p, bool overwrite) {
+  return printToFile(p,overwrite,m_iddFileAndFactoryWrapper,[this](std::ostream& os) { print(os); });
+}
+
+// PROTECTED
+
+bool IdfFile::printToFile(const openstudio::path& p,
+                          bool overwrite,
+                          const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                          const std::function<void (std::ostream&)>& printer)
+{
 
   // default extension
   std::string expectedExtension;
   bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
+  OptionalIddFileType iddType = iddFileAndFactoryWrapper.iddFileType();
   if (iddType) {
     if (*iddType == IddFileType::EnergyPlus) { 
       expectedExtension = "idf"; 
@@ -499,12 +508,20 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
   }
 
   if (makeParentFolder(wp)) {
-    boost::filesystem::ofstream outFile(wp);
+    // objects are printed a field at a time, so give the stream a larger buffer than the default
+    std::vector<char> buffer(1 << 20);
+    boost::filesystem::ofstream outFile;
+    outFile.rdbuf()->pubsetbuf(&buffer[0],buffer.size());
+    outFile.open(wp);
     if (outFile) {
       try {
-        print(outFile);
+        printer(outFile);
         outFile.close();
-        return true;
+        if (outFile) {
+          return true;
+        }
+        LOG(Error,"Unable to write file to path '" << toString(wp) << "'.");
+        return false;
       }
       catch (...) {
         LOG(Error,"Unable to write file to path '" << toString(wp) << "'.");
@@ -524,58 +541,47 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
 
-  int lineNum = 0;        // Idf line number
-  int objectNum = 0;      // number of objects, first is #1
-  std::string line;       // temp string to help with reading
-  boost::smatch matches;  // matches to regular expressions
-  std::string comment;    // keep running comment
-  bool firstBlock = true; // to capture first comment block as the header
+  // read the whole stream into memory, converting any line endings to '\n', so that objects can 
+  // be tokenized in place in a single pass
+  std::string buffer;
+  idfTokenizer::readBuffer(is,buffer);
 
   if (progressBar){
-    is.seekg(0, std::ios_base::end);
-    int streamsize = static_cast<int>(is.tellg());
     progressBar->setMinimum(0);
-    progressBar->setMaximum(streamsize);
-    is.seekg(0, std::ios_base::beg);
+    progressBar->setMaximum(static_cast<int>(buffer.size()));
   }
 
+  std::string::const_iterator bufferBegin = buffer.begin();
+  std::string::const_iterator bufferEnd = buffer.end();
 
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
-
-//#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-//#else
-//  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-//#endif
-  filt.push(is);
-
-  // read the file line by line using regexes
-  while(std::getline(filt, line)){
-    
-    if (line == "\r")
-    {
-      // This is not a real line at all, just the vestiges from the 
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
-    }
+  // running comment is the block of comment only lines in [commentBegin,lineBegin)
+  std::string::const_iterator commentBegin = bufferBegin;
+  bool hasComment = false;
+  bool firstBlock = true; // to capture first comment block as the header
 
-    ++lineNum;
+  std::string::const_iterator lineEnd, nextLine;
+  for (std::string::const_iterator lineBegin = bufferBegin; lineBegin != bufferEnd; lineBegin = nextLine) {
+    lineEnd = idfTokenizer::lineEnd(lineBegin,bufferEnd);
+    nextLine = (lineEnd == bufferEnd) ? bufferEnd : lineEnd + 1;
 
     if (progressBar){
-      int current = static_cast<int>(is.tellg());
-      progressBar->setValue(current);
+      progressBar->setValue(static_cast<int>(lineBegin - bufferBegin));
     }
 
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())){
+    if (idfTokenizer::isCommentOnlyLine(lineBegin,lineEnd)){
       // continue comment
-      comment += (line + idfRegex::newLinestring());
+      if (!hasComment) {
+        commentBegin = lineBegin;
+        hasComment = true;
+      }
     }
-    else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())){
+    else if (idfTokenizer::isWhitespaceOnlyLine(lineBegin,lineEnd)){
       // end comment
-      boost::trim(comment);
+      std::string comment;
+      if (hasComment) {
+        comment.assign(commentBegin,lineBegin);
+        boost::trim(comment);
+      }
 
       if (!comment.empty()) {
         if (firstBlock) {
@@ -605,31 +611,30 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       }
 
       //clear out comment
-      comment = "";
+      hasComment = false;
 
     }
     else{
 
-      bool foundEndLine(false);
-
       // a valid Idf object to parse
-      ++objectNum;
       firstBlock = false;
       bool isVersion = false;
 
       // peek at the object type and name for indexing in map
       std::string objectType;
 
-      if (boost::regex_search(line, matches, idfRegex::line())){
-        objectType = std::string(matches[1].first, matches[1].second); boost::trim(objectType);
+      idfTokenizer::FieldMatch match;
+      if (idfTokenizer::findField(lineBegin,lineEnd,match)){
+        std::string::const_iterator typeBegin = idfTokenizer::skipSpace(match.begin,match.separator);
+        objectType.assign(typeBegin,idfTokenizer::trimRight(typeBegin,match.separator));
       }else{
         // can't figure out the object's type
         if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
+          LOG(Warn, "Unrecognizable object type '" + std::string(lineBegin,lineEnd) + "'. Defaulting to 'Catchall'.");
         }
         objectType = "Catchall";
       }
-      if (boost::regex_match(objectType,iddRegex::versionObjectName())) {
+      if (idfTokenizer::isVersionObjectName(objectType)) {
         isVersion = true;
       }
 
@@ -645,40 +650,29 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       }
       else { OS_ASSERT(iddObject->type() != IddObjectType::Catchall); }
 
-      // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
-      comment = "";
-
-        // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())){
-        foundEndLine = true;
-      }
+      // the text for this object starts with its preceding comment
+      std::string::const_iterator textBegin = hasComment ? commentBegin : lineBegin;
+      hasComment = false;
 
       // continue reading until we have seen the entire object
       // last line will be thrown away, requires empty line between objects in Idf
-      while((!foundEndLine) && (std::getline(filt, line))){
-        ++lineNum;
-
-        // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
-
-        // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())){
-            foundEndLine = true;
-        }
+      while (!idfTokenizer::isObjectEnd(lineBegin,lineEnd) && (nextLine != bufferEnd)) {
+        lineBegin = nextLine;
+        lineEnd = idfTokenizer::lineEnd(lineBegin,bufferEnd);
+        nextLine = (lineEnd == bufferEnd) ? bufferEnd : lineEnd + 1;
       }
 
       // construct the object
       if (!versionOnly || isVersion) {
-        OptionalIdfObject object = IdfObject::load(text,*iddObject);
-        if (!object) {
-          LOG(Error,"Unable to construct IdfObject from text: " << std::endl << text 
+        std::shared_ptr<detail::IdfObject_Impl> p = detail::IdfObject_Impl::load(textBegin,nextLine,*iddObject);
+        if (!p) {
+          LOG(Error,"Unable to construct IdfObject from text: " << std::endl << std::string(textBegin,nextLine)
               << std::endl << "Throwing this object out and parsing the remainder of the file.");
-          continue;
         }
-
-        // put it in the object list
-        addObject(*object);
+        else {
+          // put it in the object list
+          addObject(IdfObject(p));
+        }
       }
 
       if (versionOnly && isVersion) {
@@ -30,6 +30,7 @@
 #include <string>
 #include <ostream>
 #include <vector>
+#include <functional>
 
 namespace openstudio{
 
@@ -216,6 +217,13 @@ class UTILITIES_API IdfFile {
 
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
   void setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
+
+  /** Implements save(p,overwrite) for a file of the type described by iddFileAndFactoryWrapper,
+   *  whose text is written by printer. */
+  static bool printToFile(const openstudio::path& p,
+                          bool overwrite,
+                          const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                          const std::function<void (std::ostream&)>& printer);
  private:
 
   std::string m_header;
@@ -22,6 +22,7 @@
 
 #include "IdfExtensibleGroup.hpp"
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddObject.hpp"
@@ -63,12 +64,51 @@ namespace openstudio {
 
 namespace detail { 
 
+  // FIELD STORAGE
+
+  IdfObject_Impl::FieldStorage::FieldStorage()
+    : m_fields(new std::vector<std::string>())
+  {}
+
+  IdfObject_Impl::FieldStorage::FieldStorage(const std::vector<std::string>& fields)
+    : m_fields(new std::vector<std::string>(fields))
+  {}
+
+  bool IdfObject_Impl::FieldStorage::isShared() const {
+    return (m_fields.use_count() > 1);
+  }
+
+  void IdfObject_Impl::FieldStorage::set(unsigned index, const std::string& value) {
+    detach()[index] = value;
+  }
+
+  void IdfObject_Impl::FieldStorage::push_back(const std::string& value) {
+    detach().push_back(value);
+  }
+
+  void IdfObject_Impl::FieldStorage::pop_back() {
+    detach().pop_back();
+  }
+
+  void IdfObject_Impl::FieldStorage::resize(unsigned n) {
+    if (n != m_fields->size()) {
+      detach().resize(n);
+    }
+  }
+
+  std::vector<std::string>& IdfObject_Impl::FieldStorage::detach() {
+    if (isShared()) {
+      m_fields.reset(new std::vector<std::string>(*m_fields));
+    }
+    return *m_fields;
+  }
+
   // CONSTRUCTORS
 
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()), 
       m_iddObject(other.iddObject()),
-      m_fields(other.fields()), 
+      m_fields(other.m_fields), // shared until one of the objects is modified
       m_fieldComments(other.fieldComments())
   {
     if (keepHandle){
@@ -167,12 +207,24 @@ namespace detail {
       return boost::none;
     }
 
+    if (returnDefault) {
+      return fieldCommentOrDefault(index);
+    }
+
+    std::string result;
+    if (index < m_fieldComments.size()) {
+      result = m_fieldComments[index];
+    }
+    return result;
+  }
+
+  std::string IdfObject_Impl::fieldCommentOrDefault(unsigned index) const {
     std::string result;
     if (index < m_fieldComments.size()) {
       result = m_fieldComments[index];
     }
 
-    if (returnDefault && result.empty()) {
+    if (result.empty()) {
       if (OptionalIddField iddField = m_iddObject.getField(index)) {
         std::stringstream ss;
         ss << makeIdfEditorComment(iddField->name()); 
@@ -252,17 +304,8 @@ namespace detail {
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const
   {
     OptionalDouble result;
-    OptionalString value = getString(index, returnDefault, false);
-    if (value){
-      if (!( istringEqual(*value,"") || 
-             istringEqual(*value,"autosize") || 
-             istringEqual(*value,"autocalculate") ))
-      {
-        try { result = boost::lexical_cast<double>(*value); } 
-        catch (const std::exception& ) {
-          LOG(Error, "Could not convert '" << *value << "' to double");
-        }
-      }
+    if (!getNumber(index,returnDefault,result)) {
+      LOG(Error, "Could not convert '" << *getString(index,returnDefault,false) << "' to double");
     }
     return result;
   }
@@ -278,42 +321,38 @@ namespace detail {
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const
   {
     OptionalUnsigned result;
-    OptionalString value = getString(index, returnDefault, false);
-    if (value){
-      if (!( istringEqual(*value,"") || 
-             istringEqual(*value,"autosize") || 
-             istringEqual(*value,"autocalculate") ))
-      {
-        try {
-          double temp = boost::lexical_cast<double>(*value);
-          result = boost::numeric_cast<unsigned>(temp);
-        } 
-        catch (const std::exception&) {
-          LOG(Error, "Could not convert '" << *value << "' to unsigned");
-        }
+    OptionalDouble value;
+    bool ok = getNumber(index,returnDefault,value);
+    if (ok && value) {
+      try {
+        result = boost::numeric_cast<unsigned>(*value);
+      } 
+      catch (const std::exception&) {
+        ok = false;
       }
     }
+    if (!ok) {
+      LOG(Error, "Could not convert '" << *getString(index,returnDefault,false) << "' to unsigned");
+    }
     return result;
   }
 
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const
   {
     OptionalInt result;
-    OptionalString value = getString(index, returnDefault, false);
-    if (value){
-      if (!( istringEqual(*value,"") || 
-             istringEqual(*value,"autosize") || 
-             istringEqual(*value,"autocalculate") ))
-      {
-        try {
-          double temp = boost::lexical_cast<double>(*value);
-          result = boost::numeric_cast<int>(temp);
-        } 
-        catch (const std::exception&) {
-          LOG(Error, "Could not convert '" << *value << "' to int");
-        }
+    OptionalDouble value;
+    bool ok = getNumber(index,returnDefault,value);
+    if (ok && value) {
+      try {
+        result = boost::numeric_cast<int>(*value);
+      } 
+      catch (const std::exception&) {
+        ok = false;
       }
     }
+    if (!ok) {
+      LOG(Error, "Could not convert '" << *getString(index,returnDefault,false) << "' to int");
+    }
     return result;
   }
 
@@ -418,12 +457,15 @@ namespace detail {
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        m_fields.set(i,newName);
+        resetFieldValue(i);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
+        nameChanged(oldName);
       } 
       else { 
         m_fields.push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
+        nameChanged(boost::none);
       }
       return newName; // success!
     }
@@ -489,17 +531,23 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize fields
+        OptionalString pushedName = name();
         m_fields.resize(n);
+        trimFieldValues();
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
+        if (pushedName && !name()) {
+          nameChanged(pushedName);
+        }
         
         return false;
       }
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields.set(index,value);
+      resetFieldValue(index);
       m_diffs.push_back(IdfObjectDiff(index, oldValue, value));
       return result;
     }
@@ -649,10 +697,15 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize the fields
+        OptionalString pushedName = name();
         m_fields.resize(n);
+        trimFieldValues();
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
+        if (pushedName && !name()) {
+          nameChanged(pushedName);
+        }
         return result;
       }
     }
@@ -679,10 +732,15 @@ namespace detail {
           m_diffs.resize(diffSize);
           
           // resize the fields
+          OptionalString pushedName = name();
           m_fields.resize(n);
+          trimFieldValues();
           if (m_fieldComments.size() > n){
             m_fieldComments.resize(n);
           }
+          if (pushedName && !name()) {
+            nameChanged(pushedName);
+          }
           return result;
         }
       }
@@ -841,6 +899,7 @@ namespace detail {
       }
 
       m_fields.resize(numAfterPop);
+      trimFieldValues();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(numAfterPop);
       }
@@ -1208,7 +1267,7 @@ namespace detail {
     IdfObject_Impl idfObjectImpl;
 
     try {
-      idfObjectImpl.parse(text,true);
+      idfObjectImpl.parse(text.begin(),text.end(),true);
       idfObjectImpl.resizeToMinFields();
     }
     catch (...) { return result; }
@@ -1221,17 +1280,28 @@ namespace detail {
   std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const std::string& text,
                                                          const IddObject& iddObject)
   {
-    std::shared_ptr<IdfObject_Impl> result;
-    IdfObject_Impl idfObjectImpl(iddObject,false,true);
+    return load(text.begin(),text.end(),iddObject);
+  }
+
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(std::string::const_iterator begin,
+                                                         std::string::const_iterator end,
+                                                         const IddObject& iddObject)
+  {
+    // parse directly into the returned object rather than into a temporary that is then copied
+    std::shared_ptr<IdfObject_Impl> result(new IdfObject_Impl(iddObject,false,true));
 
     try {
-      idfObjectImpl.parse(text,false);
-      idfObjectImpl.resizeToMinFields();
+      result->parse(begin,end,false);
+      result->resizeToMinFields();
     }
-    catch (...) { return result; }
+    catch (...) { return std::shared_ptr<IdfObject_Impl>(); }
 
-    bool keepHandle = idfObjectImpl.iddObject().hasHandleField();
-    result = std::shared_ptr<IdfObject_Impl>(new IdfObject_Impl(idfObjectImpl,keepHandle));
+    if (result->iddObject().hasHandleField()) {
+      OS_ASSERT(!result->handle().isNull());
+    }
+    else {
+      result->m_handle = openstudio::createUUID();
+    }
     return result;
   }
 
@@ -1253,7 +1323,7 @@ namespace detail {
       }
     }
 
-    os << std::endl;
+    os << '\n';
 
     return os;
   }
@@ -1261,7 +1331,7 @@ namespace detail {
   std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
     // print comment, if any
     if (!m_comment.empty()){
-      os << m_comment << std::endl;
+      os << m_comment << '\n';
     }
 
     // if this is a comment only object, return
@@ -1273,10 +1343,10 @@ namespace detail {
     os << m_iddObject.name();
 
     if (hasFields) {
-      os << "," << std::endl;
+      os << "," << '\n';
     }
     else {
-      os << ";" << std::endl;
+      os << ";" << '\n';
     }
       
     return os;
@@ -1287,62 +1357,88 @@ namespace detail {
                                            bool isLastField) const 
   {
     if (index < numFields()) {
-      // different formatting for vertices
-      if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
-        ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
-        static int textWidth(0);
-        if (eIndex.field == 0) {
-          os << "  ";
-          textWidth = 0;
-        }
-        else {
-          os << " ";
-        }
-        // field value
-        os << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        }
-        else {
-          os << ",";
-        }
-        textWidth += m_fields[index].size();
-        // comment
-        if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
-          int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
-          if (numSpaces > 0) {
-            os << std::setw(numSpaces) << " ";
-          }
-          os << " !- X,Y,Z Vertex " << eIndex.group + 1;
-          IddField iddField = m_iddObject.getField(index).get();
-          if (OptionalString units = iddField.properties().units) {
-            os << " {" << *units << "}";
-          }
-          os << std::endl;
-        }
+      printFieldValue(os,index,m_fields[index],isLastField);
+    }
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printFieldValue(std::ostream& os,
+                                                unsigned index,
+                                                const std::string& value,
+                                                bool isLastField) const
+  {
+    // different formatting for vertices
+    if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
+      ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
+      static int textWidth(0);
+      if (eIndex.field == 0) {
+        os << "  ";
+        textWidth = 0;
       }
       else {
-        // field value
-        os << "  " << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        }
-        else {
-          os << ",";
-        }
-        // field comment
-        int numSpaces = IdfObject::printedFieldSpace() - int(m_fields[index].size());
+        os << " ";
+      }
+      // field value
+      os << value;
+      // delimiter
+      if (isLastField) {
+        os << ";";
+      }
+      else {
+        os << ",";
+      }
+      textWidth += value.size();
+      // comment
+      if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
+        int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
         if (numSpaces > 0) {
           os << std::setw(numSpaces) << " ";
         }
-        os << " " << fieldComment(index,true) << std::endl;
+        os << " !- X,Y,Z Vertex " << eIndex.group + 1;
+        IddField iddField = m_iddObject.getField(index).get();
+        if (OptionalString units = iddField.properties().units) {
+          os << " {" << *units << "}";
+        }
+        os << '\n';
+      }
+    }
+    else {
+      // field value
+      os << "  " << value;
+      // delimiter
+      if (isLastField) {
+        os << ";";
       }
-    } // if index < numFields()
+      else {
+        os << ",";
+      }
+      // field comment
+      int numSpaces = IdfObject::printedFieldSpace() - int(value.size());
+      if (numSpaces > 0) {
+        os << std::setw(numSpaces) << " ";
+      }
+      os << " " << fieldCommentOrDefault(index) << '\n';
+    }
     return os;
   }
 
+  void IdfObject_Impl::nameChanged(const boost::optional<std::string>& oldName)
+  {}
+
+  void IdfObject_Impl::resetFieldValue(unsigned index)
+  {
+    if (index < m_fieldValues.size()) {
+      m_fieldValues[index] = FieldValue();
+    }
+  }
+
+  void IdfObject_Impl::trimFieldValues()
+  {
+    if (m_fieldValues.size() > m_fields.size()) {
+      m_fieldValues.resize(m_fields.size());
+    }
+  }
+
   void IdfObject_Impl::emitChangeSignals() 
   {
     if (m_diffs.empty()){
@@ -1406,33 +1502,18 @@ namespace detail {
     }
   }
 
-  void IdfObject_Impl::parse(const std::string& text,bool getIddFromFactory)
+  void IdfObject_Impl::parse(std::string::const_iterator begin,
+                             std::string::const_iterator end,
+                             bool getIddFromFactory)
   {
-    std::string objectType;
-
-    // cut down on this text as we parse
-    std::string parsedText(text);
-
     // get preceding comments
-    boost::smatch matches;
-    while(boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())){
-      std::string comment(matches[1].first, matches[1].second); 
-      std::string otherText(matches[2].first, matches[2].second); boost::trim_left(otherText);
+    begin = parseComments(begin,end);
 
-      // append the comment
-      if(!comment.empty()){
-        m_comment += "!" + comment + idfRegex::newLinestring();
-      }
-
-      // reduce the parsed text
-      parsedText = otherText;
-    }
-    
     // the first entry will be the object type
-    if (boost::regex_search(parsedText, matches, idfRegex::line())){
-      objectType = std::string(matches[1].first, matches[1].second); boost::trim(objectType);
-      std::string commentOrOtherText(matches[2].first, matches[2].second); boost::trim_left(commentOrOtherText);
-      std::string otherText(matches[3].first, matches[3].second);
+    idfTokenizer::FieldMatch match;
+    if (idfTokenizer::findField(begin,end,match)) {
+      std::string::const_iterator typeBegin = idfTokenizer::skipSpace(match.begin,match.separator);
+      std::string objectType(typeBegin,idfTokenizer::trimRight(typeBegin,match.separator));
 
       if (getIddFromFactory) {
         // find appropriate IddObject in IddFactory
@@ -1458,78 +1539,75 @@ namespace detail {
         }
       }
 
-      if (boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine()) ||
-          boost::regex_match(commentOrOtherText, commentRegex::whitespaceOnlyBlock())){
-
-        // set comment
-        m_comment += commentOrOtherText;
-
-        // reduce the parsed text
-        parsedText = otherText;
-      }else{
-        // reduce the parsed text
-        parsedText = commentOrOtherText + otherText;
+      // the rest of the type line is either a comment, or more fields
+      std::string::const_iterator commentBegin = idfTokenizer::skipSpace(match.separator + 1,match.rest);
+      if ((commentBegin == match.rest) || (*commentBegin == '!')) {
+        m_comment.append(commentBegin,match.rest);
+        begin = match.rest;
+      }
+      else {
+        begin = commentBegin;
       }
 
     }
     else {
-      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << parsedText << "'");
+      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << std::string(begin,end) << "'");
     }
 
-   // get trailing comments
-    while(boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())){
-      std::string comment(matches[1].first, matches[1].second); 
-      std::string otherText(matches[2].first, matches[2].second); boost::trim_left(otherText);
-
-      // append the comment
-      if(!comment.empty()){
-        m_comment += "!" + comment + idfRegex::newLinestring();
-      }
-
-      // reduce the parsed text
-      parsedText = otherText;
-    }
+    // get trailing comments
+    begin = parseComments(begin,end);
 
     // remove trailing whitespace and new lines
     boost::trim_right(m_comment);
 
     // parse the fields
-    parseFields(parsedText); 
+    parseFields(begin,end); 
   }
 
-  void IdfObject_Impl::parseFields(const std::string& text)
+  std::string::const_iterator IdfObject_Impl::parseComments(std::string::const_iterator begin,
+                                                           std::string::const_iterator end)
   {
-    // match variables
-    boost::match_results<std::string::const_iterator> matches;
+    while (idfTokenizer::isCommentOnlyLine(begin,end)) {
+      std::string::const_iterator commentBegin = idfTokenizer::skipSpace(begin,end) + 1;
+      std::string::const_iterator commentEnd = idfTokenizer::lineEnd(commentBegin,end);
 
-    // cut down on this text as we parse
-    std::string::const_iterator start = text.begin ();
-    std::string::const_iterator stop = text.end ();
-    
+      // append the comment
+      if (commentBegin != commentEnd) {
+        m_comment += "!";
+        m_comment.append(commentBegin,commentEnd);
+        m_comment += idfRegex::newLinestring();
+      }
+
+      // reduce the parsed text
+      begin = idfTokenizer::skipSpace(commentEnd,end);
+    }
+    return begin;
+  }
+
+  void IdfObject_Impl::parseFields(std::string::const_iterator begin,
+                                   std::string::const_iterator end)
+  {
     // current idd field index
     unsigned iddFieldIndex = 0;
 
     // parse all the fields
-    while (boost::regex_search(start, stop, matches, idfRegex::line())) {
-      std::string fieldText(matches[1].first, matches[1].second); 
-      boost::trim(fieldText);
-      std::string commentOrOtherText(matches[2].first, matches[2].second); 
-      boost::trim(commentOrOtherText);
-
-      if (commentOrOtherText.empty() ||
-          boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine()))
-      {
+    idfTokenizer::FieldMatch match;
+    while (idfTokenizer::findField(begin,end,match)) {
+      std::string::const_iterator fieldBegin = idfTokenizer::skipSpace(match.begin,match.separator);
+      std::string::const_iterator fieldEnd = idfTokenizer::trimRight(fieldBegin,match.separator);
+      std::string::const_iterator commentBegin = idfTokenizer::skipSpace(match.separator + 1,match.rest);
+      std::string::const_iterator commentEnd = idfTokenizer::trimRight(commentBegin,match.rest);
+
+      if ((commentBegin == commentEnd) || (*commentBegin == '!')) {
         // reduce the text
-        start = matches[3].first;
-        stop = matches[3].second;
-      } 
+        begin = match.rest;
+      }
       else {
         // reduce the text; there may be multiple fields on this line
-        start = matches[2].first;
-        stop = matches[3].second;
+        begin = match.separator + 1;
 
-        // matches[2] is not a comment
-        commentOrOtherText.clear();
+        // the rest of the line is not a comment
+        commentEnd = commentBegin;
       }
 
       // get the idd field
@@ -1538,21 +1616,19 @@ namespace detail {
       if (iddField) {
 
         // add this to our fields
-        m_fields.push_back(fieldText);
+        m_fields.push_back(std::string(fieldBegin,fieldEnd));
 
-        if (!commentOrOtherText.empty()) {
+        if (commentBegin != commentEnd) {
           // drop default comments
-          if (!boost::regex_match(commentOrOtherText,
-                                  commentRegex::editorCommentWhitespaceOnlyLine()))
-          {
+          if (!idfTokenizer::isEditorComment(commentBegin,commentEnd)) {
             m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
+            m_fieldComments.back().assign(commentBegin,commentEnd);
           }
         }
 
         // keep handle if this is a handle field
         if (iddField->properties().type == IddFieldType::HandleType) {
-          Handle candidate = toUUID(fieldText);
+          Handle candidate = toUUID(m_fields.back());
           if (!candidate.isNull()) {
             m_handle = candidate;
           }
@@ -1563,7 +1639,8 @@ namespace detail {
         LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " <<
           "cannot have field index of " << iddFieldIndex << ". " <<
           "Cutting off IdfObject field parsing here, with the following text " <<
-          "remaining: " << std::endl << fieldText << std::endl << std::string (start, stop));
+          "remaining: " << std::endl << std::string(fieldBegin,fieldEnd) << std::endl << 
+          std::string(begin,end));
         return;
       }
 
@@ -1571,11 +1648,10 @@ namespace detail {
       ++iddFieldIndex;
     } // while line matches
 
-    std::string unparsedText (start, stop);
-    boost::trim (unparsedText);
-    if (!unparsedText.empty()) {
+    std::string::const_iterator unparsedBegin = idfTokenizer::skipSpace(begin,end);
+    if (unparsedBegin != end) {
       LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " 
-        << std::endl << unparsedText);
+        << std::endl << std::string(unparsedBegin,idfTokenizer::trimRight(unparsedBegin,end)));
     }
 
   }
@@ -1593,6 +1669,7 @@ namespace detail {
       for (unsigned i = 0, n = numFields(); i < n; ++i) {
         if (!(m_iddObject.isNonextensibleField(i) || m_iddObject.isExtensibleField(i))) {
           m_fields.resize(i);
+          trimFieldValues();
           if (m_fieldComments.size() > m_fields.size()) {
             m_fieldComments.resize(i);
           }
@@ -1950,7 +2027,7 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
 
   std::vector<std::string> IdfObject_Impl::fields() const
   {
-    return m_fields;
+    return m_fields.get();
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const
@@ -1958,6 +2035,48 @@ void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool checkNa
     return m_fieldComments;
   }
 
+  bool IdfObject_Impl::getNumber(unsigned index,
+                                 bool returnDefault,
+                                 boost::optional<double>& value) const
+  {
+    value.reset();
+    FieldValue fieldValue;
+    if ((index < m_fields.size()) && !(returnDefault && m_fields[index].empty())) {
+      // parse field text once, and keep the result until the field is changed
+      if (m_fieldValues.size() < m_fields.size()) {
+        m_fieldValues.resize(m_fields.size());
+      }
+      if (m_fieldValues[index].kind == FieldValue::Unparsed) {
+        m_fieldValues[index] = parseFieldValue(m_fields[index]);
+      }
+      fieldValue = m_fieldValues[index];
+    }
+    else if (OptionalString text = getString(index,returnDefault,false)) {
+      fieldValue = parseFieldValue(*text);
+    }
+    if (fieldValue.kind == FieldValue::Number) {
+      value = fieldValue.value;
+    }
+    return (fieldValue.kind != FieldValue::Invalid);
+  }
+
+  IdfObject_Impl::FieldValue IdfObject_Impl::parseFieldValue(const std::string& text) {
+    FieldValue result;
+    if (text.empty() || istringEqual(text,"autosize") || istringEqual(text,"autocalculate")) {
+      result.kind = FieldValue::NoValue;
+    }
+    else {
+      try {
+        result.value = boost::lexical_cast<double>(text);
+        result.kind = FieldValue::Number;
+      }
+      catch (const std::exception&) {
+        result.kind = FieldValue::Invalid;
+      }
+    }
+    return result;
+  }
+
 } // detail
 
 // CONSTRUCTORS
@@ -405,6 +405,7 @@ class UTILITIES_API IdfObject {
   friend class detail::Workspace_Impl;       // for finding IdfObjects in a workspace
   friend class WorkspaceObject;              // for WorkspaceObject::idfObject()
   friend class Workspace;                    // for toIdfFile completion (constructs IdfObject from impl)
+  friend class IdfFile;                      // for IdfFile::m_load (constructs IdfObject from impl)
 
   /** Protected constructor from impl. */
   IdfObject(std::shared_ptr<detail::IdfObject_Impl> impl);
@@ -36,6 +36,7 @@
 #include <string>
 #include <ostream>
 #include <vector>
+#include <memory>
 
 namespace openstudio { 
 
@@ -331,6 +332,12 @@ namespace detail {
      *  be invalid at enums::Strictness level None.) */
     static std::shared_ptr<IdfObject_Impl> load(const std::string& text,const IddObject& iddObject);
 
+    /** Constructor from the text in [begin,end) and an explicit iddObject. Used by IdfFile to
+     *  parse objects in place from its load buffer. */
+    static std::shared_ptr<IdfObject_Impl> load(std::string::const_iterator begin,
+                                                std::string::const_iterator end,
+                                                const IddObject& iddObject);
+
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
 
@@ -389,13 +396,59 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
+    /** Field values that are shared with clones of this object until either object modifies 
+     *  them. Read access mirrors std::vector; every modification goes through a member that first 
+     *  makes the values unique to this object, so a Workspace clone does not copy the fields of 
+     *  objects that are never changed. */
+    class FieldStorage {
+     public:
+      FieldStorage();
+
+      explicit FieldStorage(const std::vector<std::string>& fields);
+
+      const std::vector<std::string>& get() const { return *m_fields; }
+
+      unsigned size() const { return m_fields->size(); }
+
+      bool empty() const { return m_fields->empty(); }
+
+      const std::string& operator[](unsigned index) const { return (*m_fields)[index]; }
+
+      const std::string& back() const { return m_fields->back(); }
+
+      /** Returns true if the values are currently shared with another object. */
+      bool isShared() const;
+
+      void set(unsigned index, const std::string& value);
+
+      void push_back(const std::string& value);
+
+      void pop_back();
+
+      void resize(unsigned n);
+
+     private:
+      std::vector<std::string>& detach();
+
+      std::shared_ptr<std::vector<std::string> > m_fields;
+    };
+
     // idf fields
-    std::vector<std::string> m_fields;
+    FieldStorage m_fields;
     std::vector<std::string> m_fieldComments; // only populated if encounter non-empty, non-default comment
 
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
 
+    // numeric interpretation of m_fields, parsed on first use by the numeric getters
+    struct FieldValue {
+      enum Kind { Unparsed, NoValue, Number, Invalid };
+      Kind kind;
+      double value;
+      FieldValue() : kind(Unparsed), value(0.0) {}
+    };
+    mutable std::vector<FieldValue> m_fieldValues; // never longer than m_fields
+
     // GETTER HELPERS
 
     std::vector<std::string> fields() const;
@@ -406,6 +459,11 @@ namespace detail {
     
     virtual boost::optional<double> getDoubleFromQuantity(unsigned index, Quantity q) const;
 
+    /** Sets value to the numeric value of field index (or its default if returnDefault and the
+     *  field is empty), or leaves it empty if the field is empty, autosize or autocalculate.
+     *  Returns false if the text cannot be converted to a number. */
+    bool getNumber(unsigned index, bool returnDefault, boost::optional<double>& value) const;
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report, bool checkNames) const;
@@ -416,6 +474,31 @@ namespace detail {
     virtual bool fieldDataIsCorrectType(unsigned index) const;
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
+
+    // SETTER HELPERS
+
+    /** Called whenever the name field is set, pushed or removed. oldName is the value name() 
+     *  returned before the change. */
+    virtual void nameChanged(const boost::optional<std::string>& oldName);
+
+    /** Returns the comment of field index, or the default comment generated from the IddField if
+     *  it has none. Does not check index against numFields(). */
+    std::string fieldCommentOrDefault(unsigned index) const;
+
+    // SERIALIZATION HELPERS
+
+    /** Serializes value as field index in the format used by printField. Lets derived classes
+     *  print substitute values (e.g. names in place of pointers) without copying the object. */
+    std::ostream& printFieldValue(std::ostream& os,
+                                  unsigned index,
+                                  const std::string& value,
+                                  bool isLastField) const;
+
+    /** Forgets the cached numeric value of field index. Call after changing m_fields[index]. */
+    void resetFieldValue(unsigned index);
+
+    /** Drops cached numeric values of fields that no longer exist. Call after removing fields. */
+    void trimFieldValues();
     
    private:
 
@@ -433,10 +516,16 @@ namespace detail {
     /* Parse IdfObject text. If getIddFromFactory, will first search for the IddObject using the 
      * IddFactory, otherwise, assumes that m_iddObject was provided and is correct. (Will log 
      * warning if the names do not match.) */
-    void parse(const std::string& text, bool getIddFromFactory);
+    void parse(std::string::const_iterator begin,
+               std::string::const_iterator end,
+               bool getIddFromFactory);
+
+    // parse comment only lines, returns the start of the remaining text
+    std::string::const_iterator parseComments(std::string::const_iterator begin,
+                                              std::string::const_iterator end);
 
     // parse fields
-    void parseFields(const std::string& text);
+    void parseFields(std::string::const_iterator begin, std::string::const_iterator end);
 
     // GETTER AND SETTER HELPERS
 
@@ -449,6 +538,8 @@ namespace detail {
     // repeat indices as many times as necessary to fill out extensible groups in m_fields
     UnsignedVector repeatExtensibleIndices(const UnsignedVector& indices) const;
 
+    static FieldValue parseFieldValue(const std::string& text);
+
     // QUERY HELPERS
 
     bool fieldDataIsWithinBounds(unsigned index) const;
@@ -0,0 +1,200 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+#include <iterator>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  namespace {
+
+    // line separators recognized by boost::regex when matching '^'
+    bool isLineSeparator(char c) {
+      return (c == '\n') || (c == '\r') || (c == '\f');
+    }
+
+    // true if '^' matches at position it of [begin,end), assuming it != begin
+    bool isLineStart(const_iterator it, const_iterator end) {
+      char previous = *(it - 1);
+      if (!isLineSeparator(previous)) {
+        return false;
+      }
+      return !((it != end) && (previous == '\r') && (*it == '\n'));
+    }
+
+  }
+
+  const_iterator lineEnd(const_iterator begin, const_iterator end) {
+    for (; begin != end; ++begin) {
+      if (*begin == '\n') {
+        break;
+      }
+    }
+    return begin;
+  }
+
+  const_iterator skipSpace(const_iterator begin, const_iterator end) {
+    while ((begin != end) && isSpace(*begin)) {
+      ++begin;
+    }
+    return begin;
+  }
+
+  const_iterator trimRight(const_iterator begin, const_iterator end) {
+    while ((end != begin) && isSpace(*(end - 1))) {
+      --end;
+    }
+    return end;
+  }
+
+  bool isCommentOnlyLine(const_iterator begin, const_iterator end) {
+    // ^[\s\t]*[!]([^\n]*)[\n]?(.*)
+    begin = skipSpace(begin,end);
+    return (begin != end) && (*begin == '!');
+  }
+
+  bool isWhitespaceOnlyLine(const_iterator begin, const_iterator end) {
+    // ^[\h]*$
+    for (; begin != end; ++begin) {
+      if ((*begin != ' ') && (*begin != '\t')) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool isObjectEnd(const_iterator begin, const_iterator end) {
+    // ^[^!]*?[;].*
+    for (; begin != end; ++begin) {
+      if (*begin == ';') {
+        return true;
+      }
+      if (*begin == '!') {
+        return false;
+      }
+    }
+    return false;
+  }
+
+  bool isEditorComment(const_iterator begin, const_iterator end) {
+    // ^[\h]*(?:!-([^\n\r\v]*))?$, applied to trimmed text
+    if (begin == end) {
+      return true;
+    }
+    if ((end - begin < 2) || (*begin != '!') || (*(begin + 1) != '-')) {
+      return false;
+    }
+    for (begin += 2; begin != end; ++begin) {
+      if ((*begin == '\n') || (*begin == '\r') || (*begin == '\v')) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool isVersionObjectName(const std::string& name) {
+    // .*[vV]ersion.*
+    std::string::size_type pos = name.find("ersion",1);
+    while (pos != std::string::npos) {
+      char c = name[pos - 1];
+      if ((c == 'v') || (c == 'V')) {
+        return true;
+      }
+      pos = name.find("ersion",pos + 1);
+    }
+    return false;
+  }
+
+  bool findField(const_iterator begin, const_iterator end, FieldMatch& match) {
+    // ^([^!]*?)[,;]([^\n]*[\n]?)(.*)
+    const_iterator candidate = begin;
+    while (true) {
+      // the lazy [^!]*? stops at the first separator, and fails at the first '!'
+      const_iterator it = candidate;
+      for (; it != end; ++it) {
+        if ((*it == ',') || (*it == ';') || (*it == '!')) {
+          break;
+        }
+      }
+      if (it == end) {
+        return false;
+      }
+      if (*it != '!') {
+        match.begin = candidate;
+        match.separator = it;
+        match.rest = lineEnd(it + 1,end);
+        if (match.rest != end) {
+          ++match.rest;
+        }
+        return true;
+      }
+      // every candidate before the '!' would fail in the same way, so restart the search at the
+      // next line start after it
+      for (++it; it != end; ++it) {
+        if (isLineStart(it,end)) {
+          break;
+        }
+      }
+      if (it == end) {
+        return false;
+      }
+      candidate = it;
+    }
+  }
+
+  void readBuffer(std::istream& is, std::string& buffer) {
+    buffer.clear();
+
+    std::streampos start = is.tellg();
+    if (start != std::streampos(-1)) {
+      is.seekg(0, std::ios_base::end);
+      std::streampos stop = is.tellg();
+      is.seekg(start);
+      if ((stop != std::streampos(-1)) && (stop > start)) {
+        buffer.resize(static_cast<std::string::size_type>(stop - start));
+        is.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+        buffer.resize(static_cast<std::string::size_type>(is.gcount()));
+      }
+    }
+    if (buffer.empty()) {
+      // stream does not support seeking
+      is.clear();
+      buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+
+    // convert CR and CRLF to LF in place
+    std::string::iterator out = buffer.begin();
+    for (std::string::const_iterator it = buffer.begin(), itEnd = buffer.end(); it != itEnd; ++it) {
+      if (*it == '\r') {
+        *out++ = '\n';
+        if (((it + 1) != itEnd) && (*(it + 1) == '\n')) {
+          ++it;
+        }
+      }
+      else {
+        *out++ = *it;
+      }
+    }
+    buffer.erase(out, buffer.end());
+  }
+
+} // idfTokenizer
+} // openstudio
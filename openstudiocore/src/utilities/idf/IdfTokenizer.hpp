@@ -0,0 +1,87 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <string>
+#include <istream>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  /** Hand-written scanners used by IdfFile and IdfObject to tokenize Idf text in a single pass
+   *  over an in-memory buffer. Each function is documented with the idfRegex (or commentRegex)
+   *  expression it replaces; the results are identical, but no text is copied and no regular
+   *  expression engine is involved. All ranges are half-open [begin,end). */
+
+  typedef std::string::const_iterator const_iterator;
+
+  /** Result of findField. [begin,separator) is the field text (matches[1] of idfRegex::line()),
+   *  [separator+1,rest) runs to the end of the separator's line, including the newline
+   *  (matches[2]), and [rest,end) is everything after (matches[3]). */
+  struct FieldMatch {
+    const_iterator begin;
+    const_iterator separator;
+    const_iterator rest;
+  };
+
+  /** Returns true if c is whitespace as defined by boost::trim and the regex class \\s. */
+  inline bool isSpace(char c) {
+    return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+  }
+
+  /** Returns an iterator to the first '\\n' in [begin,end), or end. */
+  UTILITIES_API const_iterator lineEnd(const_iterator begin, const_iterator end);
+
+  /** Returns an iterator to the first non-whitespace character in [begin,end), or end. */
+  UTILITIES_API const_iterator skipSpace(const_iterator begin, const_iterator end);
+
+  /** Returns the end of [begin,end) once trailing whitespace is removed. */
+  UTILITIES_API const_iterator trimRight(const_iterator begin, const_iterator end);
+
+  /** Equivalent to boost::regex_match(begin,end,idfRegex::commentOnlyLine()). */
+  UTILITIES_API bool isCommentOnlyLine(const_iterator begin, const_iterator end);
+
+  /** Equivalent to boost::regex_match(begin,end,commentRegex::whitespaceOnlyLine()). */
+  UTILITIES_API bool isWhitespaceOnlyLine(const_iterator begin, const_iterator end);
+
+  /** Equivalent to boost::regex_match(begin,end,idfRegex::objectEnd()). */
+  UTILITIES_API bool isObjectEnd(const_iterator begin, const_iterator end);
+
+  /** Equivalent to boost::regex_match(begin,end,commentRegex::editorCommentWhitespaceOnlyLine())
+   *  for a comment that has already been trimmed. */
+  UTILITIES_API bool isEditorComment(const_iterator begin, const_iterator end);
+
+  /** Equivalent to boost::regex_match(name,iddRegex::versionObjectName()). */
+  UTILITIES_API bool isVersionObjectName(const std::string& name);
+
+  /** Equivalent to boost::regex_search(begin,end,matches,idfRegex::line()). Returns false if no
+   *  ',' or ';' that is not preceded by a '!' on the same line can be found. */
+  UTILITIES_API bool findField(const_iterator begin, const_iterator end, FieldMatch& match);
+
+  /** Reads the remainder of is into buffer, converting CR and CRLF line endings to LF. */
+  UTILITIES_API void readBuffer(std::istream& is, std::string& buffer);
+
+} // idfTokenizer
+} // openstudio
+
+#endif //UTILITIES_IDF_IDFTOKENIZER_HPP
@@ -0,0 +1,155 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfRegex.hpp"
+#include "../../idd/CommentRegex.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/timer.hpp>
+
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+
+  struct ParsedObject {
+    std::string type;
+    std::vector<std::string> fields;
+  };
+
+  // The regex based loader that IdfFile::m_load and IdfObject_Impl::parse replaced: lines are
+  // classified with idfRegex, the text of each object is gathered, and its type and fields are
+  // parsed with idfRegex::line(). IdfObjects are not constructed, so this is a lower bound on the
+  // time the old IdfFile::load took.
+  std::vector<ParsedObject> regexLoad(const std::string& text) {
+    std::vector<ParsedObject> result;
+    std::stringstream ss(text);
+    std::string line;
+    boost::smatch matches;
+    while (std::getline(ss,line)) {
+      if (boost::regex_match(line,idfRegex::commentOnlyLine())) {
+        continue;
+      }
+      if (boost::regex_match(line,commentRegex::whitespaceOnlyLine())) {
+        continue;
+      }
+
+      std::string objectText(line + idfRegex::newLinestring());
+      bool foundEndLine = boost::regex_match(line,idfRegex::objectEnd());
+      while (!foundEndLine && std::getline(ss,line)) {
+        objectText += (line + idfRegex::newLinestring());
+        foundEndLine = boost::regex_match(line,idfRegex::objectEnd());
+      }
+
+      ParsedObject object;
+      std::string parsedText(objectText);
+      while (boost::regex_match(parsedText,idfRegex::commentOnlyLine()) &&
+             boost::regex_search(parsedText,matches,idfRegex::commentOnlyLine()))
+      {
+        parsedText = std::string(matches[2].first,matches[2].second);
+        boost::trim_left(parsedText);
+      }
+      if (!boost::regex_search(parsedText,matches,idfRegex::line())) {
+        continue;
+      }
+      object.type = std::string(matches[1].first,matches[1].second);
+      boost::trim(object.type);
+      std::string commentOrOtherText(matches[2].first,matches[2].second);
+      boost::trim_left(commentOrOtherText);
+      std::string otherText(matches[3].first,matches[3].second);
+      if (boost::regex_match(commentOrOtherText,idfRegex::commentOnlyLine()) ||
+          boost::regex_match(commentOrOtherText,commentRegex::whitespaceOnlyBlock()))
+      {
+        parsedText = otherText;
+      }
+      else {
+        parsedText = commentOrOtherText + otherText;
+      }
+
+      std::string::const_iterator start = parsedText.begin();
+      std::string::const_iterator stop = parsedText.end();
+      boost::match_results<std::string::const_iterator> fieldMatches;
+      while (boost::regex_search(start,stop,fieldMatches,idfRegex::line())) {
+        std::string fieldText(fieldMatches[1].first,fieldMatches[1].second);
+        boost::trim(fieldText);
+        std::string fieldComment(fieldMatches[2].first,fieldMatches[2].second);
+        boost::trim(fieldComment);
+        if (fieldComment.empty() || boost::regex_match(fieldComment,idfRegex::commentOnlyLine())) {
+          start = fieldMatches[3].first;
+        }
+        else {
+          start = fieldMatches[2].first;
+        }
+        stop = fieldMatches[3].second;
+        object.fields.push_back(fieldText);
+      }
+
+      result.push_back(object);
+    }
+    return result;
+  }
+
+}
+
+TEST_F(IdfFixture, IdfLoadPerformance) {
+  unsigned n = 5;
+
+  std::stringstream ss;
+  epIdfFile.print(ss);
+  std::string objectsText = ss.str();
+  for (unsigned i = 1; i < n; ++i) {
+    ss << objectsText;
+  }
+  std::string text = ss.str();
+
+  boost::timer t;
+  std::vector<ParsedObject> expected = regexLoad(text);
+  double regexTime = t.elapsed();
+
+  t.restart();
+  std::stringstream is(text);
+  OptionalIdfFile oIdfFile = IdfFile::load(is,IddFileType(IddFileType::EnergyPlus));
+  double loadTime = t.elapsed();
+
+  // both loaders see the same objects and field text
+  ASSERT_TRUE(oIdfFile);
+  IdfObjectVector objects;
+  for (const IdfObject& object : oIdfFile->objects()) {
+    if (object.iddObject().type() != IddObjectType::CommentOnly) {
+      objects.push_back(object);
+    }
+  }
+  ASSERT_EQ(expected.size(),objects.size());
+  for (unsigned i = 0, ni = objects.size(); i < ni; ++i) {
+    EXPECT_TRUE(boost::iequals(expected[i].type,objects[i].iddObject().name()));
+    ASSERT_LE(expected[i].fields.size(),objects[i].numFields());
+    for (unsigned j = 0, nj = expected[i].fields.size(); j < nj; ++j) {
+      EXPECT_EQ(expected[i].fields[j],objects[i].getString(j,false,true).get());
+    }
+  }
+
+  LOG(Info, "Loaded " << objects.size() << " objects. Regex loader (without object construction): "
+      << regexTime << "s, IdfFile::load: " << loadTime << "s.");
+}
@@ -714,6 +714,46 @@ TEST_F(IdfFixture, IdfObject_GroupPushingAndPopping) {
 
 }
 
+TEST_F(IdfFixture, IdfObject_NumericGettersFollowFieldChanges) {
+  IdfObject object(IddObjectType::BuildingSurface_Detailed);
+  StringVector values;
+  values.push_back("2.1");
+  values.push_back("autosize");
+  values.push_back("abc");
+  EXPECT_FALSE(object.pushExtensibleGroup(values).empty());
+
+  // read twice, so the second read comes from the parsed values
+  for (unsigned i = 0; i < 2; ++i) {
+    ASSERT_TRUE(object.getDouble(10));
+    EXPECT_DOUBLE_EQ(2.1,object.getDouble(10).get());
+    ASSERT_TRUE(object.getInt(10));
+    EXPECT_EQ(2,object.getInt(10).get());
+    EXPECT_FALSE(object.getDouble(11));
+    EXPECT_FALSE(object.getDouble(12));
+    EXPECT_FALSE(object.getUnsigned(12));
+  }
+
+  // setters replace the parsed values
+  EXPECT_TRUE(object.setString(10,"-3.5"));
+  ASSERT_TRUE(object.getDouble(10));
+  EXPECT_DOUBLE_EQ(-3.5,object.getDouble(10).get());
+  EXPECT_FALSE(object.getUnsigned(10));
+  EXPECT_TRUE(object.setDouble(11,0.05));
+  ASSERT_TRUE(object.getDouble(11));
+  EXPECT_DOUBLE_EQ(0.05,object.getDouble(11).get());
+  EXPECT_TRUE(object.setInt(12,7));
+  ASSERT_TRUE(object.getUnsigned(12));
+  EXPECT_EQ(7u,object.getUnsigned(12).get());
+
+  // removed fields do not leave parsed values behind
+  EXPECT_FALSE(object.popExtensibleGroup().empty());
+  EXPECT_FALSE(object.getDouble(10));
+  EXPECT_FALSE(object.pushExtensibleGroup().empty());
+  EXPECT_FALSE(object.getDouble(10));
+  EXPECT_FALSE(object.getDouble(11));
+  EXPECT_FALSE(object.getInt(12));
+}
+
 TEST_F(IdfFixture, IdfObject_ScheduleFileWithUrl)
 {
   // testing that a funky url can be parsed
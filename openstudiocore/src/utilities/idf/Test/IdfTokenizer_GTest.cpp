@@ -0,0 +1,121 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.  
+*  All rights reserved.
+*  
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*  
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*  
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfTokenizer.hpp"
+#include "../IdfRegex.hpp"
+#include "../IdfObject.hpp"
+#include "../../idd/CommentRegex.hpp"
+#include "../../idd/IddRegex.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+
+  std::vector<std::string> tokenizerTestStrings() {
+    std::vector<std::string> result;
+    result.push_back("");
+    result.push_back("   ");
+    result.push_back("\t \t");
+    result.push_back("! A comment");
+    result.push_back("   !- An editor comment");
+    result.push_back("!");
+    result.push_back("Zone,");
+    result.push_back("  Zone One,                !- Name");
+    result.push_back("  0.0;                     !- Direction of Relative North {deg}");
+    result.push_back("  Zone One, 0.0, 1.0;");
+    result.push_back("  Zone One ! with, a comment;");
+    result.push_back("  Zone One ! with, a comment\n  Zone Two;");
+    result.push_back("!- just a comment; with a semicolon");
+    result.push_back("\r\f\v");
+    result.push_back("  OS:Version,\n  {7a3e8c2c-e5b1-4b6e-bbd1-1b1b1b1b1b1b}, !- Handle\n  1.8.0;  !- Version Identifier\n");
+    result.push_back("Version,8.2;");
+    result.push_back("ZoneVentilation:DesignFlowRate,");
+    result.push_back("a\rb,c");
+    result.push_back("a!b\nc;d");
+    return result;
+  }
+
+}
+
+TEST_F(IdfFixture, IdfTokenizer_LinePredicates) {
+  for (const std::string& str : tokenizerTestStrings()) {
+    EXPECT_EQ(boost::regex_match(str,idfRegex::commentOnlyLine()),
+              idfTokenizer::isCommentOnlyLine(str.begin(),str.end())) << str;
+    EXPECT_EQ(boost::regex_match(str,commentRegex::whitespaceOnlyLine()),
+              idfTokenizer::isWhitespaceOnlyLine(str.begin(),str.end())) << str;
+    EXPECT_EQ(boost::regex_match(str,iddRegex::versionObjectName()),
+              idfTokenizer::isVersionObjectName(str)) << str;
+    if (str.find('\n') == std::string::npos) {
+      EXPECT_EQ(boost::regex_match(str,idfRegex::objectEnd()),
+                idfTokenizer::isObjectEnd(str.begin(),str.end())) << str;
+    }
+  }
+
+  std::string comment("!- Name");
+  EXPECT_TRUE(idfTokenizer::isEditorComment(comment.begin(),comment.end()));
+  comment = "! Name";
+  EXPECT_FALSE(idfTokenizer::isEditorComment(comment.begin(),comment.end()));
+}
+
+TEST_F(IdfFixture, IdfTokenizer_FindField) {
+  for (const std::string& str : tokenizerTestStrings()) {
+    boost::match_results<std::string::const_iterator> matches;
+    idfTokenizer::FieldMatch match;
+    bool regexFound = boost::regex_search(str.begin(),str.end(),matches,idfRegex::line());
+    ASSERT_EQ(regexFound,idfTokenizer::findField(str.begin(),str.end(),match)) << str;
+    if (regexFound) {
+      EXPECT_TRUE(matches[1].first == match.begin) << str;
+      EXPECT_TRUE(matches[1].second == match.separator) << str;
+      EXPECT_TRUE(matches[3].first == match.rest) << str;
+    }
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_ReadBuffer) {
+  std::stringstream ss;
+  ss << "Line one\r\nLine two\rLine three\n\r\n";
+  std::string buffer;
+  idfTokenizer::readBuffer(ss,buffer);
+  EXPECT_EQ("Line one\nLine two\nLine three\n\n",buffer);
+}
+
+TEST_F(IdfFixture, IdfTokenizer_RoundTrip) {
+  std::stringstream ss;
+  epIdfFile.print(ss);
+
+  OptionalIdfFile oIdfFile = IdfFile::load(ss,IddFileType(IddFileType::EnergyPlus));
+  ASSERT_TRUE(oIdfFile);
+  EXPECT_EQ(epIdfFile.header(),oIdfFile->header());
+
+  IdfObjectVector original = epIdfFile.objects();
+  IdfObjectVector roundTrip = oIdfFile->objects();
+  ASSERT_EQ(original.size(),roundTrip.size());
+  for (unsigned i = 0, n = original.size(); i < n; ++i) {
+    EXPECT_TRUE(original[i].iddObject() == roundTrip[i].iddObject());
+    EXPECT_TRUE(original[i].dataFieldsEqual(roundTrip[i]));
+    EXPECT_EQ(original[i].comment(),roundTrip[i].comment());
+  }
+}
@@ -26,6 +26,7 @@
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/OS_DaylightingDevice_Shelf_FieldEnums.hxx>
 #include <utilities/idd/OS_SetpointManager_MixedAir_FieldEnums.hxx>
+#include <utilities/idd/OS_SetpointManager_Scheduled_FieldEnums.hxx>
 
 #include "../WorkspaceExtensibleGroup.hpp"
 #include "../IdfFile.hpp"
@@ -35,6 +36,8 @@
 
 #include "../../core/Optional.hpp"
 
+#include <algorithm>
+
 using namespace openstudio;
 
 TEST_F(IdfFixture,WorkspaceObject_Construction) {
@@ -480,3 +483,59 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources)
   sourcesVector = node->getSources(IddObjectType::OS_SetpointManager_MixedAir);
   EXPECT_EQ(1, sourcesVector.size());
 }
+
+TEST_F(IdfFixture, WorkspaceObject_Sources_Incremental)
+{
+  Workspace ws;
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  OptionalWorkspaceObject spm2 = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  OptionalWorkspaceObject spm3 = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_Scheduled));
+  ASSERT_TRUE(node && node2 && spm && spm2 && spm3);
+
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+  EXPECT_TRUE(spm2->setPointer(OS_SetpointManager_MixedAirFields::FanOutletNodeName, node->handle()));
+  EXPECT_TRUE(spm3->setPointer(OS_SetpointManager_ScheduledFields::SetpointNodeorNodeListName, node->handle()));
+
+  WorkspaceObjectVector expected;
+  expected.push_back(*spm);
+  expected.push_back(*spm2);
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(expected, node->getSources(IddObjectType::OS_SetpointManager_MixedAir));
+  EXPECT_EQ(WorkspaceObjectVector(1u, *spm3), node->getSources(IddObjectType::OS_SetpointManager_Scheduled));
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_Node).empty());
+  EXPECT_EQ(3u, node->sources().size());
+  EXPECT_EQ(4u, node->numSources());
+
+  // spm still points to node from one field
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node2->handle()));
+  EXPECT_EQ(expected, node->getSources(IddObjectType::OS_SetpointManager_MixedAir));
+  EXPECT_EQ(WorkspaceObjectVector(1u, *spm), node2->getSources(IddObjectType::OS_SetpointManager_MixedAir));
+
+  // spm no longer points to node
+  EXPECT_TRUE(spm->setString(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, ""));
+  EXPECT_EQ(WorkspaceObjectVector(1u, *spm2), node->getSources(IddObjectType::OS_SetpointManager_MixedAir));
+
+  spm3->remove();
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_SetpointManager_Scheduled).empty());
+  EXPECT_EQ(1u, node->sources().size());
+
+  // sources of cloned objects are in the clone
+  for (bool keepHandles : {false, true}) {
+    Workspace clone = ws.clone(keepHandles);
+    WorkspaceObjectVector cloneNodes = clone.getObjectsByType(IddObjectType::OS_Node);
+    ASSERT_EQ(2u, cloneNodes.size());
+    unsigned numSources = 0;
+    for (const WorkspaceObject& cloneNode : cloneNodes) {
+      WorkspaceObjectVector sources = cloneNode.getSources(IddObjectType::OS_SetpointManager_MixedAir);
+      EXPECT_EQ(sources, cloneNode.sources());
+      for (const WorkspaceObject& source : sources) {
+        EXPECT_TRUE(source.workspace() == clone);
+        ++numSources;
+      }
+    }
+    EXPECT_EQ(2u, numSources);
+  }
+}
@@ -21,9 +21,12 @@
 #include "IdfFixture.hpp"
 #include "../WorkspaceWatcher.hpp"
 #include "../Workspace.hpp"
+#include "../Workspace_Impl.hpp"
 #include "../WorkspaceObject.hpp"
+#include "../WorkspaceObject_Impl.hpp"
 #include "../IdfExtensibleGroup.hpp"
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/Lights_FieldEnums.hxx>
 
 #include <resources.hxx>
 
@@ -91,3 +94,66 @@ TEST_F(IdfFixture,WorkspaceWatcher_RemoveObjects)
   EXPECT_TRUE(result[0].handle().isNull());
 }
 
+
+TEST_F(IdfFixture,WorkspaceWatcher_BatchEdit)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+  OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(zone);
+  ASSERT_TRUE(lights);
+  EXPECT_TRUE(zone->setName("Zone 1"));
+  WorkspaceWatcher watcher(workspace);
+
+  int workspaceChanges = 0;
+  int lightsChanges = 0;
+  int lightsDataChanges = 0;
+  int lightsRelationshipChanges = 0;
+  QObject::connect(workspace.getImpl<detail::Workspace_Impl>().get(), &detail::Workspace_Impl::onChange,
+                   [&workspaceChanges]() { ++workspaceChanges; });
+  std::shared_ptr<detail::WorkspaceObject_Impl> lightsImpl = lights->getImpl<detail::WorkspaceObject_Impl>();
+  QObject::connect(lightsImpl.get(), &detail::WorkspaceObject_Impl::onChange,
+                   [&lightsChanges]() { ++lightsChanges; });
+  QObject::connect(lightsImpl.get(), &detail::WorkspaceObject_Impl::onDataChange,
+                   [&lightsDataChanges]() { ++lightsDataChanges; });
+  QObject::connect(lightsImpl.get(), &detail::WorkspaceObject_Impl::onRelationshipChange,
+                   [&lightsRelationshipChanges]() { ++lightsRelationshipChanges; });
+
+  {
+    Workspace::BatchEdit batchEdit(workspace);
+    EXPECT_TRUE(workspace.isBatchEditing());
+    {
+      Workspace::BatchEdit nestedBatchEdit(workspace);
+      EXPECT_TRUE(lights->setDouble(LightsFields::LightingLevel, 100.0));
+      EXPECT_TRUE(lights->setDouble(LightsFields::LightingLevel, 200.0));
+      EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListName, zone->handle()));
+    }
+    EXPECT_TRUE(workspace.isBatchEditing());
+    EXPECT_TRUE(lights->setDouble(LightsFields::LightingLevel, 300.0));
+
+    // nothing has been signaled yet, but the data is in place
+    EXPECT_EQ(0, workspaceChanges);
+    EXPECT_EQ(0, lightsChanges);
+    EXPECT_FALSE(watcher.dirty());
+    EXPECT_DOUBLE_EQ(300.0, lights->getDouble(LightsFields::LightingLevel).get());
+
+    // additions are still signaled as they happen
+    OptionalWorkspaceObject lights2 = workspace.addObject(IdfObject(IddObjectType::Lights));
+    ASSERT_TRUE(lights2);
+    EXPECT_TRUE(watcher.objectAdded());
+    EXPECT_EQ(0, workspaceChanges);
+  }
+
+  // one coalesced set of signals per object, then one for the workspace
+  EXPECT_FALSE(workspace.isBatchEditing());
+  EXPECT_EQ(1, lightsChanges);
+  EXPECT_EQ(1, lightsDataChanges);
+  EXPECT_EQ(1, lightsRelationshipChanges);
+  EXPECT_EQ(1, workspaceChanges);
+  EXPECT_TRUE(watcher.dirty());
+
+  // outside of a batch edit every change signals immediately
+  EXPECT_TRUE(lights->setDouble(LightsFields::LightingLevel, 400.0));
+  EXPECT_EQ(2, lightsChanges);
+  EXPECT_EQ(2, workspaceChanges);
+}
@@ -86,6 +86,45 @@ TEST_F(IdfFixture, IdfFile_Workspace_Roundtrip)
   copyOfIdfFile.print(outFile); outFile.close();
 }
 
+TEST_F(IdfFixture, Workspace_StreamingSave)
+{
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+
+  // printing directly matches printing through an IdfFile
+  std::stringstream expected;
+  workspace.toIdfFile().print(expected);
+  std::stringstream printed;
+  printed << workspace;
+  EXPECT_EQ(expected.str(), printed.str());
+
+  openstudio::path savePath = outDir/toPath("streamingSave.idf");
+  ASSERT_TRUE(workspace.save(savePath,true));
+  EXPECT_FALSE(workspace.save(savePath,false));
+  {
+    boost::filesystem::ifstream inFile(savePath);
+    std::stringstream saved;
+    saved << inFile.rdbuf();
+    EXPECT_EQ(expected.str(), saved.str());
+  }
+
+  // the background save writes the workspace as it was when saveAsync was called
+  openstudio::path asyncPath = outDir/toPath("streamingSaveAsync.idf");
+  QFuture<bool> future = workspace.saveAsync(asyncPath,true);
+  workspace.addObject(IdfObject(IddObjectType::Zone));
+  for (WorkspaceObject object : workspace.objects()) {
+    if (object.name() && !object.name()->empty()) {
+      object.setName(object.name().get() + " Changed");
+    }
+  }
+  EXPECT_TRUE(future.result());
+  {
+    boost::filesystem::ifstream inFile(asyncPath);
+    std::stringstream saved;
+    saved << inFile.rdbuf();
+    EXPECT_EQ(expected.str(), saved.str());
+  }
+}
+
 TEST_F(IdfFixture, ObjectHasURL)
 {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
@@ -530,6 +569,56 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_CloneSharedFields) {
+  Workspace workspace(epIdfFile,StrictnessLevel::None);
+  Workspace clone = workspace.clone(true);
+  EXPECT_TRUE(workspace.handles() == clone.handles());
+
+  // untouched objects have the same data
+  for (const WorkspaceObject& object : workspace.objects()) {
+    OptionalWorkspaceObject cloneObject = clone.getObject(object.handle());
+    ASSERT_TRUE(cloneObject);
+    EXPECT_TRUE(object.fields() == cloneObject->fields());
+  }
+
+  // changing the clone does not change the original, and vice versa
+  WorkspaceObjectVector schedules = workspace.getObjectsByType(IddObjectType::Schedule_Compact);
+  ASSERT_FALSE(schedules.empty());
+  WorkspaceObject original = schedules[0];
+  OptionalWorkspaceObject copy = clone.getObject(original.handle());
+  ASSERT_TRUE(copy);
+  std::vector<std::string> originalFields = original.fields();
+  unsigned n = original.numFields();
+
+  EXPECT_FALSE(copy->pushExtensibleGroup(StringVector(1u,"Until: 24:00")).empty());
+  EXPECT_EQ(n + 1u, copy->numFields());
+  EXPECT_EQ(n, original.numFields());
+  EXPECT_TRUE(originalFields == original.fields());
+
+  EXPECT_TRUE(original.setName("Original Schedule"));
+  EXPECT_EQ("Original Schedule", original.name().get());
+  EXPECT_NE("Original Schedule", copy->name().get());
+  EXPECT_EQ(originalFields[0], copy->name().get());
+
+  // objects that were not modified are still equal
+  WorkspaceObjectVector buildings = workspace.getObjectsByType(IddObjectType::Building);
+  ASSERT_FALSE(buildings.empty());
+  OptionalWorkspaceObject cloneBuilding = clone.getObject(buildings[0].handle());
+  ASSERT_TRUE(cloneBuilding);
+  EXPECT_TRUE(buildings[0].fields() == cloneBuilding->fields());
+
+  // a clone with new handles is independent as well
+  Workspace newHandlesClone = clone.clone();
+  WorkspaceObjectVector cloneSchedules = newHandlesClone.getObjectsByType(IddObjectType::Schedule_Compact);
+  ASSERT_EQ(schedules.size(), cloneSchedules.size());
+  OptionalWorkspaceObject copyOfCopy = newHandlesClone.getObjectByTypeAndName(IddObjectType::Schedule_Compact,
+                                                                              copy->name().get());
+  ASSERT_TRUE(copyOfCopy);
+  EXPECT_EQ(n + 1u, copyOfCopy->numFields());
+  EXPECT_TRUE(copyOfCopy->setString(copyOfCopy->numFields() - 1u,"Until: 12:00"));
+  EXPECT_EQ("Until: 24:00", copy->getString(copy->numFields() - 1u).get());
+}
+
 TEST_F(IdfFixture,Workspace_Insert) {
   Workspace workspace(epIdfFile,StrictnessLevel::None);
   unsigned n = workspace.handles().size();
@@ -2065,3 +2154,47 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID)
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", true).size());
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
+
+TEST_F(IdfFixture, Workspace_NameIndices)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> zone1 = ws.addObject(IdfObject(IddObjectType::Zone));
+  boost::optional<WorkspaceObject> zone2 = ws.addObject(IdfObject(IddObjectType::Zone));
+  boost::optional<WorkspaceObject> schedule = ws.addObject(IdfObject(IddObjectType::Schedule_Constant));
+  ASSERT_TRUE(zone1 && zone2 && schedule);
+  EXPECT_EQ("Zone 1", zone1->name().get());
+  EXPECT_EQ("Zone 2", zone2->name().get());
+
+  // names are case insensitive
+  schedule->setName("ZONE 3");
+  EXPECT_EQ(1u, ws.getObjectsByName("zone 3", true).size());
+  EXPECT_EQ(3u, ws.getObjectsByName("zone", false).size());
+  EXPECT_EQ(2u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "zone").size());
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Schedule_Constant, "Zone 3"));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 3"));
+  EXPECT_EQ("Zone 4", ws.nextName("Zone", false));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, false));
+
+  // renaming and removing objects keeps the indices current
+  zone1->setName("Office");
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 1", true).size());
+  EXPECT_EQ(1u, ws.getObjectsByName("Office", true).size());
+  EXPECT_EQ("Zone 1", ws.nextName(IddObjectType::Zone, true));
+  EXPECT_EQ("Zone 3", ws.nextName(IddObjectType::Zone, false));
+
+  zone2->remove();
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 2", true).size());
+  EXPECT_EQ(1u, ws.getObjectsByName("Zone", false).size());
+  EXPECT_EQ(0u, ws.getObjectsByTypeAndName(IddObjectType::Zone, "Zone").size());
+  EXPECT_EQ("Zone 1", ws.nextName(IddObjectType::Zone, false));
+  EXPECT_EQ("Zone 1", ws.nextName("Zone", true));
+  EXPECT_EQ("Zone 4", ws.nextName("Zone", false));
+
+  // objects of different types sharing a name are all found
+  schedule->setName("Office");
+  EXPECT_EQ(2u, ws.getObjectsByName("office", true).size());
+  zone1->remove();
+  ASSERT_EQ(1u, ws.getObjectsByName("office", true).size());
+  EXPECT_EQ(schedule->handle(), ws.getObjectsByName("office", true)[0].handle());
+}
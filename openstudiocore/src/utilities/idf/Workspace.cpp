@@ -36,6 +36,10 @@
 #include "../core/Compare.hpp"
 #include "../core/StringHelpers.hpp"
 
+#include "../idd/Comments.hpp"
+
+#include <QtConcurrentRun>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/regex.hpp>
 #include <boost/lexical_cast.hpp>
@@ -53,12 +57,28 @@ namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // key for the name indices, equal for two names exactly when istringEqual is true
+    std::string nameKey(const std::string& name) {
+      std::string result(name);
+      for (char& c : result) {
+        c = static_cast<char>(toupper(c));
+      }
+      return result;
+    }
+
+  }
+
   // CONSTRUCTORS
 
   Workspace_Impl::Workspace_Impl(StrictnessLevel level,IddFileType iddFileType) :
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_endingBatchEdit(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -69,6 +89,9 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_endingBatchEdit(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -78,6 +101,9 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_batchEditDepth(0),
+    m_batchEditChanged(false),
+    m_endingBatchEdit(false),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -100,6 +126,9 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_batchEditDepth(0),
+      m_batchEditChanged(false),
+      m_endingBatchEdit(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -176,6 +205,10 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    m_nameMap.swap(otherImpl->m_nameMap);
+    m_nameSeriesMap.swap(otherImpl->m_nameSeriesMap);
+    m_iddObjectTypeNameSeriesMap.swap(otherImpl->m_iddObjectTypeNameSeriesMap);
   }
 
   // GETTERS
@@ -334,23 +367,19 @@ namespace detail {
                                                                 bool exactMatch) const
   {
     WorkspaceObjectVector result;
+    const WorkspaceObjectMap* objectMap = nullptr;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (istringEqual(*candidate,name)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
-      }
+      auto loc = m_nameMap.find(nameKey(name));
+      if (loc != m_nameMap.end()) { objectMap = &(loc->second); }
     }
     else {
-      std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (baseNamesMatch(baseName, *candidate)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
+      auto loc = m_nameSeriesMap.find(nameKey(getBaseName(name)));
+      if (loc != m_nameSeriesMap.end()) { objectMap = &(loc->second.objects); }
+    }
+    if (objectMap) {
+      result.reserve(objectMap->size());
+      for (const WorkspaceObjectMap::value_type& p : *objectMap) {
+        result.push_back(WorkspaceObject(p.second));
       }
     }
     return result;
@@ -380,10 +409,12 @@ namespace detail {
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(
       IddObjectType objectType,const std::string& name) const
   {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate,name)) {
-        return object;
+    auto loc = m_nameMap.find(nameKey(name));
+    if (loc != m_nameMap.end()) {
+      for (const WorkspaceObjectMap::value_type& p : loc->second) {
+        if (p.second->iddObject().type() == objectType) {
+          return WorkspaceObject(p.second);
+        }
       }
     }
     return boost::none;
@@ -394,13 +425,13 @@ namespace detail {
       const std::string& name) const
   {
     WorkspaceObjectVector result;
-    std::string baseName = getBaseName(name);
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      if (OptionalString candidate = object.name()) {
-        if (baseNamesMatch(baseName, *candidate)) {
-          result.push_back(object);
-        }
-      }
+    auto iotLoc = m_iddObjectTypeNameSeriesMap.find(objectType);
+    if (iotLoc == m_iddObjectTypeNameSeriesMap.end()) { return result; }
+    auto loc = iotLoc->second.find(nameKey(getBaseName(name)));
+    if (loc == iotLoc->second.end()) { return result; }
+    result.reserve(loc->second.objects.size());
+    for (const WorkspaceObjectMap::value_type& p : loc->second.objects) {
+      result.push_back(WorkspaceObject(p.second));
     }
     return result;
   }
@@ -595,11 +626,14 @@ namespace detail {
 
     // step 1: add objects to maps
     HandleVector newHandles;
+    newHandles.reserve(N);
+    m_workspaceObjectMap.reserve(m_workspaceObjectMap.size() + N);
     for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       newHandles.push_back(ptr->handle());
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(),ptr));
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
+      insertIntoNameMaps(newHandles.back(),ptr);
       emit progressValue(++i);
     }
 
@@ -1495,7 +1529,7 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr,sources,removedHandles);
-      emit onChange();
+      change();
       return true;
     }
     else {
@@ -1527,7 +1561,7 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData,sources,handles);
-      emit onChange();
+      change();
       return true;
     }
     else {
@@ -1681,8 +1715,7 @@ namespace detail {
       return toString(createUUID());
     }
 
-    WorkspaceObjectVector objectsInSeries = getObjectsByName(name,false);
-    return constructNextName(name,objectsInSeries,fillIn);
+    return constructNextName(name,m_nameSeriesMap,fillIn);
   }
 
   std::string Workspace_Impl::nextName(const IddObjectType& iddObjectType, bool fillIn) const {
@@ -1695,8 +1728,11 @@ namespace detail {
       return std::string();
     }
     std::string name = iddObjectNameToIdfObjectName(iddObject->name());
-    WorkspaceObjectVector objectsInSeries = getObjectsByTypeAndName(iddObjectType,name);
-    return constructNextName(name,objectsInSeries,fillIn);
+    auto loc = m_iddObjectTypeNameSeriesMap.find(iddObjectType);
+    if (loc == m_iddObjectTypeNameSeriesMap.end()) {
+      return constructNextName(name,NameSeriesMap(),fillIn);
+    }
+    return constructNextName(name,loc->second,fillIn);
   }
 
   bool Workspace_Impl::isValid() const {
@@ -1870,7 +1906,55 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p,overwrite);
+    return IdfFile::printToFile(p,overwrite,m_iddFileAndFactoryWrapper,[this](std::ostream& os) { print(os); });
+  }
+
+  QFuture<bool> Workspace_Impl::saveAsync(const openstudio::path& p, bool overwrite) {
+    // print names unnamed targets of pointers that are not written as handles, name them here 
+    // so that they are named in this workspace, as after save, and the clone is only read
+    for (const WorkspaceObject& object : objects()) {
+      std::shared_ptr<WorkspaceObject_Impl> objectImpl = object.getImpl<WorkspaceObject_Impl>();
+      if (!objectImpl->m_sourceData || objectImpl->iddObject().hasHandleField()) {
+        continue;
+      }
+      for (const ForwardPointer& pointer : objectImpl->m_sourceData->pointers) {
+        if (pointer.targetHandle.isNull()) {
+          continue;
+        }
+        OptionalString targetName = name(pointer.targetHandle);
+        if (targetName && targetName->empty()) {
+          OptionalWorkspaceObject target = getObject(pointer.targetHandle);
+          OS_ASSERT(target);
+          target->createName(false);
+        }
+      }
+    }
+
+    // the clone shares field values with this workspace until either is modified, so it is 
+    // cheap to make; only the worker uses it from here on
+    Workspace snapshot = clone(true);
+    return QtConcurrent::run([p,overwrite,snapshot]() {
+      return snapshot.getImpl<Workspace_Impl>()->save(p,overwrite);
+    });
+  }
+
+  std::ostream& Workspace_Impl::print(std::ostream& os) {
+    std::string header = makeComment(m_header);
+    if (!header.empty()) {
+      os << header << '\n';
+    }
+    os << '\n';
+
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      vo->getImpl<WorkspaceObject_Impl>()->printIdf(os);
+    }
+
+    WorkspaceObjectVector objs = objects(true); // sorted objects
+    for (const WorkspaceObject& obj : objs) {
+      obj.getImpl<WorkspaceObject_Impl>()->printIdf(os);
+    }
+
+    return os;
   }
 
   IdfFile Workspace_Impl::toIdfFile() {
@@ -2028,6 +2112,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // NameMap and NameSeriesMaps
+    insertIntoNameMaps(h,ptr);
+
     return true;
   }
 
@@ -2051,6 +2138,79 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameMaps(
+      const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
+  {
+    if (OptionalString name = objectImplPtr->name()) {
+      insertIntoNameMaps(handle,objectImplPtr,*name);
+    }
+  }
+
+  void Workspace_Impl::insertIntoNameMaps(
+      const Handle& handle,
+      const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr,
+      const std::string& name)
+  {
+    m_nameMap[nameKey(name)].insert(std::make_pair(handle,objectImplPtr));
+
+    std::string seriesKey = nameKey(getBaseName(name));
+    boost::optional<int> suffix = getNameSuffix(name);
+    NameSeries& series = m_nameSeriesMap[seriesKey];
+    NameSeries& typeSeries = m_iddObjectTypeNameSeriesMap[objectImplPtr->iddObject().type()][seriesKey];
+    series.objects.insert(std::make_pair(handle,objectImplPtr));
+    typeSeries.objects.insert(std::make_pair(handle,objectImplPtr));
+    if (suffix) {
+      ++series.suffixes[*suffix];
+      ++typeSeries.suffixes[*suffix];
+    }
+  }
+
+  void Workspace_Impl::removeFromNameMaps(const Handle& handle,
+                                          IddObjectType type,
+                                          const std::string& name)
+  {
+    auto nmLoc = m_nameMap.find(nameKey(name));
+    OS_ASSERT(nmLoc != m_nameMap.end());
+    nmLoc->second.erase(handle);
+    // erase entry if set is empty
+    if (nmLoc->second.empty()) { m_nameMap.erase(nmLoc); }
+
+    std::string seriesKey = nameKey(getBaseName(name));
+    boost::optional<int> suffix = getNameSuffix(name);
+    auto iotnsmLoc = m_iddObjectTypeNameSeriesMap.find(type);
+    OS_ASSERT(iotnsmLoc != m_iddObjectTypeNameSeriesMap.end());
+    for (NameSeriesMap* nameSeriesMap : { &m_nameSeriesMap, &(iotnsmLoc->second) }) {
+      auto nsmLoc = nameSeriesMap->find(seriesKey);
+      OS_ASSERT(nsmLoc != nameSeriesMap->end());
+      NameSeries& series = nsmLoc->second;
+      series.objects.erase(handle);
+      if (suffix) {
+        auto sLoc = series.suffixes.find(*suffix);
+        OS_ASSERT(sLoc != series.suffixes.end());
+        if (--(sLoc->second) == 0) { series.suffixes.erase(sLoc); }
+      }
+      // erase entry if series is empty
+      if (series.objects.empty()) { nameSeriesMap->erase(nsmLoc); }
+    }
+    if (iotnsmLoc->second.empty()) { m_iddObjectTypeNameSeriesMap.erase(iotnsmLoc); }
+  }
+
+  void Workspace_Impl::updateNameMaps(const WorkspaceObject_Impl& object,
+                                      const boost::optional<std::string>& oldName)
+  {
+    // only objects that are in the workspace maps are indexed
+    Handle handle = object.handle();
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if ((womIt == m_workspaceObjectMap.end()) || (womIt->second.get() != &object)) {
+      return;
+    }
+
+    if (oldName) {
+      removeFromNameMaps(handle,object.iddObject().type(),*oldName);
+    }
+    insertIntoNameMaps(handle,womIt->second);
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2235,6 +2395,11 @@ namespace detail {
       }
     }
 
+    // NameMap and NameSeriesMaps
+    if (OptionalString name = objectImplPtr->name()) {
+      removeFromNameMaps(handle,objectImplPtr->iddObject().type(),*name);
+    }
+
     // IdfReferencesMap
     StringVector references = objectImplPtr->iddObject().references();
     for (const std::string& reference : references) {
@@ -2305,7 +2470,7 @@ namespace detail {
     connect(object.getImpl<WorkspaceObject_Impl>().get(), &WorkspaceObject_Impl::onChange, this, &Workspace_Impl::change);
     emit addWorkspaceObject(object, object.iddObject().type(), object.handle());
     emit addWorkspaceObject(object.getImpl<WorkspaceObject_Impl>(), object.iddObject().type(), object.handle());
-    emit onChange();
+    change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2323,6 +2488,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // NameMap and NameSeriesMaps
+    insertIntoNameMaps(savedObject.handle,savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2504,36 +2672,39 @@ namespace detail {
   // QUERIES
 
   std::string Workspace_Impl::constructNextName(const std::string& objectName,
-                                                const std::vector<WorkspaceObject>& objectsInTheSeries,
+                                                const NameSeriesMap& nameSeriesMap,
                                                 bool fillIn) const
   {
-    vector<int> takenValues;
-    for (const WorkspaceObject& object : objectsInTheSeries) {
-      if (boost::optional<int> takenSuffix = getNameSuffix(*(object.name()))) {
-        takenValues.push_back(*takenSuffix);
-      }
-    }
-    std::sort(takenValues.begin(), takenValues.end());
-    takenValues.erase(std::unique(takenValues.begin(), takenValues.end()), takenValues.end());
+    std::string baseName = getBaseName(objectName);
 
     int suffix(1);
-    if (fillIn) {
-      for (int usedSuffix : takenValues) {
-        if (usedSuffix == suffix) {
-          ++suffix;
+    auto loc = nameSeriesMap.find(nameKey(baseName));
+    if (loc != nameSeriesMap.end() && !loc->second.suffixes.empty()) {
+      // suffixes in use, in order
+      const std::map<int, unsigned>& takenValues = loc->second.suffixes;
+      int largest = takenValues.rbegin()->first;
+      if (fillIn) {
+        // suffixes are positive, so they are all taken up to largest only if there are largest of them
+        if (largest == static_cast<int>(takenValues.size())) {
+          suffix = largest + 1;
         }
         else {
-          break;
+          for (const std::pair<const int, unsigned>& usedSuffix : takenValues) {
+            if (usedSuffix.first == suffix) {
+              ++suffix;
+            }
+            else {
+              break;
+            }
+          }
         }
       }
-    }
-    else {
-      if (!takenValues.empty()) {
-        suffix = *(takenValues.rbegin()) + 1;
+      else {
+        suffix = largest + 1;
       }
     }
 
-    return getBaseName(objectName) + ' ' + boost::lexical_cast<std::string>(suffix);
+    return baseName + ' ' + boost::lexical_cast<std::string>(suffix);
   }
 
   std::vector< std::vector<WorkspaceObject> > Workspace_Impl::nameConflicts(
@@ -2605,9 +2776,64 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if ((m_batchEditDepth > 0) || m_endingBatchEdit) {
+      m_batchEditChanged = true;
+      return;
+    }
     emit onChange();
   }
 
+  void Workspace_Impl::beginBatchEdit() {
+    ++m_batchEditDepth;
+  }
+
+  void Workspace_Impl::endBatchEdit() {
+    OS_ASSERT(m_batchEditDepth > 0);
+    if (--m_batchEditDepth > 0) {
+      return;
+    }
+
+    // slots may edit the workspace further; those edits signal immediately, but the Workspace's
+    // own onChange is still only emitted once, at the end
+    m_endingBatchEdit = true;
+    std::vector<Handle> handles;
+    handles.swap(m_batchEditHandles);
+    m_batchEditHandleSet.clear();
+    try {
+      for (const Handle& handle : handles) {
+        // objects removed during the batch do not signal, as with changes made during removal
+        if (OptionalWorkspaceObject object = getObject(handle)) {
+          object->getImpl<WorkspaceObject_Impl>()->emitChangeSignals();
+        }
+      }
+    }
+    catch (...) {
+      m_endingBatchEdit = false;
+      m_batchEditChanged = false;
+      throw;
+    }
+    m_endingBatchEdit = false;
+
+    if (m_batchEditChanged) {
+      m_batchEditChanged = false;
+      emit onChange();
+    }
+  }
+
+  bool Workspace_Impl::isBatchEditing() const {
+    return (m_batchEditDepth > 0);
+  }
+
+  bool Workspace_Impl::deferChangeSignals(const Handle& handle) {
+    if (m_batchEditDepth == 0) {
+      return false;
+    }
+    if (m_batchEditHandleSet.insert(handle).second) {
+      m_batchEditHandles.push_back(handle);
+    }
+    return true;
+  }
+
   void Workspace_Impl::createAndAddClonedObjects(
       const std::shared_ptr<detail::Workspace_Impl>& thisImpl,
       std::shared_ptr<detail::Workspace_Impl> cloneImpl,
@@ -2998,6 +3224,33 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p,overwrite);
 }
 
+Workspace::BatchEdit::BatchEdit(const Workspace& workspace)
+  : m_impl(workspace.getImpl<detail::Workspace_Impl>())
+{
+  m_impl->beginBatchEdit();
+}
+
+Workspace::BatchEdit::~BatchEdit()
+{
+  try {
+    m_impl->endBatchEdit();
+  }
+  catch (const std::exception& e) {
+    LOG(Error,"Exception thrown while signaling the end of a batch edit: " << e.what());
+  }
+  catch (...) {
+    LOG(Error,"Unknown exception thrown while signaling the end of a batch edit.");
+  }
+}
+
+bool Workspace::isBatchEditing() const {
+  return m_impl->isBatchEditing();
+}
+
+QFuture<bool> Workspace::saveAsync(const openstudio::path& p, bool overwrite) {
+  return m_impl->saveAsync(p,overwrite);
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
@@ -3061,7 +3314,7 @@ void Workspace::addVersionObject() {
 
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace)
 {
-  os << workspace.toIdfFile();
+  workspace.getImpl<detail::Workspace_Impl>()->print(os);
   return os;
 }
 
@@ -27,6 +27,8 @@
 #include "../core/Logger.hpp"
 #include "../core/Path.hpp"
 
+#include <QFuture>
+
 #include <string>
 #include <ostream>
 #include <vector>
@@ -125,7 +127,11 @@ class UTILITIES_API Workspace {
    *
    *  If keepHandles, then new handles will not be assigned to the cloned objects. This feature
    *  should be used with care, as reuse of unique object identifiers could lead to changing data
-   *  in the wrong Workspace. */
+   *  in the wrong Workspace.
+   *
+   *  Object field values are shared between the two Workspaces until one of them modifies an 
+   *  object, at which point only that object's fields are copied. Since new handles are written 
+   *  to the handle field, objects with a handle field only share their fields if keepHandles. */
   Workspace clone(bool keepHandles=false) const;
 
   /** Clone just the objects referenced by handles into a new Workspace. All non-object data is
@@ -407,6 +413,12 @@ class UTILITIES_API Workspace {
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Save this Workspace to path p as save does, but return as soon as a clone that shares
+   *  field values with this Workspace has been made, leaving the clone to be printed and written
+   *  by a background thread. The future's result is the value save would have returned. Later
+   *  changes to this Workspace do not affect the file. */
+  QFuture<bool> saveAsync(const openstudio::path& p, bool overwrite=false);
+
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
    *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
@@ -444,6 +456,38 @@ class UTILITIES_API Workspace {
   // disconnect a progress bar
   bool disconnectProgressBar(const openstudio::ProgressBar &progressBar) const;
 
+  /** Holds back change notifications while in scope. Field changes made to an object during the
+   *  batch emit that object's onChange, onDataChange, onNameChange and onRelationshipChange
+   *  signals once, when the outermost BatchEdit is destroyed, and the Workspace's onChange is
+   *  emitted once after that. Additions and removals are still signaled as they happen, and
+   *  objects removed during the batch do not signal their field changes. Watchers therefore see
+   *  the same final state. WorkspaceObject_Impl::onImmediateChange is not held back, so data
+   *  objects cache from their own fields stays current inside the batch.
+   *
+   *  \code
+   *  {
+   *    Workspace::BatchEdit batchEdit(workspace);
+   *    for (WorkspaceObject& object : objects) { object.setString(1,"value"); }
+   *  } // signals are emitted here
+   *  \endcode */
+  class UTILITIES_API BatchEdit {
+   public:
+    explicit BatchEdit(const Workspace& workspace);
+
+    ~BatchEdit();
+
+   private:
+    BatchEdit(const BatchEdit& other);
+    BatchEdit& operator=(const BatchEdit& other);
+
+    std::shared_ptr<detail::Workspace_Impl> m_impl;
+
+    REGISTER_LOGGER("utilities.idf.Workspace.BatchEdit");
+  };
+
+  /** Returns true if a BatchEdit is in scope for this Workspace. */
+  bool isBatchEditing() const;
+
   //@}
   /** @name Type Casing */
   //@{
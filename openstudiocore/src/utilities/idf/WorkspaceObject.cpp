@@ -78,7 +78,13 @@ namespace detail {
     m_workspace(workspace),
     m_sourceData(other.m_sourceData),
     m_targetData(other.m_targetData)
-  {}
+  {
+    if (m_targetData) {
+      // the sources belong to other's workspace, index this object's sources once they are known
+      m_targetData->sourcesByType.clear();
+      m_targetData->sourcesIndexed = false;
+    }
+  }
 
   WorkspaceObject_Impl::~WorkspaceObject_Impl() {}
 
@@ -151,7 +157,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
@@ -171,6 +177,8 @@ namespace detail {
         }
       }
       m_targetData->reversePointers = mappedPointers;
+      m_targetData->sourcesByType.clear();
+      m_targetData->sourcesIndexed = false;
     }
   }
 
@@ -266,14 +274,16 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+      if (!m_targetData->sourcesIndexed) { indexSources(); }
+      // each source appears once, but the buckets have to be merged
+      for (const auto& bucket : m_targetData->sourcesByType) {
+        for (const auto& source : bucket.second) {
+          std::shared_ptr<WorkspaceObject_Impl> impl = source.second.source.lock();
+          OS_ASSERT(impl);
+          result.push_back(WorkspaceObject(impl));
+        }
       }
       std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -282,14 +292,17 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) { result.push_back(*owo); }
+      if (!m_targetData->sourcesIndexed) { indexSources(); }
+      auto it = m_targetData->sourcesByType.find(type.value());
+      if (it != m_targetData->sourcesByType.end()) {
+        // already unique and in order
+        result.reserve(it->second.size());
+        for (const auto& source : it->second) {
+          std::shared_ptr<WorkspaceObject_Impl> impl = source.second.source.lock();
+          OS_ASSERT(impl);
+          result.push_back(WorkspaceObject(impl));
+        }
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -830,7 +843,7 @@ namespace detail {
     IdfObject_ImplPtr result(new IdfObject_Impl(m_handle,
                                                 m_comment,
                                                 m_iddObject,
-                                                m_fields,
+                                                m_fields.get(),
                                                 m_fieldComments));
     // add name references based on WorkspaceObject's pointer data
     if (m_sourceData) {
@@ -868,7 +881,7 @@ namespace detail {
     IdfObject_ImplPtr result(new IdfObject_Impl(m_handle,
                                                 m_comment,
                                                 m_iddObject,
-                                                m_fields,
+                                                m_fields.get(),
                                                 m_fieldComments));
     // add name references based on WorkspaceObject's pointer data
     if (m_sourceData) {
@@ -889,6 +902,73 @@ namespace detail {
     return result;
   }
 
+  std::ostream& WorkspaceObject_Impl::printIdf(std::ostream& os) {
+    if (!initialized()) {
+      LOG_AND_THROW("Attempt to write a disconnected WorkspaceObject out to Idf.");
+    }
+
+    // number of fields idfObject() would have, see IdfObject_Impl::resizeToMinFields
+    unsigned n = numFields();
+    unsigned min_n = m_iddObject.numFieldsInDefaultObject();
+    if (n < min_n) {
+      n = min_n;
+    }
+    if (m_iddObject.properties().extensible) {
+      int nExtFields = n - m_iddObject.numFields();
+      if (nExtFields > 0) {
+        int nToAdd = nExtFields % m_iddObject.properties().numExtensible;
+        n += nToAdd;
+      }
+    }
+
+    printName(os,n > 0);
+
+    bool serializeHandle = m_iddObject.hasHandleField();
+    ForwardPointerSet::const_iterator ptrIt, ptrEnd;
+    if (m_sourceData) {
+      ptrIt = m_sourceData->pointers.begin();
+      ptrEnd = m_sourceData->pointers.end();
+    }
+
+    const std::string empty;
+    std::string targetString;
+    for (unsigned i = 0; i < n; ++i) {
+      const std::string* value = (i < m_fields.size()) ? &m_fields[i] : &empty;
+
+      // replace pointers with handles or names, as in idfObjectImplPtr
+      if (m_sourceData) {
+        while ((ptrIt != ptrEnd) && (ptrIt->fieldIndex < i)) {
+          ++ptrIt;
+        }
+        if ((ptrIt != ptrEnd) && (ptrIt->fieldIndex == i) && !ptrIt->targetHandle.isNull()) {
+          if (serializeHandle) {
+            targetString = toString(ptrIt->targetHandle);
+          }
+          else {
+            OptionalString targetName = m_workspace->name(ptrIt->targetHandle);
+            OS_ASSERT(targetName);
+            if (targetName->empty()) {
+              // give target a name
+              OptionalWorkspaceObject target = m_workspace->getObject(ptrIt->targetHandle);
+              OS_ASSERT(target);
+              target->createName(false);
+              targetName = target->name();
+              OS_ASSERT(targetName);
+            }
+            targetString = *targetName;
+          }
+          value = &targetString;
+        }
+      }
+
+      printFieldValue(os,i,*value,i + 1 == n);
+    }
+
+    os << '\n';
+
+    return os;
+  }
+
   /** Returns equivalent IdfObject, naming targets if necessary. All data is cloned. */
   IdfObject WorkspaceObject_Impl::idfObject()
   {
@@ -907,6 +987,13 @@ namespace detail {
       return;
     }
 
+    emit onImmediateChange();
+
+    // during a batch edit, diffs accumulate and are signaled together when the batch ends
+    if (initialized() && m_workspace->deferChangeSignals(m_handle)){
+      return;
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -979,7 +1066,7 @@ namespace detail {
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle,index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(*this,index);
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(),index,target);
     }
@@ -993,27 +1080,48 @@ namespace detail {
     OS_ASSERT(insertResult.second);
   }
 
-  // Pre-condition:  Object sourceHandle points to this object from field index.
+  // Pre-condition:  Object source points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle,unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const WorkspaceObject_Impl& source,unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle,index));
+    auto it = m_targetData->reversePointers.find(ReversePointer(source.handle(),index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
+
+    if (m_targetData->sourcesIndexed) {
+      auto bucketIt = m_targetData->sourcesByType.find(source.iddObject().type().value());
+      OS_ASSERT(bucketIt != m_targetData->sourcesByType.end());
+      auto sourceIt = bucketIt->second.find(&source);
+      OS_ASSERT(sourceIt != bucketIt->second.end());
+      if (--(sourceIt->second.numPointers) == 0) {
+        bucketIt->second.erase(sourceIt);
+        if (bucketIt->second.empty()) {
+          m_targetData->sourcesByType.erase(bucketIt);
+        }
+      }
+    }
   }
 
-  // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
-  // Post-condition: m_targetData indicates that object sourceHandle points to this object from
+  // Pre-condition:  ReversePointer(source.handle(),index) is not in m_targetData.
+  // Post-condition: m_targetData indicates that object source points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) { m_targetData = TargetData(); }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(source.handle(),index));
     OS_ASSERT(insertResult.second);
+
+    if (m_targetData->sourcesIndexed) {
+      ReversePointerSource& entry = m_targetData->sourcesByType[source.iddObject().type().value()][&source];
+      if (entry.numPointers == 0) {
+        entry.source = std::static_pointer_cast<WorkspaceObject_Impl>(source.shared_from_this());
+      }
+      ++entry.numPointers;
+    }
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1026,7 +1134,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(),h.end(),m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,ptr.fieldIndex);
             }
           }
         }
@@ -1049,6 +1157,21 @@ namespace detail {
 
   // PRIVATE
 
+  void WorkspaceObject_Impl::indexSources() const {
+    OS_ASSERT(m_targetData);
+    m_targetData->sourcesByType.clear();
+    for (const ReversePointer& ptr : m_targetData->reversePointers) {
+      OS_ASSERT(!ptr.sourceHandle.isNull());
+      OptionalWorkspaceObject owo = m_workspace->getObject(ptr.sourceHandle);
+      OS_ASSERT(owo);
+      std::shared_ptr<WorkspaceObject_Impl> source = owo->getImpl<WorkspaceObject_Impl>();
+      ReversePointerSource& entry = m_targetData->sourcesByType[owo->iddObject().type().value()][source.get()];
+      entry.source = source;
+      ++entry.numPointers;
+    }
+    m_targetData->sourcesIndexed = true;
+  }
+
   // SETTERS
 
   // Pre-condition:  targetHandle is null or in m_workspace. index is an object-list field.
@@ -1081,7 +1204,7 @@ namespace detail {
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle,index,targetHandle);
     }
@@ -1133,10 +1256,15 @@ namespace detail {
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
       m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
+      std::string oldValue = m_fields.back();
       m_fields.pop_back();
+      trimFieldValues();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
       }
+      if (iddObject().hasNameField() && (index == iddObject().nameFieldIndex())) {
+        nameChanged(oldValue);
+      }
     } else {
       return false;
     }
@@ -1247,6 +1375,14 @@ namespace detail {
     return result;
   }
 
+  // SETTER HELPERS
+
+  void WorkspaceObject_Impl::nameChanged(const boost::optional<std::string>& oldName) {
+    if (m_workspace && !m_handle.isNull()) {
+      m_workspace->updateNameMaps(*this,oldName);
+    }
+  }
+
   struct WorkspaceObjectMetaTypeInitializer
   {
     WorkspaceObjectMetaTypeInitializer()
@@ -27,6 +27,9 @@
 
 #include <QObject>
 
+#include <map>
+#include <memory>
+
 namespace openstudio {
 
 // forward declarations
@@ -77,11 +80,31 @@ namespace detail {
   };
   typedef std::set<ReversePointer,ReversePointerLess > ReversePointerSet;
 
+  class WorkspaceObject_Impl; // forward declaration
+
+  /** An object that points to a target, and the number of its fields that do so. */
+  struct UTILITIES_API ReversePointerSource {
+    std::weak_ptr<WorkspaceObject_Impl> source;
+    unsigned numPointers;
+
+    ReversePointerSource() : numPointers(0) {}
+  };
+  /** Sources of one IddObjectType, ordered by address as WorkspaceObject::operator< orders them. */
+  typedef std::map<const WorkspaceObject_Impl*, ReversePointerSource> ReversePointerSourceMap;
+
   struct UTILITIES_API TargetData {
     typedef ReversePointer    pointer_type;
     typedef ReversePointerSet pointer_set;
 
     pointer_set reversePointers;
+
+    /** The sources of reversePointers, bucketed by IddObjectType::value(). Kept in sync with
+     *  reversePointers while sourcesIndexed is true, and rebuilt from it on first use after
+     *  reversePointers is copied or remapped. */
+    mutable std::map<int, ReversePointerSourceMap> sourcesByType;
+    mutable bool sourcesIndexed;
+
+    TargetData() : sourcesIndexed(true) {}
   };
   typedef boost::optional<TargetData> OptionalTargetData;
 
@@ -269,6 +292,10 @@ namespace detail {
     /** Returns equivalent IdfObject, leaving unnamed target objects unnamed. All data is cloned. */
     IdfObject idfObject() const;
 
+    /** Prints the same text as idfObject().print(os), naming targets if necessary, but resolves
+     *  pointers as it goes rather than cloning the object. */
+    std::ostream& printIdf(std::ostream& os);
+
     //@}
     /** @name Signal Helpers */
     //@{
@@ -280,6 +307,11 @@ namespace detail {
 
    signals:
 
+    /** Emitted each time this object's fields change, including inside a Workspace batch edit,
+     *  where onChange and the other change signals are held back until the batch ends. Connect
+     *  to this signal to clear data cached from the object; other listeners should use onChange. */
+    void onImmediateChange() const;
+
     /** Emitted when a pointer field is changed. */
     void onRelationshipChange(int index, Handle newHandle, Handle oldHandle) const;
 
@@ -300,10 +332,10 @@ namespace detail {
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index);
 
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    void setReversePointer(WorkspaceObject_Impl& source, unsigned index);
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -325,6 +357,11 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    // SETTER HELPERS
+
+    /** Keeps the Workspace's name indices up to date. */
+    virtual void nameChanged(const boost::optional<std::string>& oldName);
+
    private:
 
     bool                m_initialized;
@@ -334,6 +371,9 @@ namespace detail {
 
     // SETTER HELPERS
 
+    /** Rebuilds m_targetData's source index from its reverse pointers. */
+    void indexSources() const;
+
     /** Sets pointer at field index to targetHandle, and returns old target. */
     Handle setPointerImpl(unsigned index, const Handle& targetHandle);
 
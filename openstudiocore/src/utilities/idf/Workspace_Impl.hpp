@@ -32,12 +32,15 @@
 #include <utilities/core/Logger.hpp>
 
 #include <QObject>
+#include <QFuture>
 
 #include <string>
 #include <ostream>
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -338,6 +341,10 @@ namespace detail {
                                    unsigned index,
                                    const WorkspaceObject& targetObject);
 
+    /** Update the name indices after the name of object has changed from oldName. Called by
+     *  WorkspaceObject_Impl. */
+    void updateNameMaps(const WorkspaceObject_Impl& object, const boost::optional<std::string>& oldName);
+
     /** Setting fast naming to true reduces the time taken to create names by using a UUID as the name.
      *   This UUID is not the same as the object's handle.
      */
@@ -422,6 +429,14 @@ namespace detail {
      *  .idf or modelFileExtension() depending on the underlying IddFileType. */
     virtual bool save(const openstudio::path& p, bool overwrite=false);
 
+    /** Saves as save(p,overwrite) does, but only names pointer targets and clones the Workspace 
+     *  on the calling thread. Printing the clone to disk is left to a background thread. */
+    QFuture<bool> saveAsync(const openstudio::path& p, bool overwrite=false);
+
+    /** Prints the same text as toIdfFile().print(os), naming objects if necessary, without
+     *  constructing the intermediate IdfFile. */
+    std::ostream& print(std::ostream& os);
+
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
@@ -431,6 +446,23 @@ namespace detail {
      const openstudio::path &t_infile, const openstudio::path &t_locationForRemoteUrls = openstudio::path());
 
     //@}
+    /** @name Batch Editing */
+    //@{
+
+    /** Starts (or nests) a batch edit, see Workspace::BatchEdit. */
+    void beginBatchEdit();
+
+    /** Ends a batch edit. Once the outermost batch edit ends, each object changed during the
+     *  batch emits its change signals once, followed by a single onChange for the Workspace. */
+    void endBatchEdit();
+
+    bool isBatchEditing() const;
+
+    /** Called by an object whose change signals are due. Returns true, and remembers the object,
+     *  if the signals should be held back until the batch edit ends. */
+    bool deferChangeSignals(const Handle& handle);
+
+    //@}
 
    signals:
 
@@ -485,7 +517,17 @@ namespace detail {
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
 
-    typedef std::map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
+    // batch edit state: nesting depth, objects with held back change signals (in the order they
+    // were first changed), and whether onChange is due
+    unsigned m_batchEditDepth;
+    std::vector<Handle> m_batchEditHandles;
+    std::unordered_set<Handle, UUIDHash> m_batchEditHandleSet;
+    bool m_batchEditChanged;
+    bool m_endingBatchEdit;
+
+    // hashed on the UUID bits, so iteration order is arbitrary; objects(true) and handles(true)
+    // provide a deterministic order
+    typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, UUIDHash> WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
     // object for ordering objects in the collection.
@@ -499,6 +541,23 @@ namespace detail {
     typedef std::map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // map of upper-cased name (see istringEqual) to set of objects identified by UUID
+    typedef std::unordered_map<std::string, WorkspaceObjectMap> NameMap;
+    NameMap m_nameMap;
+
+    // objects whose names share a base name (name without an integer suffix), and the number of
+    // objects using each suffix, so nextName does not have to look at the objects themselves
+    struct NameSeries {
+      WorkspaceObjectMap objects;
+      std::map<int, unsigned> suffixes;
+    };
+
+    // map of upper-cased base name to name series, over all objects and by IddObjectType
+    typedef std::unordered_map<std::string, NameSeries> NameSeriesMap;
+    NameSeriesMap m_nameSeriesMap;
+    typedef std::map<IddObjectType, NameSeriesMap> IddObjectTypeNameSeriesMap;
+    IddObjectTypeNameSeriesMap m_iddObjectTypeNameSeriesMap;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
@@ -539,6 +598,14 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameMaps(const Handle& handle, const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void insertIntoNameMaps(const Handle& handle,
+                            const std::shared_ptr<WorkspaceObject_Impl>& object,
+                            const std::string& name);
+
+    void removeFromNameMaps(const Handle& handle, IddObjectType type, const std::string& name);
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other,
                                        const std::vector<unsigned>& toIgnore);
@@ -578,9 +645,10 @@ namespace detail {
 
     // QUERIES
 
-    /** Returns name with the next available integer suffix. */
+    /** Returns name with the next available integer suffix, given the name series in
+     *  nameSeriesMap that objectName belongs to. */
     std::string constructNextName(const std::string& objectName,
-                                  const std::vector<WorkspaceObject>& objectsInTheSeries,
+                                  const NameSeriesMap& nameSeriesMap,
                                   bool fillIn) const;
 
     std::vector< std::vector<WorkspaceObject> > nameConflicts(
@@ -0,0 +1,239 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "ColumnarSqlFile.hpp"
+#include "ColumnarSqlFile_Impl.hpp"
+#include "SqlFile.hpp"
+
+namespace openstudio{
+
+ColumnarSqlFile::ColumnarSqlFile()
+{}
+
+ColumnarSqlFile::ColumnarSqlFile(const openstudio::path& path)
+{
+  try{
+    m_impl = std::shared_ptr<detail::ColumnarSqlFile_Impl>(new detail::ColumnarSqlFile_Impl(path));
+  }catch(const std::exception& e){
+    LOG(Error, "Could not create ColumnarSqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
+  }
+}
+
+ColumnarSqlFile::~ColumnarSqlFile()
+{}
+
+bool ColumnarSqlFile::convert(SqlFile& sqlFile, const openstudio::path& path)
+{
+  return detail::ColumnarSqlFile_Impl::convert(sqlFile, path);
+}
+
+bool ColumnarSqlFile::connectionOpen() const
+{
+  return bool(m_impl);
+}
+
+openstudio::path ColumnarSqlFile::path() const
+{
+  openstudio::path result;
+  if (m_impl){
+    result = m_impl->path();
+  }
+  return result;
+}
+
+boost::optional<std::string> ColumnarSqlFile::tabularDataValue(const std::string& reportName,
+                                                               const std::string& reportForString,
+                                                               const boost::optional<std::string>& tableName,
+                                                               const std::string& rowName,
+                                                               const boost::optional<std::string>& columnName,
+                                                               const std::string& units) const
+{
+  boost::optional<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::tabularDataDouble(const std::string& reportName,
+                                                           const std::string& reportForString,
+                                                           const boost::optional<std::string>& tableName,
+                                                           const std::string& rowName,
+                                                           const boost::optional<std::string>& columnName,
+                                                           const std::string& units) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->tabularDataDouble(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::hoursSimulated() const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->hoursSimulated();
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::netSiteEnergy() const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->netSiteEnergy();
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::netSourceEnergy() const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->netSourceEnergy();
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::totalSiteEnergy() const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->totalSiteEnergy();
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::totalSourceEnergy() const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->totalSourceEnergy();
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::energyConsumptionByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                                  const openstudio::EndUseCategoryType& t_categoryType,
+                                                                  const openstudio::MonthOfYear& t_monthOfYear) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->energyConsumptionByMonth(t_fuelType, t_categoryType, t_monthOfYear);
+  }
+  return result;
+}
+
+boost::optional<double> ColumnarSqlFile::peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                                 const openstudio::EndUseCategoryType& t_categoryType,
+                                                                 const openstudio::MonthOfYear& t_monthOfYear) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->peakEnergyDemandByMonth(t_fuelType, t_categoryType, t_monthOfYear);
+  }
+  return result;
+}
+
+boost::optional<openstudio::EnvironmentType> ColumnarSqlFile::environmentType(const std::string& envPeriod) const
+{
+  boost::optional<openstudio::EnvironmentType> result;
+  if (m_impl){
+    result = m_impl->environmentType(envPeriod);
+  }
+  return result;
+}
+
+std::vector<std::string> ColumnarSqlFile::availableEnvPeriods() const
+{
+  std::vector<std::string> result;
+  if (m_impl){
+    result = m_impl->availableEnvPeriods();
+  }
+  return result;
+}
+
+std::vector<std::string> ColumnarSqlFile::availableReportingFrequencies(const std::string& envPeriod) const
+{
+  std::vector<std::string> result;
+  if (m_impl){
+    result = m_impl->availableReportingFrequencies(envPeriod);
+  }
+  return result;
+}
+
+std::vector<std::string> ColumnarSqlFile::availableVariableNames(const std::string& envPeriod,
+                                                                 const std::string& reportingFrequency) const
+{
+  std::vector<std::string> result;
+  if (m_impl){
+    result = m_impl->availableVariableNames(envPeriod, reportingFrequency);
+  }
+  return result;
+}
+
+std::vector<std::string> ColumnarSqlFile::availableKeyValues(const std::string& envPeriod,
+                                                             const std::string& reportingFrequency,
+                                                             const std::string& timeSeriesName) const
+{
+  std::vector<std::string> result;
+  if (m_impl){
+    result = m_impl->availableKeyValues(envPeriod, reportingFrequency, timeSeriesName);
+  }
+  return result;
+}
+
+std::vector<TimeSeries> ColumnarSqlFile::timeSeries(const std::string& envPeriod,
+                                                    const std::string& reportingFrequency,
+                                                    const std::string& timeSeriesName) const
+{
+  std::vector<TimeSeries> result;
+  if (m_impl){
+    result = m_impl->timeSeries(envPeriod, reportingFrequency, timeSeriesName);
+  }
+  return result;
+}
+
+boost::optional<TimeSeries> ColumnarSqlFile::timeSeries(const std::string& envPeriod,
+                                                        const std::string& reportingFrequency,
+                                                        const std::string& timeSeriesName,
+                                                        const std::string& keyValue) const
+{
+  boost::optional<TimeSeries> result;
+  if (m_impl){
+    result = m_impl->timeSeries(envPeriod, reportingFrequency, timeSeriesName, keyValue);
+  }
+  return result;
+}
+
+const double* ColumnarSqlFile::timeSeriesValues(const std::string& envPeriod,
+                                                const std::string& reportingFrequency,
+                                                const std::string& timeSeriesName,
+                                                const std::string& keyValue,
+                                                std::size_t& numValues) const
+{
+  if (m_impl){
+    return m_impl->timeSeriesValues(envPeriod, reportingFrequency, timeSeriesName, keyValue, numValues);
+  }
+  numValues = 0;
+  return nullptr;
+}
+
+} // openstudio
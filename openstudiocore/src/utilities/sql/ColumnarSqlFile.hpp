@@ -0,0 +1,191 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_SQL_COLUMNARSQLFILE_HPP
+#define UTILITIES_SQL_COLUMNARSQLFILE_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "SqlFileEnums.hpp"
+
+#include "../data/DataEnums.hpp"
+#include "../data/TimeSeries.hpp"
+#include "../time/Date.hpp"
+
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+// forward declarations
+class SqlFile;
+
+namespace detail {
+  class ColumnarSqlFile_Impl;
+}
+
+/** ColumnarSqlFile reads EnergyPlus results from a compact, memory-mapped file written by convert.
+ *  The data dictionary is stored as a sorted index, each time series' values as one contiguous block
+ *  of doubles, and the time axes shared by many time series only once. Opening a file only maps it
+ *  into memory and checks its header, nothing is parsed or copied until it is queried, which makes
+ *  this a fast alternative to SqlFile when many results have to be read. Records are checked as
+ *  they are read, a query that reaches a record pointing outside of the file throws.
+ *
+ *  The queries mirror the ones of SqlFile and return the same results. Files are written in the
+ *  byte order of the machine that converts them and are rejected on machines with a different one. */
+class UTILITIES_API ColumnarSqlFile {
+ public:
+
+  /** @name Constructors */
+  //@{
+
+  /// default constructor
+  ColumnarSqlFile();
+
+  /// constructor from path, connectionOpen returns false if the file could not be opened
+  explicit ColumnarSqlFile(const openstudio::path& path);
+
+  // virtual destructor
+  virtual ~ColumnarSqlFile();
+
+  /** Writes the time series, data dictionary and tabular data of sqlFile to path, overwriting any
+   *  existing file. Returns false if sqlFile is not open or path could not be written. */
+  static bool convert(SqlFile& sqlFile, const openstudio::path& path);
+
+  //@}
+  /** @name File Queries */
+  //@{
+
+  /// returns whether or not the file is open
+  bool connectionOpen() const;
+
+  /// get the path
+  openstudio::path path() const;
+
+  //@}
+  /** @name Tabular Data */
+  //@{
+
+  /** Returns the Value of the first row of TabularDataWithStrings matching all of the arguments,
+   *  any table or column matches if tableName or columnName is not set. As in sql, a NULL column
+   *  matches no argument and a NULL Value is returned as missing. */
+  boost::optional<std::string> tabularDataValue(const std::string& reportName,
+                                                const std::string& reportForString,
+                                                const boost::optional<std::string>& tableName,
+                                                const std::string& rowName,
+                                                const boost::optional<std::string>& columnName,
+                                                const std::string& units) const;
+
+  /** Returns tabularDataValue converted to a double, as sqlite converts text. */
+  boost::optional<double> tabularDataDouble(const std::string& reportName,
+                                            const std::string& reportForString,
+                                            const boost::optional<std::string>& tableName,
+                                            const std::string& rowName,
+                                            const boost::optional<std::string>& columnName,
+                                            const std::string& units) const;
+
+  /// hours simulated, from tabular data only
+  boost::optional<double> hoursSimulated() const;
+
+  /// net site energy in GJ
+  boost::optional<double> netSiteEnergy() const;
+
+  /// net source energy in GJ
+  boost::optional<double> netSourceEnergy() const;
+
+  /// total site energy in GJ
+  boost::optional<double> totalSiteEnergy() const;
+
+  /// total source energy in GJ
+  boost::optional<double> totalSourceEnergy() const;
+
+  /// Returns the energy consumption for the given fuel type, category and month, in J
+  boost::optional<double> energyConsumptionByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                   const openstudio::EndUseCategoryType& t_categoryType,
+                                                   const openstudio::MonthOfYear& t_monthOfYear) const;
+
+  /// Returns the peak demand for the given fuel type, category and month, in W
+  boost::optional<double> peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                  const openstudio::EndUseCategoryType& t_categoryType,
+                                                  const openstudio::MonthOfYear& t_monthOfYear) const;
+
+  //@}
+  /** @name Generic TimeSeries Interface */
+  //@{
+
+  // get the type of environment period
+  boost::optional<openstudio::EnvironmentType> environmentType(const std::string& envPeriod) const;
+
+  // return a vector of all the available environment periods
+  std::vector<std::string> availableEnvPeriods() const;
+
+  // return a vector of all the available reporting frequencies for a given environment period
+  std::vector<std::string> availableReportingFrequencies(const std::string& envPeriod) const;
+
+  // return a vector of all the available variableName for environment period and reporting frequency
+  std::vector<std::string> availableVariableNames(const std::string& envPeriod,
+                                                  const std::string& reportingFrequency) const;
+
+  // return a vector of all keyValues matching name, envPeriod, and reportingFrequency
+  std::vector<std::string> availableKeyValues(const std::string& envPeriod,
+                                              const std::string& reportingFrequency,
+                                              const std::string& timeSeriesName) const;
+
+  // return a vector of all timeseries matching name, envPeriod, and reportingFrequency
+  std::vector<TimeSeries> timeSeries(const std::string& envPeriod,
+                                     const std::string& reportingFrequency,
+                                     const std::string& timeSeriesName) const;
+
+  // return a single timeseries matching name, keyValue, envPeriod, and reportingFrequency
+  boost::optional<TimeSeries> timeSeries(const std::string& envPeriod,
+                                         const std::string& reportingFrequency,
+                                         const std::string& timeSeriesName,
+                                         const std::string& keyValue) const;
+
+  /** Returns a pointer to the values of the time series matching name, keyValue, envPeriod, and
+   *  reportingFrequency inside the mapped file and sets numValues to their number, or returns a
+   *  null pointer if there is no such time series. Nothing is copied, the pointer stays valid as
+   *  long as this object or a copy of it exists. */
+  const double* timeSeriesValues(const std::string& envPeriod,
+                                 const std::string& reportingFrequency,
+                                 const std::string& timeSeriesName,
+                                 const std::string& keyValue,
+                                 std::size_t& numValues) const;
+
+  //@}
+
+private:
+
+  REGISTER_LOGGER("openstudio.sql.ColumnarSqlFile");
+
+  std::shared_ptr<detail::ColumnarSqlFile_Impl> m_impl;
+
+};
+
+/// optional ColumnarSqlFile
+typedef boost::optional<ColumnarSqlFile> OptionalColumnarSqlFile;
+
+} // openstudio
+
+#endif // UTILITIES_SQL_COLUMNARSQLFILE_HPP
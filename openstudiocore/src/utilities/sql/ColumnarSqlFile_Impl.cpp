@@ -0,0 +1,774 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include "ColumnarSqlFile_Impl.hpp"
+#include "SqlFile.hpp"
+#include "SqlFile_Impl.hpp"
+
+#include "../time/DateTime.hpp"
+#include "../core/Assert.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <map>
+
+namespace openstudio{
+
+  namespace detail{
+
+    static_assert(sizeof(ColumnarStringRef) == 16, "unexpected size of ColumnarStringRef");
+    static_assert(sizeof(ColumnarHeader) == 112, "unexpected size of ColumnarHeader");
+    static_assert(sizeof(ColumnarEnvPeriod) == 24, "unexpected size of ColumnarEnvPeriod");
+    static_assert(sizeof(ColumnarTimeAxis) == 40, "unexpected size of ColumnarTimeAxis");
+    static_assert(sizeof(ColumnarSeries) == 88, "unexpected size of ColumnarSeries");
+    static_assert(sizeof(ColumnarTabularRow) == 120, "unexpected size of ColumnarTabularRow");
+
+    namespace {
+
+      const char columnarMagic[8] = {'O', 'S', 'C', 'O', 'L', 'S', 'Q', 'L'};
+      const std::uint32_t columnarVersion = 2;
+      const std::uint32_t columnarByteOrderMark = 0x01020304;
+
+      // separates the columns of a tabular row read from the sql file
+      const char tabularSeparator = '\x1f';
+
+      // string offset of a NULL tabular column
+      const std::uint64_t nullStringOffset = std::numeric_limits<std::uint64_t>::max();
+
+      const unsigned numTabularColumns = 7;
+
+      // stores each distinct string once
+      class StringPoolBuilder
+      {
+      public:
+
+        ColumnarStringRef add(const std::string& str)
+        {
+          std::map<std::string, ColumnarStringRef>::const_iterator it = m_refs.find(str);
+          if (it != m_refs.end()){
+            return it->second;
+          }
+          ColumnarStringRef ref;
+          ref.offset = m_pool.size();
+          ref.size = str.size();
+          m_pool.append(str);
+          m_refs.insert(std::make_pair(str, ref));
+          return ref;
+        }
+
+        const std::string& pool() const
+        {
+          return m_pool;
+        }
+
+      private:
+
+        std::map<std::string, ColumnarStringRef> m_refs;
+        std::string m_pool;
+      };
+
+      // appends size bytes at source to data, which is padded to a multiple of 8 bytes, and returns
+      // the offset of the first byte
+      std::uint64_t appendData(std::vector<std::uint64_t>& data, const void* source, std::size_t size)
+      {
+        std::uint64_t offset = data.size() * sizeof(std::uint64_t);
+        if (size > 0){
+          data.resize(data.size() + (size + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+          std::memcpy(reinterpret_cast<char*>(&data[0]) + offset, source, size);
+        }
+        return offset;
+      }
+
+      template<typename T>
+      void writeRecords(std::ostream& os, const std::vector<T>& records)
+      {
+        if (!records.empty()){
+          os.write(reinterpret_cast<const char*>(&records[0]), records.size() * sizeof(T));
+        }
+      }
+
+      struct TabularRowStrings
+      {
+        std::vector<std::string> columns;
+        std::vector<bool> nulls;
+        std::uint64_t rowIndex;
+
+        // report name, report for string and row name are the search key
+        bool operator<(const TabularRowStrings& other) const
+        {
+          for (unsigned i = 0; i < 3; ++i){
+            int result = columns[i].compare(other.columns[i]);
+            if (result != 0){
+              return result < 0;
+            }
+          }
+          return rowIndex < other.rowIndex;
+        }
+      };
+
+    }
+
+    ColumnarSqlFile_Impl::ColumnarSqlFile_Impl(const openstudio::path& path)
+      : m_path(path), m_file(toQString(path)), m_data(nullptr), m_size(0), m_header(nullptr),
+        m_envPeriods(nullptr), m_timeAxes(nullptr), m_series(nullptr), m_tabularRows(nullptr), m_strings(nullptr)
+    {
+      if (!m_file.open(QIODevice::ReadOnly)){
+        LOG_AND_THROW("Could not open '" << toString(path) << "'");
+      }
+
+      m_size = static_cast<std::uint64_t>(m_file.size());
+      if (m_size < sizeof(ColumnarHeader)){
+        LOG_AND_THROW("'" << toString(path) << "' is not a columnar sql file");
+      }
+
+      uchar* data = m_file.map(0, m_file.size());
+      if (!data){
+        LOG_AND_THROW("Could not map '" << toString(path) << "' into memory");
+      }
+      m_data = reinterpret_cast<const char*>(data);
+      m_header = reinterpret_cast<const ColumnarHeader*>(m_data);
+
+      checkLayout();
+
+      m_envPeriods = reinterpret_cast<const ColumnarEnvPeriod*>(m_data + m_header->envPeriodsOffset);
+      m_timeAxes = reinterpret_cast<const ColumnarTimeAxis*>(m_data + m_header->timeAxesOffset);
+      m_series = reinterpret_cast<const ColumnarSeries*>(m_data + m_header->seriesOffset);
+      m_tabularRows = reinterpret_cast<const ColumnarTabularRow*>(m_data + m_header->tabularRowsOffset);
+      m_strings = m_data + m_header->stringsOffset;
+    }
+
+    ColumnarSqlFile_Impl::~ColumnarSqlFile_Impl()
+    {
+      // closing the file unmaps it
+      m_file.close();
+    }
+
+    bool ColumnarSqlFile_Impl::convert(SqlFile& sqlFile, const openstudio::path& path)
+    {
+      if (!sqlFile.m_impl || !sqlFile.connectionOpen()){
+        LOG(Error, "Cannot convert SqlFile that is not open to '" << toString(path) << "'");
+        return false;
+      }
+
+      // read all time series at once, in the order of the index
+      DataDictionaryTable dataDictionary = sqlFile.m_impl->dataDictionary();
+      const DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type& index = dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+      std::vector<DataDictionaryItem> items(index.begin(), index.end());
+      std::vector<boost::optional<TimeSeries> > results = sqlFile.m_impl->timeSeries(items);
+      OS_ASSERT(results.size() == items.size());
+
+      StringPoolBuilder strings;
+      std::vector<std::uint64_t> data;
+      std::vector<ColumnarEnvPeriod> envPeriods;
+      std::vector<ColumnarTimeAxis> timeAxes;
+      std::vector<ColumnarSeries> series;
+
+      // every environment period is kept, whether or not it has time series, with the names in
+      // upper case as in the data dictionary
+      std::vector<std::string> envPeriodNames;
+      if (boost::optional<std::vector<std::string> > names = sqlFile.execAndReturnVectorOfString("SELECT ifnull(EnvironmentName, '') FROM EnvironmentPeriods")){
+        for (const std::string& name : *names){
+          envPeriodNames.push_back(boost::to_upper_copy(name));
+        }
+      }
+      std::sort(envPeriodNames.begin(), envPeriodNames.end());
+      envPeriodNames.erase(std::unique(envPeriodNames.begin(), envPeriodNames.end()), envPeriodNames.end());
+
+      std::map<std::string, unsigned> envPeriodIndices;
+      for (const std::string& name : envPeriodNames){
+        ColumnarEnvPeriod envPeriod = ColumnarEnvPeriod();
+        envPeriod.name = strings.add(name);
+        boost::optional<EnvironmentType> environmentType = sqlFile.environmentType(name);
+        envPeriod.environmentType = environmentType ? environmentType->value() : -1;
+        envPeriodIndices.insert(std::make_pair(name, envPeriods.size()));
+        envPeriods.push_back(envPeriod);
+      }
+
+      // time series that report at the same times share one time axis
+      std::map<std::vector<long long>, unsigned> timeAxisIndices;
+
+      for (unsigned i = 0; i < items.size(); ++i){
+        if (!results[i]){
+          continue;
+        }
+        const DataDictionaryItem& item = items[i];
+        const TimeSeries& timeSeries = *results[i];
+
+        // items are sorted by environment period, so the records are too
+        std::map<std::string, unsigned>::const_iterator envPeriodIndex = envPeriodIndices.find(item.envPeriod);
+        if (envPeriodIndex == envPeriodIndices.end()){
+          LOG(Warn, "Skipping time series '" << item.name << "' of unknown environment period '" << item.envPeriod << "'");
+          continue;
+        }
+
+        Vector values = timeSeries.values();
+        DateTime firstReportDateTime = timeSeries.firstReportDateTime();
+        Date firstReportDate = firstReportDateTime.date();
+        boost::optional<int> year = firstReportDate.baseYear();
+        boost::optional<Time> intervalLength = timeSeries.intervalLength();
+
+        std::vector<long long> key;
+        key.push_back(firstReportDate.monthOfYear().value());
+        key.push_back(firstReportDate.dayOfMonth());
+        key.push_back(year ? *year : 0);
+        key.push_back(firstReportDateTime.time().totalSeconds());
+        key.push_back(intervalLength ? intervalLength->totalSeconds() : 0);
+        key.push_back(values.size());
+        std::vector<long> secondsFromFirstReport;
+        if (!intervalLength){
+          secondsFromFirstReport = timeSeries.secondsFromFirstReport();
+          key.insert(key.end(), secondsFromFirstReport.begin(), secondsFromFirstReport.end());
+        }
+
+        std::pair<std::map<std::vector<long long>, unsigned>::iterator, bool> inserted = timeAxisIndices.insert(std::make_pair(key, timeAxes.size()));
+        if (inserted.second){
+          ColumnarTimeAxis timeAxis = ColumnarTimeAxis();
+          timeAxis.month = static_cast<std::int32_t>(key[0]);
+          timeAxis.day = static_cast<std::int32_t>(key[1]);
+          timeAxis.year = static_cast<std::int32_t>(key[2]);
+          timeAxis.secondsOfDay = static_cast<std::int32_t>(key[3]);
+          timeAxis.intervalSeconds = static_cast<std::int32_t>(key[4]);
+          timeAxis.numTimes = values.size();
+          if (!intervalLength){
+            std::vector<std::int64_t> seconds(secondsFromFirstReport.begin(), secondsFromFirstReport.end());
+            timeAxis.secondsOffset = appendData(data, seconds.empty() ? nullptr : &seconds[0], seconds.size() * sizeof(std::int64_t));
+          }
+          timeAxes.push_back(timeAxis);
+        }
+
+        ColumnarSeries record = ColumnarSeries();
+        record.envPeriod = envPeriodIndex->second;
+        record.timeAxis = inserted.first->second;
+        record.reportingFrequency = strings.add(item.reportingFrequency);
+        record.name = strings.add(item.name);
+        record.keyValue = strings.add(item.keyValue);
+        record.units = strings.add(timeSeries.units());
+        record.numValues = values.size();
+        record.valuesOffset = appendData(data, values.empty() ? nullptr : &values[0], values.size() * sizeof(double));
+        series.push_back(record);
+      }
+
+      // read all tabular data in one query, the columns are joined to fit execAndReturnVectorOfString
+      // and preceded by one digit per column that is 1 if the column is NULL
+      std::vector<TabularRowStrings> rowStrings;
+      std::string separator = "'" + std::string(1, tabularSeparator) + "'";
+      std::string columns[] = {"ReportName", "ReportForString", "RowName", "TableName", "ColumnName", "Units", "Value"};
+      std::string statement = "SELECT ";
+      for (unsigned i = 0; i < numTabularColumns; ++i){
+        statement += "(" + columns[i] + " IS NULL) || ";
+      }
+      for (unsigned i = 0; i < numTabularColumns; ++i){
+        statement += separator + " || ifnull(" + columns[i] + ", '')";
+        if (i + 1 < numTabularColumns){
+          statement += " || ";
+        }
+      }
+      statement += " FROM TabularDataWithStrings";
+
+      if (boost::optional<std::vector<std::string> > rows = sqlFile.execAndReturnVectorOfString(statement)){
+        std::uint64_t rowIndex = 0;
+        for (const std::string& row : *rows){
+          TabularRowStrings rowColumns;
+          boost::split(rowColumns.columns, row, boost::is_any_of(std::string(1, tabularSeparator)));
+          if ((rowColumns.columns.size() != numTabularColumns + 1) || (rowColumns.columns[0].size() != numTabularColumns)){
+            LOG(Warn, "Skipping tabular row '" << row << "' that contains the column separator");
+            continue;
+          }
+          for (char isNull : rowColumns.columns[0]){
+            rowColumns.nulls.push_back(isNull == '1');
+          }
+          rowColumns.columns.erase(rowColumns.columns.begin());
+          rowColumns.rowIndex = rowIndex++;
+
+          // no query matches a NULL report name, report for string or row name
+          if (rowColumns.nulls[0] || rowColumns.nulls[1] || rowColumns.nulls[2]){
+            continue;
+          }
+          rowStrings.push_back(rowColumns);
+        }
+      }
+      std::sort(rowStrings.begin(), rowStrings.end());
+
+      ColumnarStringRef nullString = ColumnarStringRef();
+      nullString.offset = nullStringOffset;
+      auto addColumn = [&](const TabularRowStrings& row, unsigned i) {
+        return row.nulls[i] ? nullString : strings.add(row.columns[i]);
+      };
+
+      std::vector<ColumnarTabularRow> tabularRows;
+      for (const TabularRowStrings& row : rowStrings){
+        ColumnarTabularRow record = ColumnarTabularRow();
+        record.reportName = addColumn(row, 0);
+        record.reportForString = addColumn(row, 1);
+        record.rowName = addColumn(row, 2);
+        record.tableName = addColumn(row, 3);
+        record.columnName = addColumn(row, 4);
+        record.units = addColumn(row, 5);
+        record.value = addColumn(row, 6);
+        record.rowIndex = row.rowIndex;
+        tabularRows.push_back(record);
+      }
+
+      ColumnarHeader header = ColumnarHeader();
+      std::memcpy(header.magic, columnarMagic, sizeof(header.magic));
+      header.version = columnarVersion;
+      header.byteOrderMark = columnarByteOrderMark;
+      header.numEnvPeriods = envPeriods.size();
+      header.numTimeAxes = timeAxes.size();
+      header.numSeries = series.size();
+      header.numTabularRows = tabularRows.size();
+
+      std::uint64_t offset = sizeof(ColumnarHeader);
+      header.envPeriodsOffset = offset;
+      offset += envPeriods.size() * sizeof(ColumnarEnvPeriod);
+      header.timeAxesOffset = offset;
+      offset += timeAxes.size() * sizeof(ColumnarTimeAxis);
+      header.seriesOffset = offset;
+      offset += series.size() * sizeof(ColumnarSeries);
+      header.tabularRowsOffset = offset;
+      offset += tabularRows.size() * sizeof(ColumnarTabularRow);
+      header.dataOffset = offset;
+      header.dataSize = data.size() * sizeof(std::uint64_t);
+      offset += header.dataSize;
+      header.stringsOffset = offset;
+      header.stringsSize = strings.pool().size();
+
+      boost::filesystem::ofstream os(path, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+      if (!os){
+        LOG(Error, "Could not open '" << toString(path) << "' for writing");
+        return false;
+      }
+
+      os.write(reinterpret_cast<const char*>(&header), sizeof(ColumnarHeader));
+      writeRecords(os, envPeriods);
+      writeRecords(os, timeAxes);
+      writeRecords(os, series);
+      writeRecords(os, tabularRows);
+      writeRecords(os, data);
+      os.write(strings.pool().data(), strings.pool().size());
+      os.close();
+
+      if (!os){
+        LOG(Error, "Could not write '" << toString(path) << "'");
+        return false;
+      }
+      return true;
+    }
+
+    void ColumnarSqlFile_Impl::checkLayout() const
+    {
+      const ColumnarHeader& header = *m_header;
+      if (std::memcmp(header.magic, columnarMagic, sizeof(header.magic)) != 0){
+        LOG_AND_THROW("'" << toString(m_path) << "' is not a columnar sql file");
+      }
+      if (header.version != columnarVersion){
+        LOG_AND_THROW("'" << toString(m_path) << "' has unsupported version " << header.version);
+      }
+      if (header.byteOrderMark != columnarByteOrderMark){
+        LOG_AND_THROW("'" << toString(m_path) << "' was written on a machine with a different byte order");
+      }
+
+      std::uint64_t size = m_size;
+      auto sectionFits = [size](std::uint64_t offset, std::uint64_t count, std::uint64_t recordSize) {
+        return (offset % 8 == 0) && (offset <= size) && (count <= (size - offset) / recordSize);
+      };
+      if (!sectionFits(header.envPeriodsOffset, header.numEnvPeriods, sizeof(ColumnarEnvPeriod)) ||
+          !sectionFits(header.timeAxesOffset, header.numTimeAxes, sizeof(ColumnarTimeAxis)) ||
+          !sectionFits(header.seriesOffset, header.numSeries, sizeof(ColumnarSeries)) ||
+          !sectionFits(header.tabularRowsOffset, header.numTabularRows, sizeof(ColumnarTabularRow)) ||
+          !sectionFits(header.dataOffset, header.dataSize, 1) || (header.dataSize % 8 != 0) ||
+          (header.stringsOffset > size) || (header.stringsSize > size - header.stringsOffset))
+      {
+        LOG_AND_THROW("'" << toString(m_path) << "' is truncated or corrupt");
+      }
+    }
+
+    openstudio::path ColumnarSqlFile_Impl::path() const
+    {
+      return m_path;
+    }
+
+    bool ColumnarSqlFile_Impl::isNull(const ColumnarStringRef& ref)
+    {
+      return ref.offset == nullStringOffset;
+    }
+
+    const char* ColumnarSqlFile_Impl::stringData(const ColumnarStringRef& ref) const
+    {
+      std::uint64_t stringsSize = m_header->stringsSize;
+      if ((ref.offset > stringsSize) || (ref.size > stringsSize - ref.offset)){
+        LOG_AND_THROW("'" << toString(m_path) << "' is corrupt, a string points outside of the file");
+      }
+      return m_strings + ref.offset;
+    }
+
+    std::string ColumnarSqlFile_Impl::string(const ColumnarStringRef& ref) const
+    {
+      return std::string(stringData(ref), ref.size);
+    }
+
+    bool ColumnarSqlFile_Impl::equals(const ColumnarStringRef& ref, const std::string& str) const
+    {
+      return !isNull(ref) && (compare(ref, str) == 0);
+    }
+
+    int ColumnarSqlFile_Impl::compare(const ColumnarStringRef& ref, const std::string& str) const
+    {
+      std::size_t size = std::min<std::size_t>(ref.size, str.size());
+      int result = std::char_traits<char>::compare(stringData(ref), str.data(), size);
+      if (result != 0){
+        return result;
+      }
+      if (ref.size < str.size()){
+        return -1;
+      }
+      return (ref.size > str.size()) ? 1 : 0;
+    }
+
+    boost::optional<std::string> ColumnarSqlFile_Impl::tabularDataValue(const std::string& reportName,
+                                                                        const std::string& reportForString,
+                                                                        const boost::optional<std::string>& tableName,
+                                                                        const std::string& rowName,
+                                                                        const boost::optional<std::string>& columnName,
+                                                                        const std::string& units) const
+    {
+      auto order = [&](const ColumnarTabularRow& row) {
+        int result = compare(row.reportName, reportName);
+        if (result == 0){
+          result = compare(row.reportForString, reportForString);
+        }
+        if (result == 0){
+          result = compare(row.rowName, rowName);
+        }
+        return result;
+      };
+
+      const ColumnarTabularRow* begin = m_tabularRows;
+      const ColumnarTabularRow* end = m_tabularRows + m_header->numTabularRows;
+      begin = std::partition_point(begin, end, [&](const ColumnarTabularRow& row) { return order(row) < 0; });
+      end = std::partition_point(begin, end, [&](const ColumnarTabularRow& row) { return order(row) <= 0; });
+
+      // rows with the same key are in the order of the sql file, the first match is the one sqlite
+      // returns; as in sql, a NULL column matches no value and a NULL value is missing
+      for (const ColumnarTabularRow* row = begin; row != end; ++row){
+        if (equals(row->units, units) &&
+            (!tableName || equals(row->tableName, *tableName)) &&
+            (!columnName || equals(row->columnName, *columnName)))
+        {
+          if (isNull(row->value)){
+            return boost::none;
+          }
+          return string(row->value);
+        }
+      }
+      return boost::none;
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::tabularDataDouble(const std::string& reportName,
+                                                                    const std::string& reportForString,
+                                                                    const boost::optional<std::string>& tableName,
+                                                                    const std::string& rowName,
+                                                                    const boost::optional<std::string>& columnName,
+                                                                    const std::string& units) const
+    {
+      boost::optional<double> result;
+      if (boost::optional<std::string> value = tabularDataValue(reportName, reportForString, tableName, rowName, columnName, units)){
+        // like sqlite, use the leading number of the text and zero if there is none
+        result = std::strtod(value->c_str(), nullptr);
+      }
+      return result;
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::hoursSimulated() const
+    {
+      return tabularDataDouble("InputVerificationandResultsSummary", "Entire Facility", std::string("General"),
+                               "Hours Simulated", boost::none, "hrs");
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::netSiteEnergy() const
+    {
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", std::string("Site and Source Energy"),
+                               "Net Site Energy", std::string("Total Energy"), "GJ");
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::netSourceEnergy() const
+    {
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", std::string("Site and Source Energy"),
+                               "Net Source Energy", std::string("Total Energy"), "GJ");
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::totalSiteEnergy() const
+    {
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", std::string("Site and Source Energy"),
+                               "Total Site Energy", std::string("Total Energy"), "GJ");
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::totalSourceEnergy() const
+    {
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", std::string("Site and Source Energy"),
+                               "Total Source Energy", std::string("Total Energy"), "GJ");
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::energyConsumptionByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                                           const openstudio::EndUseCategoryType& t_categoryType,
+                                                                           const openstudio::MonthOfYear& t_monthOfYear) const
+    {
+      const std::string reportname = "BUILDING ENERGY PERFORMANCE - " + boost::algorithm::to_upper_copy(t_fuelType.valueDescription());
+      const std::string columnname = boost::algorithm::to_upper_copy(t_categoryType.valueName()) + ":" +
+        boost::algorithm::to_upper_copy(t_fuelType.valueName());
+      const std::string rowname = t_monthOfYear.valueDescription();
+
+      return tabularDataDouble(reportname, "Meter", boost::none, rowname, columnname, "J");
+    }
+
+    boost::optional<double> ColumnarSqlFile_Impl::peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                                          const openstudio::EndUseCategoryType& t_categoryType,
+                                                                          const openstudio::MonthOfYear& t_monthOfYear) const
+    {
+      const std::string reportname = "BUILDING ENERGY PERFORMANCE - " + boost::algorithm::to_upper_copy(t_fuelType.valueDescription()) + " PEAK DEMAND";
+      const std::string columnname = boost::algorithm::to_upper_copy(t_categoryType.valueName()) + ":" +
+        boost::algorithm::to_upper_copy(t_fuelType.valueName()) +
+        " {AT MAX/MIN}";
+      const std::string rowname = t_monthOfYear.valueDescription();
+
+      return tabularDataDouble(reportname, "Meter", boost::none, rowname, columnname, "W");
+    }
+
+    boost::optional<unsigned> ColumnarSqlFile_Impl::envPeriodIndex(const std::string& envPeriod) const
+    {
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+
+      const ColumnarEnvPeriod* begin = m_envPeriods;
+      const ColumnarEnvPeriod* end = m_envPeriods + m_header->numEnvPeriods;
+      const ColumnarEnvPeriod* it = std::partition_point(begin, end, [&](const ColumnarEnvPeriod& record) { return compare(record.name, queryEnvPeriod) < 0; });
+      if ((it == end) || (compare(it->name, queryEnvPeriod) != 0)){
+        return boost::none;
+      }
+      return static_cast<unsigned>(it - begin);
+    }
+
+    std::pair<const ColumnarSeries*, const ColumnarSeries*> ColumnarSqlFile_Impl::seriesRange(unsigned envPeriod,
+                                                                                              const std::string* reportingFrequency,
+                                                                                              const std::string* timeSeriesName,
+                                                                                              const std::string* keyValue) const
+    {
+      auto order = [&](const ColumnarSeries& series) {
+        if (series.envPeriod != envPeriod){
+          return (series.envPeriod < envPeriod) ? -1 : 1;
+        }
+        int result = 0;
+        if (reportingFrequency){
+          result = compare(series.reportingFrequency, *reportingFrequency);
+          if ((result == 0) && timeSeriesName){
+            result = compare(series.name, *timeSeriesName);
+            if ((result == 0) && keyValue){
+              result = compare(series.keyValue, *keyValue);
+            }
+          }
+        }
+        return result;
+      };
+
+      const ColumnarSeries* begin = m_series;
+      const ColumnarSeries* end = m_series + m_header->numSeries;
+      begin = std::partition_point(begin, end, [&](const ColumnarSeries& series) { return order(series) < 0; });
+      end = std::partition_point(begin, end, [&](const ColumnarSeries& series) { return order(series) <= 0; });
+      return std::make_pair(begin, end);
+    }
+
+    const ColumnarSeries* ColumnarSqlFile_Impl::findSeries(const std::string& envPeriod,
+                                                           const std::string& reportingFrequency,
+                                                           const std::string& timeSeriesName,
+                                                           const std::string& keyValue) const
+    {
+      boost::optional<unsigned> index = envPeriodIndex(envPeriod);
+      if (!index){
+        return nullptr;
+      }
+      std::pair<const ColumnarSeries*, const ColumnarSeries*> range = seriesRange(*index, &reportingFrequency, &timeSeriesName, &keyValue);
+      if (range.first == range.second){
+        return nullptr;
+      }
+      return range.first;
+    }
+
+    bool ColumnarSqlFile_Impl::dataFits(std::uint64_t offset, std::uint64_t count) const
+    {
+      std::uint64_t dataSize = m_header->dataSize;
+      return (offset % 8 == 0) && (offset <= dataSize) && (count <= (dataSize - offset) / 8);
+    }
+
+    void ColumnarSqlFile_Impl::checkSeries(const ColumnarSeries& series) const
+    {
+      bool valid = (series.timeAxis < m_header->numTimeAxes);
+      if (valid){
+        const ColumnarTimeAxis& timeAxis = m_timeAxes[series.timeAxis];
+        valid = (timeAxis.month >= 1) && (timeAxis.month <= 12) && (timeAxis.day >= 1) && (timeAxis.day <= 31) &&
+                (timeAxis.intervalSeconds >= 0) && ((timeAxis.intervalSeconds > 0) || dataFits(timeAxis.secondsOffset, timeAxis.numTimes)) &&
+                (series.numValues == timeAxis.numTimes) && dataFits(series.valuesOffset, series.numValues);
+      }
+      if (!valid){
+        LOG_AND_THROW("'" << toString(m_path) << "' is corrupt, a time series points outside of the file");
+      }
+    }
+
+    TimeSeries ColumnarSqlFile_Impl::timeSeries(const ColumnarSeries& series) const
+    {
+      checkSeries(series);
+      const ColumnarTimeAxis& timeAxis = m_timeAxes[series.timeAxis];
+      const char* data = m_data + m_header->dataOffset;
+
+      Date date = (timeAxis.year != 0) ? Date(monthOfYear(timeAxis.month), timeAxis.day, timeAxis.year)
+                                       : Date(monthOfYear(timeAxis.month), timeAxis.day);
+      DateTime firstReportDateTime(date, Time(0, 0, 0, timeAxis.secondsOfDay));
+
+      const double* values = reinterpret_cast<const double*>(data + series.valuesOffset);
+      Vector vector(series.numValues);
+      std::copy(values, values + series.numValues, vector.begin());
+
+      if (timeAxis.intervalSeconds > 0){
+        return TimeSeries(firstReportDateTime, Time(0, 0, 0, timeAxis.intervalSeconds), vector, string(series.units));
+      }
+
+      const std::int64_t* seconds = reinterpret_cast<const std::int64_t*>(data + timeAxis.secondsOffset);
+      std::vector<long> secondsFromFirstReport(seconds, seconds + timeAxis.numTimes);
+      return TimeSeries(firstReportDateTime, secondsFromFirstReport, vector, string(series.units));
+    }
+
+    boost::optional<EnvironmentType> ColumnarSqlFile_Impl::environmentType(const std::string& envPeriod) const
+    {
+      boost::optional<EnvironmentType> result;
+      if (boost::optional<unsigned> index = envPeriodIndex(envPeriod)){
+        int type = m_envPeriods[*index].environmentType;
+        if (type >= 0){
+          try{
+            result = EnvironmentType(type);
+          }catch(...){
+            LOG(Error, "Could not convert integer value " << type << " to EnvironmentType");
+          }
+        }
+      }
+      return result;
+    }
+
+    std::vector<std::string> ColumnarSqlFile_Impl::availableEnvPeriods() const
+    {
+      std::vector<std::string> result;
+      for (std::uint64_t i = 0; i < m_header->numEnvPeriods; ++i){
+        result.push_back(string(m_envPeriods[i].name));
+      }
+      return result;
+    }
+
+    std::vector<std::string> ColumnarSqlFile_Impl::availableReportingFrequencies(const std::string& envPeriod) const
+    {
+      std::vector<std::string> result;
+      if (boost::optional<unsigned> index = envPeriodIndex(envPeriod)){
+        std::pair<const ColumnarSeries*, const ColumnarSeries*> range = seriesRange(*index, nullptr, nullptr, nullptr);
+        for (const ColumnarSeries* series = range.first; series != range.second; ++series){
+          if (result.empty() || (compare(series->reportingFrequency, result.back()) != 0)){
+            result.push_back(string(series->reportingFrequency));
+          }
+        }
+      }
+      return result;
+    }
+
+    std::vector<std::string> ColumnarSqlFile_Impl::availableVariableNames(const std::string& envPeriod,
+                                                                          const std::string& reportingFrequency) const
+    {
+      std::vector<std::string> result;
+      if (boost::optional<unsigned> index = envPeriodIndex(envPeriod)){
+        std::pair<const ColumnarSeries*, const ColumnarSeries*> range = seriesRange(*index, &reportingFrequency, nullptr, nullptr);
+        for (const ColumnarSeries* series = range.first; series != range.second; ++series){
+          if (result.empty() || (compare(series->name, result.back()) != 0)){
+            result.push_back(string(series->name));
+          }
+        }
+      }
+      return result;
+    }
+
+    std::vector<std::string> ColumnarSqlFile_Impl::availableKeyValues(const std::string& envPeriod,
+                                                                      const std::string& reportingFrequency,
+                                                                      const std::string& timeSeriesName) const
+    {
+      std::vector<std::string> result;
+      if (boost::optional<unsigned> index = envPeriodIndex(envPeriod)){
+        std::pair<const ColumnarSeries*, const ColumnarSeries*> range = seriesRange(*index, &reportingFrequency, &timeSeriesName, nullptr);
+        for (const ColumnarSeries* series = range.first; series != range.second; ++series){
+          if (result.empty() || (compare(series->keyValue, result.back()) != 0)){
+            result.push_back(string(series->keyValue));
+          }
+        }
+      }
+      return result;
+    }
+
+    std::vector<TimeSeries> ColumnarSqlFile_Impl::timeSeries(const std::string& envPeriod,
+                                                             const std::string& reportingFrequency,
+                                                             const std::string& timeSeriesName) const
+    {
+      std::vector<TimeSeries> result;
+      if (boost::optional<unsigned> index = envPeriodIndex(envPeriod)){
+        std::pair<const ColumnarSeries*, const ColumnarSeries*> range = seriesRange(*index, &reportingFrequency, &timeSeriesName, nullptr);
+        for (const ColumnarSeries* series = range.first; series != range.second; ++series){
+          // skip time series that repeat a key value, as SqlFile does
+          if ((series == range.first) || (string(series->keyValue) != string((series - 1)->keyValue))){
+            result.push_back(timeSeries(*series));
+          }
+        }
+      }
+      return result;
+    }
+
+    boost::optional<TimeSeries> ColumnarSqlFile_Impl::timeSeries(const std::string& envPeriod,
+                                                                 const std::string& reportingFrequency,
+                                                                 const std::string& timeSeriesName,
+                                                                 const std::string& keyValue) const
+    {
+      if (const ColumnarSeries* series = findSeries(envPeriod, reportingFrequency, timeSeriesName, keyValue)){
+        return timeSeries(*series);
+      }
+      return boost::none;
+    }
+
+    const double* ColumnarSqlFile_Impl::timeSeriesValues(const std::string& envPeriod,
+                                                         const std::string& reportingFrequency,
+                                                         const std::string& timeSeriesName,
+                                                         const std::string& keyValue,
+                                                         std::size_t& numValues) const
+    {
+      numValues = 0;
+      if (const ColumnarSeries* series = findSeries(envPeriod, reportingFrequency, timeSeriesName, keyValue)){
+        checkSeries(*series);
+        numValues = static_cast<std::size_t>(series->numValues);
+        return reinterpret_cast<const double*>(m_data + m_header->dataOffset + series->valuesOffset);
+      }
+      return nullptr;
+    }
+
+  } // detail
+
+} // openstudio
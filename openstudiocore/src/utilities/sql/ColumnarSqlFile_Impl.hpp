@@ -0,0 +1,257 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#ifndef UTILITIES_SQL_COLUMNARSQLFILE_IMPL_HPP
+#define UTILITIES_SQL_COLUMNARSQLFILE_IMPL_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "SqlFileEnums.hpp"
+
+#include "../data/DataEnums.hpp"
+#include "../data/TimeSeries.hpp"
+#include "../time/Date.hpp"
+
+#include "../core/Path.hpp"
+#include "../core/Logger.hpp"
+
+#include <QFile>
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+class SqlFile;
+
+namespace detail {
+
+  /** Layout of a ColumnarSqlFile. The file starts with a ColumnarHeader, followed by the record
+   *  tables it points to, a data section of 8 byte words and a string pool. Every record is a
+   *  multiple of 8 bytes long so that all values in the mapped file are naturally aligned. */
+
+  /// a string in the string pool, offset is relative to the start of the pool, the largest offset
+  /// marks a NULL column of a tabular row
+  struct ColumnarStringRef
+  {
+    std::uint64_t offset;
+    std::uint64_t size;
+  };
+
+  struct ColumnarHeader
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrderMark;
+    std::uint64_t numEnvPeriods;
+    std::uint64_t numTimeAxes;
+    std::uint64_t numSeries;
+    std::uint64_t numTabularRows;
+    std::uint64_t envPeriodsOffset;
+    std::uint64_t timeAxesOffset;
+    std::uint64_t seriesOffset;
+    std::uint64_t tabularRowsOffset;
+    std::uint64_t dataOffset;
+    std::uint64_t dataSize;
+    std::uint64_t stringsOffset;
+    std::uint64_t stringsSize;
+  };
+
+  /// the environment periods of the EnvironmentPeriods table, sorted by upper case name
+  struct ColumnarEnvPeriod
+  {
+    ColumnarStringRef name;
+    std::int32_t environmentType; // -1 if unknown
+    std::int32_t padding;
+  };
+
+  /// the report times shared by one or more time series
+  struct ColumnarTimeAxis
+  {
+    std::int32_t month;
+    std::int32_t day;
+    std::int32_t year; // 0 if the first report date has no base year
+    std::int32_t secondsOfDay;
+    std::int32_t intervalSeconds; // 0 if the time series are not at regular intervals
+    std::int32_t padding;
+    std::uint64_t numTimes;
+    std::uint64_t secondsOffset; // int64 seconds from first report in the data section, unused for intervals
+  };
+
+  /// time series are sorted by environment period, reporting frequency, name and key value
+  struct ColumnarSeries
+  {
+    std::uint32_t envPeriod;
+    std::uint32_t timeAxis;
+    ColumnarStringRef reportingFrequency;
+    ColumnarStringRef name;
+    ColumnarStringRef keyValue;
+    ColumnarStringRef units;
+    std::uint64_t numValues;
+    std::uint64_t valuesOffset; // doubles in the data section
+  };
+
+  /// tabular rows are sorted by report name, report for string and row name, and then by their
+  /// order in the sql file; rows with a NULL report name, report for string or row name are omitted
+  struct ColumnarTabularRow
+  {
+    ColumnarStringRef reportName;
+    ColumnarStringRef reportForString;
+    ColumnarStringRef rowName;
+    ColumnarStringRef tableName;
+    ColumnarStringRef columnName;
+    ColumnarStringRef units;
+    ColumnarStringRef value;
+    std::uint64_t rowIndex;
+  };
+
+  class UTILITIES_API ColumnarSqlFile_Impl
+  {
+  public:
+
+    /// opens and maps path, throws if it is not a valid file
+    ColumnarSqlFile_Impl(const openstudio::path& path);
+
+    virtual ~ColumnarSqlFile_Impl();
+
+    static bool convert(SqlFile& sqlFile, const openstudio::path& path);
+
+    openstudio::path path() const;
+
+    boost::optional<std::string> tabularDataValue(const std::string& reportName,
+                                                  const std::string& reportForString,
+                                                  const boost::optional<std::string>& tableName,
+                                                  const std::string& rowName,
+                                                  const boost::optional<std::string>& columnName,
+                                                  const std::string& units) const;
+
+    boost::optional<double> tabularDataDouble(const std::string& reportName,
+                                              const std::string& reportForString,
+                                              const boost::optional<std::string>& tableName,
+                                              const std::string& rowName,
+                                              const boost::optional<std::string>& columnName,
+                                              const std::string& units) const;
+
+    boost::optional<double> hoursSimulated() const;
+
+    boost::optional<double> netSiteEnergy() const;
+
+    boost::optional<double> netSourceEnergy() const;
+
+    boost::optional<double> totalSiteEnergy() const;
+
+    boost::optional<double> totalSourceEnergy() const;
+
+    boost::optional<double> energyConsumptionByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                     const openstudio::EndUseCategoryType& t_categoryType,
+                                                     const openstudio::MonthOfYear& t_monthOfYear) const;
+
+    boost::optional<double> peakEnergyDemandByMonth(const openstudio::EndUseFuelType& t_fuelType,
+                                                    const openstudio::EndUseCategoryType& t_categoryType,
+                                                    const openstudio::MonthOfYear& t_monthOfYear) const;
+
+    boost::optional<openstudio::EnvironmentType> environmentType(const std::string& envPeriod) const;
+
+    std::vector<std::string> availableEnvPeriods() const;
+
+    std::vector<std::string> availableReportingFrequencies(const std::string& envPeriod) const;
+
+    std::vector<std::string> availableVariableNames(const std::string& envPeriod,
+                                                    const std::string& reportingFrequency) const;
+
+    std::vector<std::string> availableKeyValues(const std::string& envPeriod,
+                                                const std::string& reportingFrequency,
+                                                const std::string& timeSeriesName) const;
+
+    std::vector<TimeSeries> timeSeries(const std::string& envPeriod,
+                                       const std::string& reportingFrequency,
+                                       const std::string& timeSeriesName) const;
+
+    boost::optional<TimeSeries> timeSeries(const std::string& envPeriod,
+                                           const std::string& reportingFrequency,
+                                           const std::string& timeSeriesName,
+                                           const std::string& keyValue) const;
+
+    const double* timeSeriesValues(const std::string& envPeriod,
+                                   const std::string& reportingFrequency,
+                                   const std::string& timeSeriesName,
+                                   const std::string& keyValue,
+                                   std::size_t& numValues) const;
+
+  private:
+
+    REGISTER_LOGGER("openstudio.sql.ColumnarSqlFile");
+
+    // throws if the header or any section points outside of the file, records are checked when
+    // they are read so that opening a file does not touch all of it
+    void checkLayout() const;
+
+    static bool isNull(const ColumnarStringRef& ref);
+
+    // returns the first character of ref, throws if ref points outside of the string pool
+    const char* stringData(const ColumnarStringRef& ref) const;
+
+    std::string string(const ColumnarStringRef& ref) const;
+
+    // false if ref is NULL
+    bool equals(const ColumnarStringRef& ref, const std::string& str) const;
+
+    // compares the string at ref to str as std::string::compare would
+    int compare(const ColumnarStringRef& ref, const std::string& str) const;
+
+    boost::optional<unsigned> envPeriodIndex(const std::string& envPeriod) const;
+
+    // returns the range of time series matching envPeriod and, if they are not null, the
+    // reportingFrequency, timeSeriesName and keyValue; the arguments have to be given in order
+    std::pair<const ColumnarSeries*, const ColumnarSeries*> seriesRange(unsigned envPeriod,
+                                                                        const std::string* reportingFrequency,
+                                                                        const std::string* timeSeriesName,
+                                                                        const std::string* keyValue) const;
+
+    const ColumnarSeries* findSeries(const std::string& envPeriod,
+                                     const std::string& reportingFrequency,
+                                     const std::string& timeSeriesName,
+                                     const std::string& keyValue) const;
+
+    bool dataFits(std::uint64_t offset, std::uint64_t count) const;
+
+    // throws if series or its time axis points outside of the file
+    void checkSeries(const ColumnarSeries& series) const;
+
+    TimeSeries timeSeries(const ColumnarSeries& series) const;
+
+    openstudio::path m_path;
+    QFile m_file;
+    const char* m_data;
+    std::uint64_t m_size;
+    const ColumnarHeader* m_header;
+    const ColumnarEnvPeriod* m_envPeriods;
+    const ColumnarTimeAxis* m_timeAxes;
+    const ColumnarSeries* m_series;
+    const ColumnarTabularRow* m_tabularRows;
+    const char* m_strings;
+  };
+
+} // detail
+} // openstudio
+
+#endif // UTILITIES_SQL_COLUMNARSQLFILE_IMPL_HPP
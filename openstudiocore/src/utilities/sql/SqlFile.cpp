@@ -1378,6 +1378,14 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+TimeSeriesVector SqlFile::timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+  TimeSeriesVector result;
+  if (m_impl) {
+    result = m_impl->timeSeries(queries);
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime> > SqlFile::daylightSavingsPeriod() const
 {
   boost::optional<std::pair<DateTime, DateTime> > result;
@@ -56,6 +56,7 @@ class SqlFileTimeSeriesQuery;
 
 namespace detail {
   class SqlFile_Impl;
+  class ColumnarSqlFile_Impl;
 }
 
 /** SqlFile class is a transaction script around the sql output of EnergyPlus. */
@@ -693,6 +694,11 @@ class UTILITIES_API SqlFile {
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Executes each of queries as timeSeries(query) does and returns all of the results in order. 
+   *  Use this to retrieve many time series at once, the data of all of them is read in one database 
+   *  query per table and environment period. */
+  std::vector<TimeSeries> timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -849,6 +855,9 @@ private:
 
   std::shared_ptr<detail::SqlFile_Impl> m_impl;
 
+  // reads the data dictionary, time series and tabular data to convert them
+  friend class detail::ColumnarSqlFile_Impl;
+
   /// returns datadictionary of available timeseries
   friend class ::resultsviewer::TableView;
   detail::DataDictionaryTable dataDictionary() const;
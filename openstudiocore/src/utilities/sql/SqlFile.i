@@ -6,6 +6,7 @@
 
 %{
   #include <utilities/sql/SqlFile.hpp>
+  #include <utilities/sql/ColumnarSqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
   
@@ -29,9 +30,11 @@
 // These functions return via reference parameters - something we cannot support with SWIG
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(const std::string &, double &, double &);
 %ignore openstudio::SqlFile::illuminanceMapMaxValue(int, double &, double &);
+%ignore openstudio::ColumnarSqlFile::timeSeriesValues;
 
 // create an instantiation of the optional classes
 %template(OptionalSqlFile) boost::optional<openstudio::SqlFile>;
+%template(OptionalColumnarSqlFile) boost::optional<openstudio::ColumnarSqlFile>;
 %template(OptionalEnvironmentType) boost::optional<openstudio::EnvironmentType>;
 %template(OptionalReportingFrequency) boost::optional<openstudio::ReportingFrequency>;
 %template(OptionalKeyValueIdentifier) boost::optional<openstudio::KeyValueIdentifier>;
@@ -45,6 +48,7 @@
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
 
 %include <utilities/sql/SqlFile.hpp>
+%include <utilities/sql/ColumnarSqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
 
@@ -387,6 +387,7 @@ namespace openstudio{
     {
       if (m_connectionOpen)
       {
+        clearStatementCache();
         sqlite3_close(m_db);
         m_connectionOpen = false;
       }
@@ -852,14 +853,7 @@ namespace openstudio{
         boost::algorithm::to_upper_copy(t_fuelType.valueName());
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='J'";
-
-      return execAndReturnFirstDouble(s);
+      return meterTabularDataValue(reportname, rowname, columnname, "J");
     }
     
     //TODO
@@ -874,26 +868,20 @@ namespace openstudio{
         " {AT MAX/MIN}";
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='W'";
-
-      return execAndReturnFirstDouble(s);
+      return meterTabularDataValue(reportname, rowname, columnname, "W");
     }
 
     /// hours simulated
     boost::optional<double> SqlFile_Impl::hoursSimulated() const
     {
       const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='InputVerificationandResultsSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='General' AND \
-                              RowName='Hours Simulated' AND \
-                              Units='hrs'";
-      boost::optional<double> ret = execAndReturnFirstDouble(s);
+                              ReportName=? AND \
+                              ReportForString=? AND \
+                              TableName=? AND \
+                              RowName=? AND \
+                              Units=?";
+      std::vector<std::string> values = {"InputVerificationandResultsSummary", "Entire Facility", "General", "Hours Simulated", "hrs"};
+      boost::optional<double> ret = execAndReturnFirstDouble(s, values);
 
       if (ret) return ret;
 
@@ -916,14 +904,8 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
       }
 
-      std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      boost::optional<double> d = execAndReturnFirstDouble(s);
+      boost::optional<double> d = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                                                   "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
 
       if (!d) {
         LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -947,14 +929,8 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                              "Site and Source Energy", "Net Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -967,14 +943,8 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                              "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
     }
 
 
@@ -987,31 +957,25 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                              "Site and Source Energy", "Total Source Energy", "Total Energy", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electric') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("Electric", "Cost", "~~$~~", "Cost (~~$~~)");
       } else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Gas') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("Gas", "Cost", "~~$~~", "Cost (~~$~~)");
       } else if (fuel == FuelType::DistrictCooling){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='District Cooling') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("District Cooling", "Cost", "~~$~~", "Cost (~~$~~)");
       } else if (fuel == FuelType::DistrictHeating){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='District Heating') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("District Heating", "Cost", "~~$~~", "Cost (~~$~~)");
       } else if (fuel == FuelType::Water){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Water') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("Water", "Cost", "~~$~~", "Cost (~~$~~)");
       } else{
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Other') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue("Other", "Cost", "~~$~~", "Cost (~~$~~)");
       }
     }
 
@@ -1019,34 +983,34 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electric') and (((RowName = 'Cost per Total Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Electric", "Cost per Total Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Gas') and (((RowName = 'Cost per Total Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Gas", "Cost per Total Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::DistrictCooling){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='District Cooling') and (((RowName = 'Cost per Total Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("District Cooling", "Cost per Total Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::DistrictHeating){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='District Heating') and (((RowName = 'Cost per Total Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("District Heating", "Cost per Total Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::Water){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Water') and (((RowName = 'Cost per Total Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Water", "Cost per Total Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else {
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Other') and (((RowName = 'Cost per Total Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Other", "Cost per Total Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       }
     }
 
     OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electric') and (((RowName = 'Cost per Net Conditioned Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Electric", "Cost per Net Conditioned Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Gas') and (((RowName = 'Cost per Net Conditioned Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Gas", "Cost per Net Conditioned Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::DistrictCooling){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='District Cooling') and (((RowName = 'Cost per Net Conditioned Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("District Cooling", "Cost per Net Conditioned Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::DistrictHeating){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='District Heating') and (((RowName = 'Cost per Net Conditioned Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("District Heating", "Cost per Net Conditioned Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else if (fuel == FuelType::Water){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Water') and (((RowName = 'Cost per Net Conditioned Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Water", "Cost per Net Conditioned Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       } else {
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Other') and (((RowName = 'Cost per Net Conditioned Building Area') and (Units = '~~$~~/m2')) or (RowName = 'Cost per Total Building Area (~~$~~/m2)'))");
+        return annualCostValue("Other", "Cost per Net Conditioned Building Area", "~~$~~/m2", "Cost per Total Building Area (~~$~~/m2)");
       }
     }
 
@@ -1220,10 +1184,8 @@ namespace openstudio{
       }
       if(name.size() == 0) return result;
 
-      query = "SELECT value from tabulardatawithstrings where ReportName = 'Tariff Report' and ReportForString = '";
-      query += name;
-      query +=  "' and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
-      result = execAndReturnFirstDouble(query);
+      query = "SELECT value from tabulardatawithstrings where ReportName = 'Tariff Report' and ReportForString = ? and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
+      result = execAndReturnFirstDouble(query, std::vector<std::string>(1u, name));
 
       return result;
     }
@@ -1253,10 +1215,7 @@ namespace openstudio{
         std::string units = result.getUnitsForFuelType(fuelType);
         for (EndUseCategoryType category : result.categories()){
 
-          std::string query = "SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='" + \
-                               fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-          boost::optional<double> value = execAndReturnFirstDouble(query);
+          boost::optional<double> value = endUseValue(fuelType.valueDescription(), category.valueDescription(), units);
           OS_ASSERT(value);
 
           if (*value != 0.0){
@@ -1272,454 +1231,454 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::electricityHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Interior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Exterior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Interior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Exterior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Fans", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Pumps", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Heat Rejection", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Humidification", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Heat Recovery", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Water Systems", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Refrigeration", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Generators", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return endUseValue("Electricity", "Total End Uses", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Interior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Exterior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Interior Equipment", "GJ");
     }
     OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Exterior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Fans", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Pumps", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Heat Rejection", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::naturalGasHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Humidification", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Heat Recovery", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Water Systems", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Refrigeration", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Generators", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return endUseValue("Natural Gas", "Total End Uses", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Interior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Exterior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Interior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Exterior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Fans", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Pumps", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Heat Rejection", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Humidification", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Heat Recovery", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Water Systems", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Refrigeration", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Generators", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return endUseValue("Additional Fuel", "Total End Uses", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Interior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Exterior Lighting", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Interior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Exterior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Fans", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Pumps", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Heat Rejection", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Humidification", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Heat Recovery", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Water Systems", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Refrigeration", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Generators", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return endUseValue("District Cooling", "Total End Uses", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Interior Lights", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Exterior Lights", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Interior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Exterior Equipment", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Fans", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Pumps", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Heat Rejection", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Humidification", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Heat Recovery", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Water Systems", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Refrigeration", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Generators", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return endUseValue("District Heating", "Total End Uses", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::waterHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+      return endUseValue("Water", "Heating", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+      return endUseValue("Water", "Cooling", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+      return endUseValue("Water", "Interior Lighting", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+      return endUseValue("Water", "Exterior Lighting", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+      return endUseValue("Water", "Interior Equipment", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+      return endUseValue("Water", "Exterior Equipment", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+      return endUseValue("Water", "Fans", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+      return endUseValue("Water", "Pumps", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+      return endUseValue("Water", "Heat Rejection", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+      return endUseValue("Water", "Humidification", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+      return endUseValue("Water", "Heat Recovery", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+      return endUseValue("Water", "Water Systems", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+      return endUseValue("Water", "Refrigeration", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+      return endUseValue("Water", "Generators", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+      return endUseValue("Water", "Total End Uses", "m3");
     }
 
     OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const
@@ -1778,13 +1737,20 @@ namespace openstudio{
     {
 
       openstudio::TimeSeriesVector vec;
-      openstudio::OptionalTimeSeries ts;
 
-      std::vector<std::string> vecKeyValues = availableKeyValues(envPeriod, reportingFrequency, timeSeriesName);
-      std::vector<std::string>::iterator iter;
-      for (iter=vecKeyValues.begin();iter!=vecKeyValues.end();++iter)
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+
+      std::vector<DataDictionaryItem> items;
+      for (const std::string& keyValue : availableKeyValues(envPeriod, reportingFrequency, timeSeriesName))
+      {
+        DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator iEpRfNKv = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesName, keyValue));
+        if (iEpRfNKv != m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().end()){
+          items.push_back(*iEpRfNKv);
+        }
+      }
+
+      for (const openstudio::OptionalTimeSeries& ts : timeSeries(items))
       {
-        ts = timeSeries(envPeriod, reportingFrequency, timeSeriesName, *iter);
         if (ts){
           vec.push_back(*ts);
         }
@@ -1827,41 +1793,112 @@ namespace openstudio{
     boost::optional<double> SqlFile_Impl::execAndReturnFirstDouble(const std::string& statement) const
     {
       boost::optional<double> value;
-      if (m_db)
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
       {
-        sqlite3_stmt* sqlStmtPtr;
+        int code = sqlite3_step(sqlStmtPtr);
+        if (code == SQLITE_ROW)
+        {
+          value = sqlite3_column_double(sqlStmtPtr, 0);
+        }
 
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        // reset to release the read lock, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
+      }
+      return value;
+    }
 
-        code = sqlite3_step(sqlStmtPtr);
+    boost::optional<double> SqlFile_Impl::execAndReturnFirstDouble(const std::string& statement, const std::vector<std::string>& values) const
+    {
+      boost::optional<double> value;
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
+      {
+        // values outlives the step, so sqlite does not need its own copy
+        for (unsigned i = 0; i < values.size(); ++i)
+        {
+          sqlite3_bind_text(sqlStmtPtr, i + 1, values[i].c_str(), values[i].size(), SQLITE_STATIC);
+        }
+
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           value = sqlite3_column_double(sqlStmtPtr, 0);
         }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        // reset to release the read lock and drop the bindings, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
+        sqlite3_clear_bindings(sqlStmtPtr);
       }
       return value;
     }
 
+    boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName,
+                                                           const std::string& reportForString,
+                                                           const std::string& tableName,
+                                                           const std::string& rowName,
+                                                           const std::string& columnName,
+                                                           const std::string& units) const
+    {
+      static const std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
+                                    ReportName=? AND \
+                                    ReportForString=? AND \
+                                    TableName=? AND \
+                                    RowName=? AND \
+                                    ColumnName=? AND \
+                                    Units=?";
+      std::vector<std::string> values = {reportName, reportForString, tableName, rowName, columnName, units};
+      return execAndReturnFirstDouble(s, values);
+    }
+
+    boost::optional<double> SqlFile_Impl::meterTabularDataValue(const std::string& reportName,
+                                                                const std::string& rowName,
+                                                                const std::string& columnName,
+                                                                const std::string& units) const
+    {
+      static const std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
+                                    ReportName=? AND \
+                                    ReportForString='Meter' AND \
+                                    RowName=? AND \
+                                    ColumnName=? AND \
+                                    Units=?";
+      std::vector<std::string> values = {reportName, rowName, columnName, units};
+      return execAndReturnFirstDouble(s, values);
+    }
+
+    boost::optional<double> SqlFile_Impl::endUseValue(const std::string& columnName,
+                                                      const std::string& rowName,
+                                                      const std::string& units) const
+    {
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", rowName, columnName, units);
+    }
+
+    boost::optional<double> SqlFile_Impl::annualCostValue(const std::string& columnName,
+                                                          const std::string& rowName,
+                                                          const std::string& units,
+                                                          const std::string& rowNameWithUnits) const
+    {
+      static const std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
+                                    ReportName='Economics Results Summary Report' AND \
+                                    ReportForString='Entire Facility' AND \
+                                    TableName='Annual Cost' AND \
+                                    ColumnName=? AND \
+                                    ((RowName=? AND Units=?) OR RowName=?)";
+      std::vector<std::string> values = {columnName, rowName, units, rowNameWithUnits};
+      return execAndReturnFirstDouble(s, values);
+    }
+
     boost::optional<int> SqlFile_Impl::execAndReturnFirstInt(const std::string& statement) const
     {
       boost::optional<int> value;
-      if (m_db)
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           value = sqlite3_column_int(sqlStmtPtr, 0);
         }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        // reset to release the read lock, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
       }
       return value;
     }
@@ -1869,20 +1906,16 @@ namespace openstudio{
     boost::optional<std::string> SqlFile_Impl::execAndReturnFirstString(const std::string& statement) const
     {
       boost::optional<std::string> value;
-      if (m_db)
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-
-        code = sqlite3_step(sqlStmtPtr);
+        int code = sqlite3_step(sqlStmtPtr);
         if (code == SQLITE_ROW)
         {
           value = columnText(sqlite3_column_text(sqlStmtPtr, 0));
         }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        // reset to release the read lock, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
       }
       return value;
     }
@@ -1891,11 +1924,9 @@ namespace openstudio{
     {
       boost::optional<double> value;
       boost::optional<std::vector<double> > valueVector;
-      if (m_db)
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        int code = SQLITE_OK;
         while ((code!= SQLITE_DONE) && (code != SQLITE_BUSY)&& (code != SQLITE_ERROR) && (code != SQLITE_MISUSE)  )//loop until SQLITE_DONE
         {
           if (!valueVector){
@@ -1915,8 +1946,8 @@ namespace openstudio{
 
         }// end loop
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        // reset to release the read lock, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
       }
 
       return valueVector;
@@ -1926,11 +1957,9 @@ namespace openstudio{
     {
       boost::optional<int> value;
       boost::optional<std::vector<int> > valueVector;
-      if (m_db)
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        int code = SQLITE_OK;
         while ((code!= SQLITE_DONE) && (code != SQLITE_BUSY)&& (code != SQLITE_ERROR) && (code != SQLITE_MISUSE)  )//loop until SQLITE_DONE
         {
           if (!valueVector){
@@ -1950,8 +1979,8 @@ namespace openstudio{
 
         }// end loop
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+        // reset to release the read lock, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
       }
 
       return valueVector;
@@ -1961,11 +1990,9 @@ namespace openstudio{
     {
       boost::optional<std::string> value;
       boost::optional<std::vector<std::string> > valueVector;
-      if (m_db)
+      if (sqlite3_stmt* sqlStmtPtr = cachedStatement(statement))
       {
-        sqlite3_stmt* sqlStmtPtr;
-
-        int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        int code = SQLITE_OK;
         while ((code!= SQLITE_DONE) && (code != SQLITE_BUSY)&& (code != SQLITE_ERROR) && (code != SQLITE_MISUSE)  )//loop until SQLITE_DONE
         {
           if (!valueVector){
@@ -1984,12 +2011,63 @@ namespace openstudio{
           }
 
         }// end loop
+        // reset to release the read lock, the statement is kept for next time
+        sqlite3_reset(sqlStmtPtr);
+      }
+      return valueVector;
+    }
+
+
+    sqlite3_stmt* SqlFile_Impl::cachedStatement(const std::string& statement) const
+    {
+      // bounds the cache when callers build many distinct statements
+      static const size_t maxCachedStatements = 256;
+
+      if (!m_db)
+      {
+        return nullptr;
+      }
+
+      std::map<std::string, StatementList::iterator>::iterator it = m_statementCache.find(statement);
+      if (it != m_statementCache.end())
+      {
+        m_cachedStatements.splice(m_cachedStatements.begin(), m_cachedStatements, it->second);
+        sqlite3_stmt* sqlStmtPtr = it->second->second;
+        sqlite3_reset(sqlStmtPtr);
+        sqlite3_clear_bindings(sqlStmtPtr);
+        return sqlStmtPtr;
+      }
+
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+      if ((code != SQLITE_OK) || !sqlStmtPtr)
+      {
         // must finalize to prevent memory leaks
         sqlite3_finalize(sqlStmtPtr);
+        return nullptr;
       }
-      return valueVector;
+
+      if (m_cachedStatements.size() >= maxCachedStatements)
+      {
+        sqlite3_finalize(m_cachedStatements.back().second);
+        m_statementCache.erase(m_cachedStatements.back().first);
+        m_cachedStatements.pop_back();
+      }
+      m_cachedStatements.push_front(std::make_pair(statement, sqlStmtPtr));
+      m_statementCache.insert(std::make_pair(statement, m_cachedStatements.begin()));
+
+      return sqlStmtPtr;
     }
 
+    void SqlFile_Impl::clearStatementCache() const
+    {
+      for (const std::pair<std::string, sqlite3_stmt*>& cached : m_cachedStatements)
+      {
+        sqlite3_finalize(cached.second);
+      }
+      m_cachedStatements.clear();
+      m_statementCache.clear();
+    }
 
     // execute a statement and return the error code, used for create/drop tables
     int SqlFile_Impl::execute(const std::string& statement)
@@ -2228,110 +2306,235 @@ namespace openstudio{
       return openstudio::DateTime(date, time);
     }
 
+    namespace {
+
+      // accumulates the rows of one timeseries as returned by the Time join, in order
+      class TimeSeriesBuilder
+      {
+        public:
+
+          explicit TimeSeriesBuilder(const DataDictionaryItem& dataDictionary)
+            : m_units(dataDictionary.units), m_isIntervalTimeSeries(false), m_needsFirstDateTime(false), m_cumulativeSeconds(0)
+          {
+            m_stdSecondsFromFirstReport.reserve(8760);
+            m_stdValues.reserve(8760);
+
+            try {
+              ReportingFrequency reportingFrequency(dataDictionary.reportingFrequency);
+              m_isIntervalTimeSeries = (reportingFrequency != ReportingFrequency::Detailed);
+            }catch(const std::exception&){
+            }
+          }
+
+          void addRow(double value, unsigned month, unsigned day, unsigned intervalMinutes)
+          {
+            m_stdValues.push_back(value);
+
+            if (m_stdSecondsFromFirstReport.empty()){
+              if ((month==0) || (day==0)){
+                // RunPeriod reports use the first date in the time table, not sure if this is right
+                m_needsFirstDateTime = true;
+              }else{
+                // DLM: potential leap year problem
+                m_startDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0,0,intervalMinutes,0));
+              }
+            }
+
+            m_stdSecondsFromFirstReport.push_back(m_cumulativeSeconds);
+
+            m_cumulativeSeconds += 60*intervalMinutes;
+
+            // check if this interval is same as the others
+            if (m_isIntervalTimeSeries && !m_reportingIntervalMinutes){
+              m_reportingIntervalMinutes = intervalMinutes;
+            }else if (m_reportingIntervalMinutes && (m_reportingIntervalMinutes.get() != intervalMinutes)){
+              m_isIntervalTimeSeries = false;
+              m_reportingIntervalMinutes.reset();
+            }
+          }
+
+          // true if the start date time must be set from the first date in the time table
+          bool needsFirstDateTime() const
+          {
+            return m_needsFirstDateTime;
+          }
+
+          void setStartDateTime(const openstudio::DateTime& startDateTime)
+          {
+            m_startDateTime = startDateTime;
+          }
+
+          openstudio::OptionalTimeSeries timeSeries() const
+          {
+            openstudio::OptionalTimeSeries ts;
+            if (m_startDateTime && !m_stdSecondsFromFirstReport.empty()){
+              openstudio::Vector values = createVector(m_stdValues);
+              if (m_isIntervalTimeSeries){
+                openstudio::Time intervalTime(0,0,*m_reportingIntervalMinutes,0);
+                ts = openstudio::TimeSeries(*m_startDateTime, intervalTime, values, m_units);
+              }else{
+                ts = openstudio::TimeSeries(*m_startDateTime, m_stdSecondsFromFirstReport, values, m_units);
+              }
+            }
+            return ts;
+          }
+
+        private:
+
+          std::string m_units;
+          bool m_isIntervalTimeSeries;
+          bool m_needsFirstDateTime;
+          long m_cumulativeSeconds;
+          boost::optional<openstudio::DateTime> m_startDateTime;
+          boost::optional<unsigned> m_reportingIntervalMinutes;
+          std::vector<long> m_stdSecondsFromFirstReport;
+          std::vector<double> m_stdValues;
+      };
+
+    }
+
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const DataDictionaryItem& dataDictionary)
     {
-      openstudio::OptionalTimeSeries ts;
-      std::string units = dataDictionary.units;
+      return readTimeSeries(std::vector<DataDictionaryItem>(1, dataDictionary))[0];
+    }
 
-      boost::optional<openstudio::DateTime> startDateTime; 
-      std::vector<long> stdSecondsFromFirstReport;
-      stdSecondsFromFirstReport.reserve(8760);
+    std::vector<openstudio::OptionalTimeSeries> SqlFile_Impl::readTimeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems)
+    {
+      // host parameters per statement, SQLITE_MAX_VARIABLE_NUMBER defaults to 999
+      static const unsigned maxRecordIndices = 500;
 
-      std::vector<double> stdValues;
-      stdValues.reserve(8760);
-      boost::optional<unsigned> reportingIntervalMinutes;
+      std::vector<openstudio::OptionalTimeSeries> result(dataDictionaryItems.size());
 
-      bool isIntervalTimeSeries = false;
-      try {
-        ReportingFrequency reportingFrequency(dataDictionary.reportingFrequency);
-        isIntervalTimeSeries = (reportingFrequency != ReportingFrequency::Detailed);
-      }catch(const std::exception&){
+      if (!m_db)
+      {
+        return result;
       }
 
-      if (m_db) 
+      // one scan of the data joined with Time for each table and environment period
+      std::map<std::pair<std::string, int>, std::vector<unsigned> > groups;
+      for (unsigned i = 0; i < dataDictionaryItems.size(); ++i)
       {
-        std::stringstream s;
-        s << "SELECT dt.VariableValue, Time.Month, Time.Day, Time.Hour, Time.Minute, Time.Interval FROM ";
-        s << dataDictionary.table;
-        s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
-        s << " WHERE ";
-        if (dataDictionary.table == "ReportMeterData")
+        const DataDictionaryItem& dataDictionary = dataDictionaryItems[i];
+        if ((dataDictionary.table == "ReportMeterData") || (dataDictionary.table == "ReportVariableData"))
         {
-          s << " dt.ReportMeterDataDictionaryIndex=";
+          groups[std::make_pair(dataDictionary.table, dataDictionary.envPeriodIndex)].push_back(i);
         }
-        else if (dataDictionary.table == "ReportVariableData")
+      }
+
+      for (const auto& group : groups)
+      {
+        const std::string& table = group.first.first;
+        std::string indexColumn = (table == "ReportMeterData") ? "ReportMeterDataDictionaryIndex" : "ReportVariableDataDictionaryIndex";
+
+        std::map<int, TimeSeriesBuilder> builders;
+        for (unsigned i : group.second)
         {
-          s << " dt.ReportVariableDataDictionaryIndex=";
+          builders.insert(std::make_pair(dataDictionaryItems[i].recordIndex, TimeSeriesBuilder(dataDictionaryItems[i])));
         }
-        s << boost::lexical_cast<std::string>(dataDictionary.recordIndex);
-        s << " AND Time.EnvironmentPeriodIndex = ";
-        s << boost::lexical_cast<std::string>(dataDictionary.envPeriodIndex);
 
-        sqlite3_stmt* sqlStmtPtr;
+        std::map<int, TimeSeriesBuilder>::iterator chunkBegin = builders.begin();
+        while (chunkBegin != builders.end())
+        {
+          std::map<int, TimeSeriesBuilder>::iterator chunkEnd = chunkBegin;
+          unsigned n = 0;
+          for (; (chunkEnd != builders.end()) && (n < maxRecordIndices); ++chunkEnd, ++n){
+          }
 
-        int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+          std::stringstream s;
+          s << "SELECT dt." << indexColumn << ", dt.VariableValue, Time.Month, Time.Day, Time.Interval FROM ";
+          s << table;
+          s << " dt INNER JOIN Time ON Time.timeIndex = dt.TimeIndex";
+          s << " WHERE Time.EnvironmentPeriodIndex = ? AND dt." << indexColumn << " IN (?";
+          for (unsigned j = 1; j < n; ++j){
+            s << ", ?";
+          }
+          s << ") ORDER BY dt.TimeIndex";
 
-        code = sqlite3_step(sqlStmtPtr);
-        std::stringstream s2;
-        s2 << "SQL Query:" << std::endl;
-        s2 << s.str();
-        s2 << "Return Code:" << std::endl;
-        s2 << code;
-        LOG(Debug, s2.str());
+          if (sqlite3_stmt* sqlStmtPtr = cachedStatement(s.str()))
+          {
+            sqlite3_bind_int(sqlStmtPtr, 1, group.first.second);
+            int position = 2;
+            for (std::map<int, TimeSeriesBuilder>::iterator it = chunkBegin; it != chunkEnd; ++it, ++position){
+              sqlite3_bind_int(sqlStmtPtr, position, it->first);
+            }
 
-        long cumulativeSeconds = 0;
+            // rows of each timeseries come in time order, as if it were queried on its own
+            int code = sqlite3_step(sqlStmtPtr);
+            LOG(Debug, "SQL Query:" << std::endl << s.str() << "Return Code:" << std::endl << code);
+            while (code == SQLITE_ROW)
+            {
+              std::map<int, TimeSeriesBuilder>::iterator it = builders.find(sqlite3_column_int(sqlStmtPtr, 0));
+              if (it != builders.end()){
+                it->second.addRow(sqlite3_column_double(sqlStmtPtr, 1),
+                                  sqlite3_column_int(sqlStmtPtr, 2),
+                                  sqlite3_column_int(sqlStmtPtr, 3),
+                                  sqlite3_column_int(sqlStmtPtr, 4)); // interval used for run periods
+              }
 
-        while (code == SQLITE_ROW) 
-        {
-          double value = sqlite3_column_double(sqlStmtPtr, 0);
-          stdValues.push_back(value);
-
-          unsigned month = sqlite3_column_int(sqlStmtPtr, 1);
-          unsigned day = sqlite3_column_int(sqlStmtPtr, 2);
-          unsigned intervalMinutes = sqlite3_column_int(sqlStmtPtr, 5); // used for run periods
-
-          if (!startDateTime){
-            if ((month==0) || (day==0)){
-              // gets called for RunPeriod reports, just returns the first date in the time table, not sure if this is right
-              startDateTime = firstDateTime(false);
-            }else{
-              // DLM: potential leap year problem
-              startDateTime = openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0,0,intervalMinutes,0));
+              // step to next row
+              code = sqlite3_step(sqlStmtPtr);
             }
-          }
 
-          stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+            // reset to release the read lock, the statement is kept for next time
+            sqlite3_reset(sqlStmtPtr);
+          }
 
-          cumulativeSeconds += 60*intervalMinutes;
+          chunkBegin = chunkEnd;
+        }
 
-          // check if this interval is same as the others
-          if (isIntervalTimeSeries && !reportingIntervalMinutes){
-            reportingIntervalMinutes = intervalMinutes;
-          }else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)){
-            isIntervalTimeSeries = false;
-            reportingIntervalMinutes.reset();
+        boost::optional<openstudio::DateTime> first;
+        for (unsigned i : group.second)
+        {
+          TimeSeriesBuilder& builder = builders.find(dataDictionaryItems[i].recordIndex)->second;
+          if (builder.needsFirstDateTime()){
+            if (!first){
+              first = firstDateTime(false);
+            }
+            builder.setStartDateTime(*first);
           }
+          result[i] = builder.timeSeries();
+        }
+      }
 
-          // step to next row
-          code = sqlite3_step(sqlStmtPtr);
+      return result;
+    }
+
+    std::vector<openstudio::OptionalTimeSeries> SqlFile_Impl::timeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems)
+    {
+      std::vector<openstudio::OptionalTimeSeries> result(dataDictionaryItems.size());
+
+      std::vector<unsigned> uncached;
+      std::vector<DataDictionaryItem> uncachedItems;
+      for (unsigned i = 0; i < dataDictionaryItems.size(); ++i)
+      {
+        DataDictionaryTable::index<id>::type::iterator it = m_dataDictionary.get<id>().find(boost::make_tuple(dataDictionaryItems[i].recordIndex, dataDictionaryItems[i].envPeriodIndex));
+        if ((it != m_dataDictionary.get<id>().end()) && (it->table == dataDictionaryItems[i].table) && !it->timeSeries.values().empty())
+        {
+          result[i] = it->timeSeries;
         }
+        else
+        {
+          uncached.push_back(i);
+          uncachedItems.push_back(dataDictionaryItems[i]);
+        }
+      }
 
-        // must finalize to prevent memory leaks
-        sqlite3_finalize(sqlStmtPtr);
+      std::vector<openstudio::OptionalTimeSeries> read = readTimeSeries(uncachedItems);
+      for (unsigned j = 0; j < uncached.size(); ++j)
+      {
+        result[uncached[j]] = read[j];
 
-        if (startDateTime && !stdSecondsFromFirstReport.empty()){
-          if (isIntervalTimeSeries){
-            openstudio::Time intervalTime(0,0,*reportingIntervalMinutes,0);
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*startDateTime, intervalTime, values, units);
-          }else{
-            openstudio::Vector values = createVector(stdValues);
-            ts = openstudio::TimeSeries(*startDateTime, stdSecondsFromFirstReport, values, units);
-          }
+        // lazy caching
+        DataDictionaryTable::index<id>::type::iterator it = m_dataDictionary.get<id>().find(boost::make_tuple(uncachedItems[j].recordIndex, uncachedItems[j].envPeriodIndex));
+        if (read[j] && (it != m_dataDictionary.get<id>().end()) && (it->table == uncachedItems[j].table))
+        {
+          DataDictionaryItem ddi = *it;
+          ddi.timeSeries = *read[j];
+          m_dataDictionary.get<id>().replace(it, ddi);
         }
       }
 
-      return ts;
+      return result;
     }
 
     openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary)
@@ -2664,30 +2867,66 @@ namespace openstudio{
         }
       }
 
-      OS_ASSERT(wquery.m_vetted);
-      OS_ASSERT(wquery.environment()); 
-      OS_ASSERT(!wquery.environment().get().type());
-      OS_ASSERT(wquery.reportingFrequency());
-      OS_ASSERT(wquery.timeSeries());
-      OS_ASSERT(!wquery.timeSeries().get().regex());
-      if (wquery.keyValues()) { OS_ASSERT(!wquery.keyValues().get().regex()); }
+      return timeSeries(std::vector<SqlFileTimeSeriesQuery>(1, wquery));
+    }
+
+    TimeSeriesVector SqlFile_Impl::timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries) {
+      std::vector<DataDictionaryItem> items;
+      for (const SqlFileTimeSeriesQuery& query : queries) {
+        SqlFileTimeSeriesQueryVector expanded;
+        if (query.m_vetted) {
+          expanded.push_back(query);
+        }
+        else {
+          expanded = expandQuery(query);
+          if (expanded.size() != 1) {
+            LOG(Info,"Unable to return timeSeries based on query: " << std::endl << query
+                << ", because it expands to " << expanded.size() << " queries.");
+            continue;
+          }
+        }
+        std::vector<DataDictionaryItem> queryItems = dataDictionaryItems(expanded[0]);
+        items.insert(items.end(), queryItems.begin(), queryItems.end());
+      }
+
+      TimeSeriesVector result;
+      for (const OptionalTimeSeries& ots : timeSeries(items)) {
+        if (ots) { result.push_back(*ots); }
+      }
+      return result;
+    }
+
+    std::vector<DataDictionaryItem> SqlFile_Impl::dataDictionaryItems(const SqlFileTimeSeriesQuery& query) {
+      OS_ASSERT(query.m_vetted);
+      OS_ASSERT(query.environment()); 
+      OS_ASSERT(!query.environment().get().type());
+      OS_ASSERT(query.reportingFrequency());
+      OS_ASSERT(query.timeSeries());
+      OS_ASSERT(!query.timeSeries().get().regex());
+      if (query.keyValues()) { OS_ASSERT(!query.keyValues().get().regex()); }
 
       // environment, reportingPeriod, and timeSeries will all be unique and explicit.
       // keyValues may or may not be explicit.
-      // get all matching timeSeries and append to result.
-      std::string envPeriod = *(wquery.environment().get().name());
-      ReportingFrequency rf = *(wquery.reportingFrequency());
-      std::string tsName = *(wquery.timeSeries().get().name());
-      if (wquery.keyValues()) {
-        for (const std::string kvName : wquery.keyValues().get().names()) {
-          OptionalTimeSeries ots = timeSeries(envPeriod,rf.valueDescription(),tsName,kvName);
-          if (ots) { result.push_back(*ots); }
-        }
+      // get all matching data dictionary items.
+      std::string envPeriod = *(query.environment().get().name());
+      std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+      std::string rf = query.reportingFrequency()->valueDescription();
+      std::string tsName = *(query.timeSeries().get().name());
+      std::vector<std::string> kvNames;
+      if (query.keyValues()) {
+        kvNames = query.keyValues().get().names();
       }
       else {
-        result = timeSeries(envPeriod,rf.valueDescription(),tsName);
+        kvNames = availableKeyValues(envPeriod,rf,tsName);
       }
 
+      std::vector<DataDictionaryItem> result;
+      for (const std::string& kvName : kvNames) {
+        DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator iEpRfNKv = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().find(boost::make_tuple(queryEnvPeriod, rf, tsName, kvName));
+        if (iEpRfNKv != m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().end()) {
+          result.push_back(*iEpRfNKv);
+        }
+      }
       return result;
     }
 
@@ -35,6 +35,8 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <list>
 
 // forward declaration
 namespace resultsviewer{
@@ -648,6 +650,14 @@ namespace openstudio{
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
       std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+      /** Executes each of queries as timeSeries(query) does and returns all of the results in order,
+       *  reading the data of all time series in one query per table and environment period. */
+      std::vector<TimeSeries> timeSeries(const std::vector<SqlFileTimeSeriesQuery>& queries);
+
+      /** Returns the time series for each of dataDictionaryItems in the same order. Time series that are 
+       *  not cached yet are read in one query per table and environment period, and then cached. */
+      std::vector<boost::optional<TimeSeries> > timeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems);
+
       // returns an optional pair of date times for begin and end of daylight savings time
       boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime> > daylightSavingsPeriod() const;
 
@@ -798,6 +808,12 @@ namespace openstudio{
 
       // return a single timeseries matching recordIndex - internally used to retrieve timeseries
       boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
+
+      // read the timeseries for each of dataDictionaryItems from the database, ignores the cached timeseries
+      std::vector<boost::optional<TimeSeries> > readTimeSeries(const std::vector<DataDictionaryItem>& dataDictionaryItems);
+
+      // data dictionary items for query, which must be vetted
+      std::vector<DataDictionaryItem> dataDictionaryItems(const SqlFileTimeSeriesQuery& query);
       std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
       boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
@@ -809,6 +825,45 @@ namespace openstudio{
 
       bool isValidConnection();
 
+      // execute a statement with its ? parameters bound to values, in order, and return the first
+      // (if any) value as a double. statement is cached by its text, so keep values out of it.
+      boost::optional<double> execAndReturnFirstDouble(const std::string& statement, const std::vector<std::string>& values) const;
+
+      // value from tabulardatawithstrings, looked up through one bound statement for all names
+      boost::optional<double> tabularDataValue(const std::string& reportName,
+                                               const std::string& reportForString,
+                                               const std::string& tableName,
+                                               const std::string& rowName,
+                                               const std::string& columnName,
+                                               const std::string& units) const;
+
+      // value from the monthly meter reports, which are not split into tables
+      boost::optional<double> meterTabularDataValue(const std::string& reportName,
+                                                    const std::string& rowName,
+                                                    const std::string& columnName,
+                                                    const std::string& units) const;
+
+      // value from the End Uses table of AnnualBuildingUtilityPerformanceSummary
+      boost::optional<double> endUseValue(const std::string& columnName,
+                                          const std::string& rowName,
+                                          const std::string& units) const;
+
+      // value from the Annual Cost table, reported either with separate units or as 'rowName (units)'
+      boost::optional<double> annualCostValue(const std::string& columnName,
+                                              const std::string& rowName,
+                                              const std::string& units,
+                                              const std::string& rowNameWithUnits) const;
+
+      // returns the cached prepared statement for statement, reset and with bindings cleared, 
+      // prepares and caches the statement if needed, returns nullptr if statement is invalid.
+      // callers must sqlite3_reset the statement when done with it, but never finalize it.
+      // when the cache is full the least recently used statement is finalized, so a caller may
+      // hold on to the previously returned statement while requesting another.
+      sqlite3_stmt* cachedStatement(const std::string& statement) const;
+
+      // finalizes all cached statements, must be called before closing the connection
+      void clearStatementCache() const;
+
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
       openstudio::path m_path;
@@ -817,6 +872,11 @@ namespace openstudio{
       sqlite3* m_db;
       std::string m_sqliteFilename;
 
+      // prepared statements keyed by their sql, most recently used first
+      typedef std::list<std::pair<std::string, sqlite3_stmt*> > StatementList;
+      mutable StatementList m_cachedStatements;
+      mutable std::map<std::string, StatementList::iterator> m_statementCache;
+
       bool m_supportedVersion;
 
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
@@ -0,0 +1,250 @@
+/**********************************************************************
+*  Copyright (c) 2008-2015, Alliance for Sustainable Energy.
+*  All rights reserved.
+*
+*  This library is free software; you can redistribute it and/or
+*  modify it under the terms of the GNU Lesser General Public
+*  License as published by the Free Software Foundation; either
+*  version 2.1 of the License, or (at your option) any later version.
+*
+*  This library is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+*  Lesser General Public License for more details.
+*
+*  You should have received a copy of the GNU Lesser General Public
+*  License along with this library; if not, write to the Free Software
+*  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+**********************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "SqlFileFixture.hpp"
+
+#include "../ColumnarSqlFile.hpp"
+#include "../ColumnarSqlFile_Impl.hpp"
+
+#include "../../time/Date.hpp"
+#include "../../time/DateTime.hpp"
+#include "../../data/DataEnums.hpp"
+#include "../../data/TimeSeries.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+using namespace openstudio;
+
+namespace {
+
+  void expectEqual(const TimeSeries& expected, const TimeSeries& actual)
+  {
+    EXPECT_EQ(expected.firstReportDateTime(), actual.firstReportDateTime());
+    EXPECT_EQ(expected.units(), actual.units());
+    ASSERT_EQ(expected.intervalLength().is_initialized(), actual.intervalLength().is_initialized());
+    if (expected.intervalLength()){
+      EXPECT_EQ(expected.intervalLength()->totalSeconds(), actual.intervalLength()->totalSeconds());
+    }
+    EXPECT_EQ(expected.secondsFromFirstReport(), actual.secondsFromFirstReport());
+    Vector expectedValues = expected.values();
+    Vector actualValues = actual.values();
+    ASSERT_EQ(expectedValues.size(), actualValues.size());
+    for (unsigned i = 0; i < expectedValues.size(); ++i){
+      EXPECT_EQ(expectedValues[i], actualValues[i]);
+    }
+  }
+
+}
+
+TEST_F(SqlFileFixture, ColumnarSqlFile)
+{
+  openstudio::path path = toPath("./ColumnarSqlFile.columnar");
+  if (boost::filesystem::exists(path)){
+    boost::filesystem::remove(path);
+  }
+  ASSERT_TRUE(ColumnarSqlFile::convert(sqlFile, path));
+
+  ColumnarSqlFile columnarSqlFile(path);
+  ASSERT_TRUE(columnarSqlFile.connectionOpen());
+  EXPECT_EQ(path, columnarSqlFile.path());
+
+  // summary values
+  ASSERT_TRUE(columnarSqlFile.netSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.netSiteEnergy(), *columnarSqlFile.netSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.totalSiteEnergy(), *columnarSqlFile.totalSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.netSourceEnergy(), *columnarSqlFile.netSourceEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.totalSourceEnergy(), *columnarSqlFile.totalSourceEnergy());
+  ASSERT_TRUE(columnarSqlFile.hoursSimulated());
+  EXPECT_DOUBLE_EQ(*sqlFile.hoursSimulated(), *columnarSqlFile.hoursSimulated());
+
+  for (const MonthOfYear& month : {MonthOfYear::Jan, MonthOfYear::Jul, MonthOfYear::Dec}){
+    boost::optional<double> expected = sqlFile.energyConsumptionByMonth(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights, month);
+    boost::optional<double> actual = columnarSqlFile.energyConsumptionByMonth(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights, month);
+    ASSERT_EQ(expected.is_initialized(), actual.is_initialized());
+    if (expected){
+      EXPECT_DOUBLE_EQ(*expected, *actual);
+    }
+    expected = sqlFile.peakEnergyDemandByMonth(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights, month);
+    actual = columnarSqlFile.peakEnergyDemandByMonth(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights, month);
+    ASSERT_EQ(expected.is_initialized(), actual.is_initialized());
+    if (expected){
+      EXPECT_DOUBLE_EQ(*expected, *actual);
+    }
+  }
+  EXPECT_FALSE(columnarSqlFile.tabularDataValue("No Such Report", "Entire Facility", boost::none, "Net Site Energy", boost::none, "GJ"));
+
+  // time series
+  std::vector<std::string> envPeriods = sqlFile.availableEnvPeriods();
+  ASSERT_EQ(envPeriods, columnarSqlFile.availableEnvPeriods());
+  unsigned numTimeSeries = 0;
+  for (const std::string& envPeriod : envPeriods){
+    EXPECT_EQ(sqlFile.environmentType(envPeriod), columnarSqlFile.environmentType(envPeriod));
+
+    std::vector<std::string> reportingFrequencies = sqlFile.availableReportingFrequencies(envPeriod);
+    ASSERT_EQ(reportingFrequencies, columnarSqlFile.availableReportingFrequencies(envPeriod));
+    for (const std::string& reportingFrequency : reportingFrequencies){
+      std::vector<std::string> names = sqlFile.availableVariableNames(envPeriod, reportingFrequency);
+      ASSERT_EQ(names, columnarSqlFile.availableVariableNames(envPeriod, reportingFrequency));
+      for (const std::string& name : names){
+        std::vector<std::string> keyValues = sqlFile.availableKeyValues(envPeriod, reportingFrequency, name);
+        ASSERT_EQ(keyValues, columnarSqlFile.availableKeyValues(envPeriod, reportingFrequency, name));
+        for (const std::string& keyValue : keyValues){
+          boost::optional<TimeSeries> expected = sqlFile.timeSeries(envPeriod, reportingFrequency, name, keyValue);
+          boost::optional<TimeSeries> actual = columnarSqlFile.timeSeries(envPeriod, reportingFrequency, name, keyValue);
+          ASSERT_TRUE(expected);
+          ASSERT_TRUE(actual);
+          expectEqual(*expected, *actual);
+          ++numTimeSeries;
+        }
+        EXPECT_EQ(sqlFile.timeSeries(envPeriod, reportingFrequency, name).size(),
+                  columnarSqlFile.timeSeries(envPeriod, reportingFrequency, name).size());
+      }
+    }
+  }
+  EXPECT_LT(0u, numTimeSeries);
+
+  // environment periods come from the EnvironmentPeriods table, whether or not they have time series
+  boost::optional<std::vector<std::string> > envPeriodNames = sqlFile.execAndReturnVectorOfString("SELECT EnvironmentName FROM EnvironmentPeriods");
+  ASSERT_TRUE(envPeriodNames);
+  for (const std::string& envPeriodName : *envPeriodNames){
+    EXPECT_EQ(sqlFile.environmentType(envPeriodName), columnarSqlFile.environmentType(envPeriodName));
+  }
+
+  // environment periods are not case sensitive
+  ASSERT_EQ(1u, envPeriods.size());
+  std::string envPeriod = envPeriods[0];
+  boost::optional<TimeSeries> ts = columnarSqlFile.timeSeries("Chicago Ohare Intl Ap IL USA TMY3 WMO#=725300", "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment");
+  ASSERT_TRUE(ts);
+  EXPECT_DOUBLE_EQ(-8.2625, ts->values()[0]);
+
+  // values can be read from the mapped file directly
+  std::size_t numValues = 0;
+  const double* values = columnarSqlFile.timeSeriesValues(envPeriod, "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment", numValues);
+  ASSERT_TRUE(values);
+  ASSERT_EQ(8760u, numValues);
+  EXPECT_DOUBLE_EQ(-8.2625, values[0]);
+  EXPECT_DOUBLE_EQ(-5.6875, values[8759]);
+  EXPECT_FALSE(columnarSqlFile.timeSeriesValues(envPeriod, "Hourly", "No Such Variable", "Environment", numValues));
+  EXPECT_EQ(0u, numValues);
+  EXPECT_FALSE(columnarSqlFile.timeSeries("No Such Environment", "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment"));
+}
+
+TEST_F(SqlFileFixture, ColumnarSqlFile_Invalid)
+{
+  // missing file
+  ColumnarSqlFile missing(toPath("./ColumnarSqlFile_Missing.columnar"));
+  EXPECT_FALSE(missing.connectionOpen());
+  EXPECT_TRUE(missing.availableEnvPeriods().empty());
+  EXPECT_FALSE(missing.netSiteEnergy());
+
+  // an sql file is not a columnar file
+  ColumnarSqlFile notColumnar(sqlFile.path());
+  EXPECT_FALSE(notColumnar.connectionOpen());
+
+  // truncated file
+  openstudio::path path = toPath("./ColumnarSqlFile_Truncated.columnar");
+  ASSERT_TRUE(ColumnarSqlFile::convert(sqlFile, path));
+  boost::filesystem::resize_file(path, boost::filesystem::file_size(path) / 2);
+  ColumnarSqlFile truncated(path);
+  EXPECT_FALSE(truncated.connectionOpen());
+}
+
+TEST_F(SqlFileFixture, ColumnarSqlFile_NullTabularColumns)
+{
+  // a copy of the sql file whose tabular data is a table that rows can be added to
+  openstudio::path sqlPath = toPath("./ColumnarSqlFile_Nulls.sql");
+  if (boost::filesystem::exists(sqlPath)){
+    boost::filesystem::remove(sqlPath);
+  }
+  boost::filesystem::copy_file(sqlFile.path(), sqlPath);
+  {
+    SqlFile nullsSqlFile(sqlPath);
+    ASSERT_TRUE(nullsSqlFile.connectionOpen());
+    nullsSqlFile.execute("CREATE TABLE TabularDataCopy AS SELECT * FROM TabularDataWithStrings");
+    nullsSqlFile.execute("DROP VIEW TabularDataWithStrings");
+    nullsSqlFile.execute("ALTER TABLE TabularDataCopy RENAME TO TabularDataWithStrings");
+    nullsSqlFile.execute("INSERT INTO TabularDataWithStrings (ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value) "
+                         "VALUES ('Null Report', 'Entire Facility', 'Null Table', 'Null Units', 'Null Column', NULL, '1.5')");
+    nullsSqlFile.execute("INSERT INTO TabularDataWithStrings (ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value) "
+                         "VALUES ('Null Report', 'Entire Facility', 'Null Table', 'Null Value', 'Null Column', 'GJ', NULL)");
+    nullsSqlFile.execute("INSERT INTO TabularDataWithStrings (ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value) "
+                         "VALUES ('Null Report', 'Entire Facility', NULL, 'Null Table', 'Null Column', 'GJ', '2.5')");
+    nullsSqlFile.execute("INSERT INTO TabularDataWithStrings (ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value) "
+                         "VALUES ('Null Report', NULL, 'Null Table', 'Null Report For', 'Null Column', 'GJ', '3.5')");
+    ASSERT_EQ(std::string("2.5"), nullsSqlFile.execAndReturnFirstString("SELECT Value FROM TabularDataWithStrings WHERE RowName = 'Null Table'").get());
+
+    openstudio::path path = toPath("./ColumnarSqlFile_Nulls.columnar");
+    ASSERT_TRUE(ColumnarSqlFile::convert(nullsSqlFile, path));
+    ColumnarSqlFile columnarSqlFile(path);
+    ASSERT_TRUE(columnarSqlFile.connectionOpen());
+
+    // NULL is not the empty string
+    EXPECT_FALSE(columnarSqlFile.tabularDataValue("Null Report", "Entire Facility", std::string("Null Table"), "Null Units", std::string("Null Column"), ""));
+    EXPECT_FALSE(columnarSqlFile.tabularDataValue("Null Report", "Entire Facility", std::string(""), "Null Table", boost::none, "GJ"));
+    EXPECT_FALSE(columnarSqlFile.tabularDataValue("Null Report", "", std::string("Null Table"), "Null Report For", boost::none, "GJ"));
+
+    // a NULL value is missing
+    EXPECT_FALSE(columnarSqlFile.tabularDataValue("Null Report", "Entire Facility", std::string("Null Table"), "Null Value", std::string("Null Column"), "GJ"));
+    EXPECT_FALSE(columnarSqlFile.tabularDataDouble("Null Report", "Entire Facility", std::string("Null Table"), "Null Value", std::string("Null Column"), "GJ"));
+
+    // a NULL table name still matches any table
+    boost::optional<std::string> value = columnarSqlFile.tabularDataValue("Null Report", "Entire Facility", boost::none, "Null Table", std::string("Null Column"), "GJ");
+    ASSERT_TRUE(value);
+    EXPECT_EQ("2.5", *value);
+
+    EXPECT_DOUBLE_EQ(*sqlFile.netSiteEnergy(), *columnarSqlFile.netSiteEnergy());
+  }
+}
+
+TEST_F(SqlFileFixture, ColumnarSqlFile_CorruptRecords)
+{
+  openstudio::path path = toPath("./ColumnarSqlFile_Corrupt.columnar");
+  ASSERT_TRUE(ColumnarSqlFile::convert(sqlFile, path));
+
+  // point the values of every time series past the end of the file
+  {
+    boost::filesystem::fstream file(path, std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    detail::ColumnarHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    ASSERT_TRUE(file.good());
+    for (std::uint64_t i = 0; i < header.numSeries; ++i){
+      detail::ColumnarSeries series;
+      std::streamoff offset = static_cast<std::streamoff>(header.seriesOffset + i * sizeof(series));
+      file.seekg(offset);
+      file.read(reinterpret_cast<char*>(&series), sizeof(series));
+      series.valuesOffset = header.dataSize;
+      file.seekp(offset);
+      file.write(reinterpret_cast<const char*>(&series), sizeof(series));
+    }
+    ASSERT_TRUE(file.good());
+  }
+
+  // records are only checked when they are read
+  ColumnarSqlFile columnarSqlFile(path);
+  ASSERT_TRUE(columnarSqlFile.connectionOpen());
+  std::vector<std::string> envPeriods = columnarSqlFile.availableEnvPeriods();
+  ASSERT_EQ(1u, envPeriods.size());
+  EXPECT_FALSE(columnarSqlFile.availableVariableNames(envPeriods[0], "Hourly").empty());
+  EXPECT_ANY_THROW(columnarSqlFile.timeSeries(envPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment"));
+  std::size_t numValues = 0;
+  EXPECT_ANY_THROW(columnarSqlFile.timeSeriesValues(envPeriods[0], "Hourly", "Site Outdoor Air Drybulb Temperature", "Environment", numValues));
+}
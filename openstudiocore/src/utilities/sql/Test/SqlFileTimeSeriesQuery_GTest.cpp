@@ -94,3 +94,38 @@ TEST_F(SqlFileFixture,SqlFileTimeSeriesQuery_GeneralTests) {
   SCOPED_TRACE("SqlFileTimeSeriesQuery_GeneralTests");
   sqlFileTimeSeriesQueryGeneralTests(sqlFile);
 }
+
+TEST_F(SqlFileFixture,SqlFileTimeSeriesQuery_Bulk) {
+  SqlFileTimeSeriesQuery everythingQuery;
+  SqlFileTimeSeriesQueryVector allQueries = sqlFile.expandQuery(everythingQuery);
+  ASSERT_FALSE(allQueries.empty());
+
+  // separate file so that none of the time series are cached yet
+  SqlFile bulkFile(sqlFile.path());
+  ASSERT_TRUE(bulkFile.connectionOpen());
+  std::vector<openstudio::TimeSeries> bulk = bulkFile.timeSeries(allQueries);
+
+  std::vector<openstudio::TimeSeries> individual;
+  for (const SqlFileTimeSeriesQuery& q : allQueries) {
+    std::vector<openstudio::TimeSeries> temp = sqlFile.timeSeries(q);
+    individual.insert(individual.end(),temp.begin(),temp.end());
+  }
+
+  ASSERT_EQ(individual.size(),bulk.size());
+  for (unsigned i = 0, n = bulk.size(); i < n; ++i) {
+    EXPECT_EQ(individual[i].units(),bulk[i].units());
+    EXPECT_EQ(individual[i].firstReportDateTime(),bulk[i].firstReportDateTime());
+    EXPECT_EQ(individual[i].daysFromFirstReport().size(),bulk[i].daysFromFirstReport().size());
+    ASSERT_EQ(individual[i].values().size(),bulk[i].values().size());
+    for (unsigned j = 0, m = bulk[i].values().size(); j < m; ++j) {
+      EXPECT_EQ(individual[i].values()[j],bulk[i].values()[j]);
+    }
+  }
+
+  // second request comes from the cache
+  std::vector<openstudio::TimeSeries> cached = bulkFile.timeSeries(allQueries);
+  ASSERT_EQ(bulk.size(),cached.size());
+  for (unsigned i = 0, n = bulk.size(); i < n; ++i) {
+    EXPECT_EQ(bulk[i].values().size(),cached[i].values().size());
+  }
+}
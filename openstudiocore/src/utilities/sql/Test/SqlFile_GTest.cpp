@@ -221,6 +221,45 @@ TEST_F(SqlFileFixture, BadStatement)
   EXPECT_FALSE(result);
 }
 
+TEST_F(SqlFileFixture, CachedStatements)
+{
+  // statements are prepared once and reused, results must not depend on earlier use
+  for (unsigned i = 0; i < 3; ++i){
+    OptionalDouble netSiteEnergy = sqlFile.netSiteEnergy();
+    ASSERT_TRUE(netSiteEnergy);
+    EXPECT_NEAR(224.91, *netSiteEnergy, 2);
+
+    OptionalDouble result = sqlFile.execAndReturnFirstDouble("SELECT * FROM NonExistantTable");
+    EXPECT_FALSE(result);
+
+    boost::optional<std::vector<std::string> > envPeriods = sqlFile.execAndReturnVectorOfString("SELECT EnvironmentName FROM EnvironmentPeriods");
+    ASSERT_TRUE(envPeriods);
+    EXPECT_EQ(1u, envPeriods->size());
+  }
+}
+
+TEST_F(SqlFileFixture, BoundStatements)
+{
+  // the site and source totals share one statement with different bindings, so interleave them
+  for (unsigned i = 0; i < 3; ++i){
+    OptionalDouble netSiteEnergy = sqlFile.netSiteEnergy();
+    ASSERT_TRUE(netSiteEnergy);
+    EXPECT_NEAR(224.91, *netSiteEnergy, 2);
+
+    OptionalDouble netSourceEnergy = sqlFile.netSourceEnergy();
+    ASSERT_TRUE(netSourceEnergy);
+    EXPECT_NEAR(570.38, *netSourceEnergy, 2);
+
+    // end uses share another statement
+    OptionalDouble electricityTotalEndUses = sqlFile.electricityTotalEndUses();
+    ASSERT_TRUE(electricityTotalEndUses);
+    OptionalDouble electricityHeating = sqlFile.electricityHeating();
+    ASSERT_TRUE(electricityHeating);
+    EXPECT_LE(*electricityHeating, *electricityTotalEndUses);
+    EXPECT_NE(*netSiteEnergy, *netSourceEnergy);
+  }
+}
+
 TEST_F(SqlFileFixture, CreateSqlFile)
 {
   openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTest.sql");